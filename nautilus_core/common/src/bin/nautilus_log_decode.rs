@@ -0,0 +1,96 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+//! Decodes binary log files written by the `LogFileSink` to text or JSON lines.
+//!
+//! Usage: `nautilus_log_decode [--json] <FILE>...`
+
+use chrono::{DateTime, NaiveDateTime, SecondsFormat, Utc};
+use std::{
+    env,
+    io::{self, BufWriter, Write},
+    path::Path,
+    process,
+};
+
+use nautilus_common::log_file::{write_json_line, BinaryLogReader, LogRecord};
+
+fn write_text_line(out: &mut impl Write, record: &LogRecord) -> Result<(), io::Error> {
+    let secs = (record.timestamp_ns / 1_000_000_000) as i64;
+    let nsecs = (record.timestamp_ns % 1_000_000_000) as u32;
+    let datetime = NaiveDateTime::from_timestamp(secs, nsecs);
+    writeln!(
+        out,
+        "{} [{}] {}: {}",
+        DateTime::<Utc>::from_utc(datetime, Utc).to_rfc3339_opts(SecondsFormat::Nanos, true),
+        record.level,
+        record.component,
+        record.msg,
+    )
+}
+
+fn decode(path: &Path, json: bool, out: &mut impl Write) -> Result<(), io::Error> {
+    let mut buf = Vec::with_capacity(1024);
+    for record in BinaryLogReader::open(path)? {
+        let record = record?;
+        if json {
+            buf.clear();
+            write_json_line(
+                &mut buf,
+                record.timestamp_ns,
+                record.level,
+                &record.component,
+                &record.msg,
+            );
+            out.write_all(&buf)?;
+        } else {
+            write_text_line(out, &record)?;
+        }
+    }
+    Ok(())
+}
+
+fn main() {
+    let mut json = false;
+    let mut paths = Vec::new();
+    for arg in env::args().skip(1) {
+        match arg.as_str() {
+            "--json" => json = true,
+            "-h" | "--help" => {
+                println!("Usage: nautilus_log_decode [--json] <FILE>...");
+                return;
+            }
+            _ => paths.push(arg),
+        }
+    }
+    if paths.is_empty() {
+        eprintln!("Usage: nautilus_log_decode [--json] <FILE>...");
+        process::exit(2);
+    }
+
+    let stdout = io::stdout();
+    let mut out = BufWriter::with_capacity(1 << 20, stdout.lock());
+    for path in &paths {
+        if let Err(e) = decode(Path::new(path), json, &mut out) {
+            let _ = out.flush();
+            if e.kind() == io::ErrorKind::BrokenPipe {
+                return;
+            }
+            eprintln!("Error decoding {}: {}", path, e);
+            process::exit(1);
+        }
+    }
+    let _ = out.flush();
+}
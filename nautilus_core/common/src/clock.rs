@@ -13,16 +13,19 @@
 //  limitations under the License.
 // -------------------------------------------------------------------------------------------------
 
-use crate::timer::TimeEvent;
-use std::collections::HashMap;
+use crate::timer::{EventCategory, TimeEvent};
+use std::cmp::Reverse;
+use std::collections::{BinaryHeap, HashMap};
 use std::ops::{Deref, DerefMut};
+use std::sync::Arc;
 
 use super::timer::TestTimer;
 use nautilus_core::datetime::{nanos_to_millis, nanos_to_secs};
 use nautilus_core::string::pystr_to_string;
 use nautilus_core::time::{Timedelta, Timestamp};
+use nautilus_core::uuid::UUID4;
 use pyo3::prelude::*;
-use pyo3::types::PyList;
+use pyo3::types::{PyList, PyString};
 use pyo3::AsPyPointer;
 
 #[pyclass]
@@ -32,6 +35,9 @@ pub struct TestClock {
     pub timers: HashMap<String, TestTimer>,
     pub handlers: HashMap<String, PyObject>,
     pub default_handler: PyObject,
+    /// Min-heap of (next time, timer name) holding exactly one entry per
+    /// active timer.
+    schedule: BinaryHeap<Reverse<(Timestamp, Arc<str>)>>,
 }
 
 impl TestClock {
@@ -43,9 +49,38 @@ impl TestClock {
             timers: HashMap::new(),
             handlers: HashMap::new(),
             default_handler,
+            schedule: BinaryHeap::new(),
         }
     }
 
+    /// Inserts the given timer, replacing any existing timer with the same name.
+    fn insert_timer(&mut self, name: String, timer: TestTimer, handler: PyObject) {
+        if self.timers.contains_key(&name) {
+            // Rare path, so rebuild the schedule without the replaced timer
+            self.schedule = self
+                .schedule
+                .drain()
+                .filter(|Reverse((_, entry_name))| **entry_name != *name)
+                .collect();
+        }
+        if !timer.is_expired {
+            self.schedule
+                .push(Reverse((timer.next_time_ns, Arc::from(name.as_str()))));
+        }
+        self.timers.insert(name.clone(), timer);
+        self.handlers.insert(name, handler);
+        self.update_next_time();
+    }
+
+    #[inline]
+    fn update_next_time(&mut self) {
+        self.next_time_ns = self
+            .schedule
+            .peek()
+            .map(|Reverse((next_time_ns, _))| *next_time_ns)
+            .unwrap_or(0);
+    }
+
     #[allow(dead_code)] // Temporary
     #[inline]
     fn timestamp(&self) -> f64 {
@@ -68,6 +103,11 @@ impl TestClock {
         self.time_ns = to_time_ns
     }
 
+    /// Advances the clock to the given time, returning the handlers for all
+    /// time events which occurred in chronological order.
+    ///
+    /// Timers are kept in a min-heap keyed by next time, so advancing when no
+    /// timer is due is O(1) and generating k events is O(k log T).
     #[inline]
     pub fn advance_time(&mut self, to_time_ns: Timestamp) -> Vec<TimeEventHandler> {
         // Time should increase monotonically
@@ -76,28 +116,28 @@ impl TestClock {
             "Time to advance to should be greater than current clock time"
         );
 
-        let events = self
-            .timers
-            .iter_mut()
-            .filter(|(_, timer)| !timer.is_expired)
-            .flat_map(|(name_id, timer)| {
-                let handler = self.handlers.get(name_id).unwrap_or(&self.default_handler);
-                timer.advance(to_time_ns).map(|event| TimeEventHandler {
-                    event,
+        let mut events = Vec::new();
+        while matches!(self.schedule.peek(), Some(Reverse((next_time_ns, _))) if *next_time_ns <= to_time_ns)
+        {
+            let Reverse((_, name)) = self.schedule.pop().unwrap();
+            let timer = self
+                .timers
+                .get_mut(&*name)
+                .expect("Scheduled timer was not found");
+            let handler = self.handlers.get(&*name).unwrap_or(&self.default_handler);
+            if let Some(ts_event) = timer.next() {
+                events.push(TimeEventHandler {
+                    name: name.clone(),
+                    ts_event,
                     handler: handler.clone(),
-                })
-            })
-            .collect();
+                });
+            }
+            if !timer.is_expired {
+                self.schedule.push(Reverse((timer.next_time_ns, name)));
+            }
+        }
 
-        // Update next event time for clock with minimum next event time
-        // between all timers.
-        self.next_time_ns = self
-            .timers
-            .values()
-            .filter(|timer| !timer.is_expired)
-            .map(|timer| timer.next_time_ns)
-            .min()
-            .unwrap_or(0);
+        self.update_next_time();
         self.time_ns = to_time_ns;
         events
     }
@@ -150,8 +190,7 @@ impl Clock for TestClock {
             self.time_ns,
             Some(alert_time_ns),
         );
-        self.timers.insert(name.0.clone(), timer);
-        self.handlers.insert(name.0, callback);
+        self.insert_timer(name.0, timer, callback);
     }
 
     #[inline]
@@ -165,23 +204,38 @@ impl Clock for TestClock {
     ) {
         let callback = callback.unwrap_or_else(|| self.default_handler.clone());
         let timer = TestTimer::new(name.1, interval_ns, start_time_ns, Some(stop_time_ns));
-        self.timers.insert(name.0.clone(), timer);
-        self.handlers.insert(name.0, callback);
+        self.insert_timer(name.0, timer, callback);
     }
 }
 
 /// Represents a bundled event and it's handler
+///
+/// The [TimeEvent] (with its UUID and Python name) is only created when the
+/// handler is called.
 #[repr(C)]
 #[pyclass]
 #[derive(Clone)]
 pub struct TimeEventHandler {
-    // A [TimeEvent] generated by a timer
-    pub event: TimeEvent,
+    /// The name of the timer which generated the event
+    pub name: Arc<str>,
+    /// The UNIX timestamp (nanoseconds) when the time event occurred
+    pub ts_event: Timestamp,
     /// A callable handler for this time event
     pub handler: PyObject,
 }
 
 impl TimeEventHandler {
+    /// Creates the [TimeEvent] for this handler.
+    pub fn event(&self, py: Python) -> TimeEvent {
+        TimeEvent {
+            event_id: UUID4::new(),
+            category: EventCategory::EVENT,
+            ts_init: self.ts_event,
+            ts_event: self.ts_event,
+            name: PyString::new(py, &self.name).into(),
+        }
+    }
+
     #[inline]
     pub fn handle_py(self) {
         Python::with_gil(|py| {
@@ -192,7 +246,8 @@ impl TimeEventHandler {
     #[inline]
     pub fn handle(self) {
         Python::with_gil(|py| {
-            let _ = self.handler.call1(py, (self.event,));
+            let event = self.event(py);
+            let _ = self.handler.call1(py, (event,));
         });
     }
 }
@@ -14,5 +14,9 @@
 // -------------------------------------------------------------------------------------------------
 
 pub mod clock;
+pub mod log_file;
 pub mod logging;
+pub mod scheduler;
 pub mod timer;
+pub mod timer_group;
+pub mod timer_wheel;
@@ -0,0 +1,485 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use std::{
+    collections::HashMap,
+    fs::{self, File},
+    io::{self, BufReader, BufWriter, Read, Write},
+    path::{Path, PathBuf},
+};
+
+use crate::logging::LogLevel;
+
+/// The magic bytes which begin every binary log file (the last byte is the version).
+pub const LOG_FILE_MAGIC: &[u8; 8] = b"NTLOG\0\0\x01";
+
+const WRITE_BUFFER_CAPACITY: usize = 1 << 20;
+const RECORD_COMPONENT: u8 = 0;
+const RECORD_LINE: u8 = 1;
+
+#[repr(C)]
+#[derive(Debug, PartialEq, Eq, Clone, Copy)]
+pub enum LogFileFormat {
+    BINARY = 0,
+    JSON = 1,
+}
+
+impl LogFileFormat {
+    fn extension(&self) -> &'static str {
+        match self {
+            LogFileFormat::BINARY => "bin",
+            LogFileFormat::JSON => "jsonl",
+        }
+    }
+}
+
+impl TryFrom<u8> for LogLevel {
+    type Error = io::Error;
+
+    fn try_from(value: u8) -> Result<Self, Self::Error> {
+        match value {
+            10 => Ok(LogLevel::DEBUG),
+            20 => Ok(LogLevel::INFO),
+            30 => Ok(LogLevel::WARNING),
+            40 => Ok(LogLevel::ERROR),
+            50 => Ok(LogLevel::CRITICAL),
+            _ => Err(io::Error::new(
+                io::ErrorKind::InvalidData,
+                format!("invalid log level {}", value),
+            )),
+        }
+    }
+}
+
+/// Represents a decoded log record.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct LogRecord {
+    pub timestamp_ns: u64,
+    pub level: LogLevel,
+    pub component: String,
+    pub msg: String,
+}
+
+/// Appends the given string to the buffer as the contents of a JSON string.
+fn write_json_escaped(buf: &mut Vec<u8>, value: &str) {
+    for c in value.chars() {
+        match c {
+            '"' => buf.extend_from_slice(b"\\\""),
+            '\\' => buf.extend_from_slice(b"\\\\"),
+            '\n' => buf.extend_from_slice(b"\\n"),
+            '\r' => buf.extend_from_slice(b"\\r"),
+            '\t' => buf.extend_from_slice(b"\\t"),
+            c if (c as u32) < 0x20 => {
+                let _ = write!(buf, "\\u{:04x}", c as u32);
+            }
+            c => {
+                let mut utf8 = [0; 4];
+                buf.extend_from_slice(c.encode_utf8(&mut utf8).as_bytes());
+            }
+        }
+    }
+}
+
+/// Appends the given record fields to the buffer as a JSON line.
+pub fn write_json_line(
+    buf: &mut Vec<u8>,
+    timestamp_ns: u64,
+    level: LogLevel,
+    component: &str,
+    msg: &str,
+) {
+    let _ = write!(
+        buf,
+        "{{\"ts\":{},\"level\":\"{}\",\"component\":\"",
+        timestamp_ns, level
+    );
+    write_json_escaped(buf, component);
+    buf.extend_from_slice(b"\",\"msg\":\"");
+    write_json_escaped(buf, msg);
+    buf.extend_from_slice(b"\"}\n");
+}
+
+/// Provides a log file sink which writes compact records through a large write
+/// buffer, rotating to a new file by size and/or time.
+///
+/// Binary files begin with `LOG_FILE_MAGIC` followed by little-endian records:
+/// - component: `0u8, id: u32, len: u32, utf8 bytes` (written once per file
+///   the first time the component logs).
+/// - line: `1u8, ts: u64, level: u8, component id: u32, len: u32, utf8 bytes`.
+///
+/// JSON files contain one object per line with `ts`, `level`, `component` and
+/// `msg` fields. Files are named `{basename}_{seq:04}.{bin|jsonl}`.
+pub struct LogFileSink {
+    pub level: LogLevel,
+    directory: PathBuf,
+    basename: String,
+    format: LogFileFormat,
+    max_size_bytes: u64,
+    rotation_interval_ns: u64,
+    path: PathBuf,
+    file: BufWriter<File>,
+    seq: u32,
+    bytes_written: u64,
+    ts_opened: Option<u64>,
+    components: HashMap<String, u32>,
+    buf: Vec<u8>,
+}
+
+impl LogFileSink {
+    /// Creates a new file sink, creating `directory` if required.
+    ///
+    /// A `max_size_bytes` or `rotation_interval_ns` of zero disables that
+    /// rotation trigger.
+    pub fn new(
+        directory: &Path,
+        basename: &str,
+        level: LogLevel,
+        format: LogFileFormat,
+        max_size_bytes: u64,
+        rotation_interval_ns: u64,
+    ) -> Result<Self, io::Error> {
+        fs::create_dir_all(directory)?;
+        let (seq, path) = next_path(directory, basename, format, 0);
+        let (file, bytes_written) = open(&path, format)?;
+        Ok(LogFileSink {
+            level,
+            directory: directory.to_path_buf(),
+            basename: basename.to_string(),
+            format,
+            max_size_bytes,
+            rotation_interval_ns,
+            path,
+            file,
+            seq,
+            bytes_written,
+            ts_opened: None,
+            components: HashMap::new(),
+            buf: Vec::with_capacity(1024),
+        })
+    }
+
+    /// Returns the path of the file currently being written.
+    pub fn path(&self) -> &Path {
+        &self.path
+    }
+
+    #[inline]
+    fn should_rotate(&self, timestamp_ns: u64) -> bool {
+        (self.max_size_bytes > 0 && self.bytes_written >= self.max_size_bytes)
+            || (self.rotation_interval_ns > 0
+                && matches!(self.ts_opened, Some(ts) if timestamp_ns.saturating_sub(ts) >= self.rotation_interval_ns))
+    }
+
+    fn rotate(&mut self) -> Result<(), io::Error> {
+        self.file.flush()?;
+        let (seq, path) = next_path(&self.directory, &self.basename, self.format, self.seq + 1);
+        let (file, bytes_written) = open(&path, self.format)?;
+        self.seq = seq;
+        self.path = path;
+        self.file = file;
+        self.bytes_written = bytes_written;
+        self.ts_opened = None;
+        self.components.clear();
+        Ok(())
+    }
+
+    /// Writes the given record (buffered, rotating first if due).
+    pub fn write(
+        &mut self,
+        timestamp_ns: u64,
+        level: LogLevel,
+        component: &str,
+        msg: &str,
+    ) -> Result<(), io::Error> {
+        if self.should_rotate(timestamp_ns) {
+            self.rotate()?;
+        }
+        self.ts_opened.get_or_insert(timestamp_ns);
+
+        let buf = &mut self.buf;
+        buf.clear();
+        match self.format {
+            LogFileFormat::BINARY => {
+                let component_id = match self.components.get(component) {
+                    Some(id) => *id,
+                    None => {
+                        let id = self.components.len() as u32;
+                        self.components.insert(component.to_string(), id);
+                        buf.push(RECORD_COMPONENT);
+                        buf.extend_from_slice(&id.to_le_bytes());
+                        buf.extend_from_slice(&(component.len() as u32).to_le_bytes());
+                        buf.extend_from_slice(component.as_bytes());
+                        id
+                    }
+                };
+                buf.push(RECORD_LINE);
+                buf.extend_from_slice(&timestamp_ns.to_le_bytes());
+                buf.push(level as u8);
+                buf.extend_from_slice(&component_id.to_le_bytes());
+                buf.extend_from_slice(&(msg.len() as u32).to_le_bytes());
+                buf.extend_from_slice(msg.as_bytes());
+            }
+            LogFileFormat::JSON => write_json_line(buf, timestamp_ns, level, component, msg),
+        }
+        self.file.write_all(buf)?;
+        self.bytes_written += buf.len() as u64;
+        Ok(())
+    }
+
+    pub fn flush(&mut self) -> Result<(), io::Error> {
+        self.file.flush()
+    }
+}
+
+/// Returns the first unused file path at or after the given sequence number.
+fn next_path(
+    directory: &Path,
+    basename: &str,
+    format: LogFileFormat,
+    mut seq: u32,
+) -> (u32, PathBuf) {
+    loop {
+        let path = directory.join(format!("{}_{:04}.{}", basename, seq, format.extension()));
+        if !path.exists() {
+            return (seq, path);
+        }
+        seq += 1;
+    }
+}
+
+fn open(path: &Path, format: LogFileFormat) -> Result<(BufWriter<File>, u64), io::Error> {
+    let mut file = BufWriter::with_capacity(WRITE_BUFFER_CAPACITY, File::create(path)?);
+    match format {
+        LogFileFormat::BINARY => {
+            file.write_all(LOG_FILE_MAGIC)?;
+            Ok((file, LOG_FILE_MAGIC.len() as u64))
+        }
+        LogFileFormat::JSON => Ok((file, 0)),
+    }
+}
+
+/// Provides an iterator over the records of a binary log file.
+pub struct BinaryLogReader<R: Read> {
+    reader: R,
+    components: HashMap<u32, String>,
+}
+
+impl BinaryLogReader<BufReader<File>> {
+    /// Opens the binary log file at the given path.
+    pub fn open(path: &Path) -> Result<Self, io::Error> {
+        BinaryLogReader::new(BufReader::with_capacity(
+            WRITE_BUFFER_CAPACITY,
+            File::open(path)?,
+        ))
+    }
+}
+
+impl<R: Read> BinaryLogReader<R> {
+    /// Creates a new reader, validating the file header.
+    pub fn new(mut reader: R) -> Result<Self, io::Error> {
+        let mut magic = [0; 8];
+        reader.read_exact(&mut magic)?;
+        if &magic != LOG_FILE_MAGIC {
+            return Err(io::Error::new(
+                io::ErrorKind::InvalidData,
+                "not a binary log file (bad magic bytes)",
+            ));
+        }
+        Ok(BinaryLogReader {
+            reader,
+            components: HashMap::new(),
+        })
+    }
+
+    fn read_u32(&mut self) -> Result<u32, io::Error> {
+        let mut bytes = [0; 4];
+        self.reader.read_exact(&mut bytes)?;
+        Ok(u32::from_le_bytes(bytes))
+    }
+
+    fn read_string(&mut self) -> Result<String, io::Error> {
+        let len = self.read_u32()? as usize;
+        let mut bytes = vec![0; len];
+        self.reader.read_exact(&mut bytes)?;
+        String::from_utf8(bytes).map_err(|e| io::Error::new(io::ErrorKind::InvalidData, e))
+    }
+
+    fn read_record(&mut self, kind: u8) -> Result<Option<LogRecord>, io::Error> {
+        match kind {
+            RECORD_COMPONENT => {
+                let id = self.read_u32()?;
+                let component = self.read_string()?;
+                self.components.insert(id, component);
+                Ok(None)
+            }
+            RECORD_LINE => {
+                let mut ts = [0; 8];
+                self.reader.read_exact(&mut ts)?;
+                let mut level = [0; 1];
+                self.reader.read_exact(&mut level)?;
+                let component_id = self.read_u32()?;
+                let msg = self.read_string()?;
+                let component = self.components.get(&component_id).ok_or_else(|| {
+                    io::Error::new(
+                        io::ErrorKind::InvalidData,
+                        format!("undefined component id {}", component_id),
+                    )
+                })?;
+                Ok(Some(LogRecord {
+                    timestamp_ns: u64::from_le_bytes(ts),
+                    level: LogLevel::try_from(level[0])?,
+                    component: component.clone(),
+                    msg,
+                }))
+            }
+            _ => Err(io::Error::new(
+                io::ErrorKind::InvalidData,
+                format!("invalid record kind {}", kind),
+            )),
+        }
+    }
+}
+
+impl<R: Read> Iterator for BinaryLogReader<R> {
+    type Item = Result<LogRecord, io::Error>;
+
+    fn next(&mut self) -> Option<Self::Item> {
+        loop {
+            let mut kind = [0; 1];
+            match self.reader.read(&mut kind) {
+                Ok(0) => return None,
+                Ok(_) => {}
+                Err(e) => return Some(Err(e)),
+            }
+            match self.read_record(kind[0]) {
+                Ok(Some(record)) => return Some(Ok(record)),
+                Ok(None) => continue,
+                Err(e) => return Some(Err(e)),
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use crate::log_file::{BinaryLogReader, LogFileFormat, LogFileSink, LogRecord};
+    use crate::logging::LogLevel;
+    use std::{fs, path::PathBuf};
+
+    fn temp_dir(name: &str) -> PathBuf {
+        let dir = std::env::temp_dir().join(format!("nautilus_log_file_{}", name));
+        let _ = fs::remove_dir_all(&dir);
+        dir
+    }
+
+    #[test]
+    fn test_binary_round_trip() {
+        let dir = temp_dir("round_trip");
+        let mut sink =
+            LogFileSink::new(&dir, "test", LogLevel::DEBUG, LogFileFormat::BINARY, 0, 0).unwrap();
+        sink.write(1, LogLevel::DEBUG, "DataEngine", "Hello")
+            .unwrap();
+        sink.write(2, LogLevel::ERROR, "RiskEngine", "Denied")
+            .unwrap();
+        sink.write(3, LogLevel::INFO, "DataEngine", "World\n")
+            .unwrap();
+        sink.flush().unwrap();
+
+        let records: Vec<LogRecord> = BinaryLogReader::open(sink.path())
+            .unwrap()
+            .map(|r| r.unwrap())
+            .collect();
+
+        assert_eq!(records.len(), 3);
+        assert_eq!(records[1].timestamp_ns, 2);
+        assert_eq!(records[1].level, LogLevel::ERROR);
+        assert_eq!(records[1].component, "RiskEngine");
+        assert_eq!(records[2].component, "DataEngine");
+        assert_eq!(records[2].msg, "World\n");
+        fs::remove_dir_all(&dir).unwrap();
+    }
+
+    #[test]
+    fn test_json_lines_escapes_strings() {
+        let dir = temp_dir("json");
+        let mut sink =
+            LogFileSink::new(&dir, "test", LogLevel::DEBUG, LogFileFormat::JSON, 0, 0).unwrap();
+        sink.write(1, LogLevel::INFO, "Data\"Engine", "a\tb\\c\u{1}")
+            .unwrap();
+        sink.flush().unwrap();
+
+        let contents = fs::read_to_string(sink.path()).unwrap();
+
+        assert_eq!(
+            contents,
+            "{\"ts\":1,\"level\":\"INF\",\"component\":\"Data\\\"Engine\",\"msg\":\"a\\tb\\\\c\\u0001\"}\n"
+        );
+        fs::remove_dir_all(&dir).unwrap();
+    }
+
+    #[test]
+    fn test_rotates_by_size_and_time() {
+        let dir = temp_dir("rotate");
+        let mut sink = LogFileSink::new(
+            &dir,
+            "test",
+            LogLevel::DEBUG,
+            LogFileFormat::BINARY,
+            64,
+            1_000,
+        )
+        .unwrap();
+        let first = sink.path().to_path_buf();
+        sink.write(
+            0,
+            LogLevel::INFO,
+            "Trader",
+            "0123456789012345678901234567890123456789",
+        )
+        .unwrap();
+        sink.write(1, LogLevel::INFO, "Trader", "size").unwrap(); // Over 64 bytes
+        let second = sink.path().to_path_buf();
+        sink.write(1_001, LogLevel::INFO, "Trader", "time").unwrap(); // Interval elapsed
+        let third = sink.path().to_path_buf();
+        sink.flush().unwrap();
+
+        assert!(first.ends_with("test_0000.bin"));
+        assert!(second.ends_with("test_0001.bin"));
+        assert!(third.ends_with("test_0002.bin"));
+        // Each rotated file is self describing
+        let records: Vec<LogRecord> = BinaryLogReader::open(&third)
+            .unwrap()
+            .map(|r| r.unwrap())
+            .collect();
+        assert_eq!(records[0].component, "Trader");
+        assert_eq!(records[0].msg, "time");
+        fs::remove_dir_all(&dir).unwrap();
+    }
+
+    #[test]
+    fn test_new_does_not_overwrite_existing_files() {
+        let dir = temp_dir("existing");
+        let sink1 =
+            LogFileSink::new(&dir, "test", LogLevel::DEBUG, LogFileFormat::JSON, 0, 0).unwrap();
+        let sink2 =
+            LogFileSink::new(&dir, "test", LogLevel::DEBUG, LogFileFormat::JSON, 0, 0).unwrap();
+
+        assert_ne!(sink1.path(), sink2.path());
+        fs::remove_dir_all(&dir).unwrap();
+    }
+}
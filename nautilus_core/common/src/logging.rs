@@ -13,14 +13,19 @@
 //  limitations under the License.
 // -------------------------------------------------------------------------------------------------
 
-use chrono::{DateTime, NaiveDateTime, SecondsFormat, Utc};
+use chrono::NaiveDateTime;
 use std::{
-    fmt::Display,
+    collections::HashMap,
+    fmt::{Display, Write as FmtWrite},
     io::{self, BufWriter, Stderr, Stdout, Write},
     ops::{Deref, DerefMut},
+    path::Path,
+    sync::mpsc::{sync_channel, Receiver, SyncSender},
+    thread::{self, JoinHandle},
 };
 
-use nautilus_core::string::{pystr_to_string, string_to_pystr};
+use crate::log_file::{LogFileFormat, LogFileSink};
+use nautilus_core::string::{pystr_to_str, pystr_to_string, string_to_pystr};
 use nautilus_core::uuid::UUID4;
 use nautilus_model::identifiers::trader_id::TraderId;
 use pyo3::ffi;
@@ -96,14 +101,255 @@ impl Display for LogFormat {
     }
 }
 
+/// The capacity of the ring buffer between callers and the async writer thread.
+const ASYNC_BUFFER_CAPACITY: usize = 65_536;
+
+/// A log line captured on the calling thread.
+#[derive(Debug)]
+struct LogLine {
+    timestamp_ns: u64,
+    level: LogLevel,
+    color: LogColor,
+    component: String,
+    msg: String,
+    to_stdout: bool,
+}
+
+enum LogEvent {
+    Line(LogLine),
+    FileSink(Box<LogFileSink>),
+    Flush(SyncSender<()>),
+}
+
+/// Formats UTC timestamps as RFC 3339 with nanosecond precision, caching the
+/// date/time prefix so only the nanosecond suffix is formatted per line within
+/// the same second.
+struct TimestampFormatter {
+    secs: i64,
+    prefix: String,
+}
+
+impl TimestampFormatter {
+    fn new() -> Self {
+        TimestampFormatter {
+            secs: i64::MIN,
+            prefix: String::with_capacity(32),
+        }
+    }
+
+    /// Appends the formatted timestamp to the given buffer.
+    #[inline]
+    fn write(&mut self, buf: &mut Vec<u8>, timestamp_ns: u64) {
+        let secs = (timestamp_ns / 1_000_000_000) as i64;
+        let mut nsecs = (timestamp_ns % 1_000_000_000) as u32;
+        if secs != self.secs {
+            let datetime = NaiveDateTime::from_timestamp(secs, 0);
+            self.prefix.clear();
+            let _ = write!(self.prefix, "{}", datetime.format("%Y-%m-%dT%H:%M:%S."));
+            self.secs = secs;
+        }
+        buf.extend_from_slice(self.prefix.as_bytes());
+
+        let mut digits = [b'0'; 9];
+        for digit in digits.iter_mut().rev() {
+            *digit = b'0' + (nsecs % 10) as u8;
+            nsecs /= 10;
+        }
+        buf.extend_from_slice(&digits);
+        buf.push(b'Z');
+    }
+}
+
+/// Formats log lines and writes them to stdout/stderr, and to an optional
+/// file sink.
+///
+/// Lines are formatted into a reused buffer so that logging performs no heap
+/// allocation per line once warmed up.
+struct LogWriter {
+    trader_id: TraderId,
+    timestamp: TimestampFormatter,
+    line_buf: Vec<u8>,
+    out: BufWriter<Stdout>,
+    err: BufWriter<Stderr>,
+    file: Option<LogFileSink>,
+}
+
+impl LogWriter {
+    fn new(trader_id: TraderId) -> Self {
+        LogWriter {
+            trader_id,
+            timestamp: TimestampFormatter::new(),
+            line_buf: Vec::with_capacity(1024),
+            out: BufWriter::new(io::stdout()),
+            err: BufWriter::new(io::stderr()),
+            file: None,
+        }
+    }
+
+    /// Writes the given line into the buffer for its stream (without flushing),
+    /// and to the file sink if the line is at or above the file sinks level.
+    ///
+    /// Lines are assumed to have already passed the loggers stdout level filter
+    /// when `to_stdout` is set.
+    fn write(
+        &mut self,
+        timestamp_ns: u64,
+        level: LogLevel,
+        color: LogColor,
+        component: &str,
+        msg: &str,
+        to_stdout: bool,
+    ) -> Result<(), io::Error> {
+        if let Some(file) = &mut self.file {
+            if level >= file.level {
+                file.write(timestamp_ns, level, component, msg)?;
+            }
+        }
+        if !to_stdout {
+            return Ok(());
+        }
+        let buf = &mut self.line_buf;
+        buf.clear();
+        write!(buf, "{}", LogFormat::BOLD)?;
+        self.timestamp.write(buf, timestamp_ns);
+        writeln!(
+            buf,
+            "{startc} {color}[{level}] {trader_id}.{component}: {msg}{endc}",
+            startc = LogFormat::ENDC,
+            color = color,
+            level = level,
+            trader_id = self.trader_id,
+            component = component,
+            msg = msg,
+            endc = LogFormat::ENDC,
+        )?;
+        if level >= LogLevel::ERROR {
+            self.err.write_all(buf)
+        } else {
+            self.out.write_all(buf)
+        }
+    }
+
+    fn flush(&mut self) -> Result<(), io::Error> {
+        if let Some(file) = &mut self.file {
+            file.flush()?;
+        }
+        self.out.flush()?;
+        self.err.flush()
+    }
+}
+
+/// Runs the writer loop, draining lines from the ring buffer in batches.
+///
+/// The buffers are flushed whenever the ring is drained, immediately after any
+/// ERROR or CRITICAL line (flush-on-error), on request, and finally on shutdown
+/// once all senders have disconnected.
+fn run_writer(mut writer: LogWriter, rx: Receiver<LogEvent>) {
+    while let Ok(event) = rx.recv() {
+        let mut next = Some(event);
+        while let Some(event) = next {
+            match event {
+                LogEvent::Line(line) => {
+                    let _ = writer.write(
+                        line.timestamp_ns,
+                        line.level,
+                        line.color,
+                        &line.component,
+                        &line.msg,
+                        line.to_stdout,
+                    );
+                    if line.level >= LogLevel::ERROR {
+                        let _ = writer.flush();
+                    }
+                }
+                LogEvent::FileSink(sink) => {
+                    let _ = writer.flush();
+                    writer.file = Some(*sink);
+                }
+                LogEvent::Flush(ack) => {
+                    let _ = writer.flush();
+                    let _ = ack.send(());
+                }
+            }
+            next = rx.try_recv().ok();
+        }
+        let _ = writer.flush(); // Batch drained
+    }
+    let _ = writer.flush();
+}
+
+/// Handle to a background writer thread, which is shut down on drop after all
+/// pending lines have been written and flushed.
+struct AsyncWriter {
+    tx: Option<SyncSender<LogEvent>>,
+    handle: Option<JoinHandle<()>>,
+}
+
+impl AsyncWriter {
+    fn spawn(writer: LogWriter, capacity: usize) -> Self {
+        let (tx, rx) = sync_channel(capacity);
+        let handle = thread::Builder::new()
+            .name("nautilus-logger".to_string())
+            .spawn(move || run_writer(writer, rx))
+            .expect("Error spawning logger thread");
+        AsyncWriter {
+            tx: Some(tx),
+            handle: Some(handle),
+        }
+    }
+
+    /// Sends the given line to the writer thread, blocking while the ring is full.
+    #[inline]
+    fn send(&self, line: LogLine) -> Result<(), io::Error> {
+        match &self.tx {
+            Some(tx) => tx
+                .send(LogEvent::Line(line))
+                .map_err(|_| io::Error::new(io::ErrorKind::BrokenPipe, "logger thread stopped")),
+            None => Ok(()),
+        }
+    }
+
+    fn send_file_sink(&self, sink: LogFileSink) {
+        if let Some(tx) = &self.tx {
+            let _ = tx.send(LogEvent::FileSink(Box::new(sink)));
+        }
+    }
+
+    /// Blocks until every line sent so far has been written and flushed.
+    fn flush(&self) -> Result<(), io::Error> {
+        let (ack_tx, ack_rx) = sync_channel(1);
+        if let Some(tx) = &self.tx {
+            if tx.send(LogEvent::Flush(ack_tx)).is_ok() {
+                let _ = ack_rx.recv();
+            }
+        }
+        Ok(())
+    }
+}
+
+impl Drop for AsyncWriter {
+    fn drop(&mut self) {
+        drop(self.tx.take()); // Disconnect so the writer drains and exits
+        if let Some(handle) = self.handle.take() {
+            let _ = handle.join();
+        }
+    }
+}
+
+enum LogSink {
+    Sync(LogWriter),
+    Async(AsyncWriter),
+}
+
 pub struct Logger {
     pub trader_id: TraderId,
     pub machine_id: String,
     pub instance_id: UUID4,
     pub level_stdout: LogLevel,
     pub is_bypassed: bool,
-    out: BufWriter<Stdout>,
-    err: BufWriter<Stderr>,
+    component_levels: HashMap<String, LogLevel>,
+    level_file: Option<LogLevel>,
+    sink: LogSink,
 }
 
 impl Logger {
@@ -113,18 +359,78 @@ impl Logger {
         instance_id: UUID4,
         level_stdout: LogLevel,
         is_bypassed: bool,
+        is_async: bool,
     ) -> Self {
+        let writer = LogWriter::new(trader_id.clone());
+        let sink = if is_async {
+            LogSink::Async(AsyncWriter::spawn(writer, ASYNC_BUFFER_CAPACITY))
+        } else {
+            LogSink::Sync(writer)
+        };
         Logger {
             trader_id,
             machine_id,
             instance_id,
             level_stdout,
             is_bypassed,
-            out: BufWriter::new(io::stdout()),
-            err: BufWriter::new(io::stderr()),
+            component_levels: HashMap::new(),
+            level_file: None,
+            sink,
+        }
+    }
+
+    /// Sets the minimum level for logging messages from the given component to
+    /// stdout, overriding `level_stdout`.
+    pub fn set_component_level(&mut self, component: &str, level: LogLevel) {
+        self.component_levels.insert(component.to_string(), level);
+    }
+
+    /// Adds the given file sink, replacing any existing file sink (which is
+    /// flushed and closed).
+    pub fn add_file_sink(&mut self, sink: LogFileSink) {
+        self.level_file = Some(sink.level);
+        match &mut self.sink {
+            LogSink::Sync(writer) => {
+                let _ = writer.flush();
+                writer.file = Some(sink);
+            }
+            LogSink::Async(writer) => writer.send_file_sink(sink),
         }
     }
 
+    /// Returns whether a message at the given level from the given component
+    /// would be written to the file sink or stdout/stderr.
+    #[inline]
+    pub fn is_enabled(&self, level: LogLevel, component: &str) -> bool {
+        matches!(self.level_file, Some(level_file) if level >= level_file)
+            || self.is_stdout_enabled(level, component)
+    }
+
+    /// Returns whether a message at the given level from the given component
+    /// would be written to stdout/stderr. ERROR and above are always written
+    /// (to stderr).
+    #[inline]
+    fn is_stdout_enabled(&self, level: LogLevel, component: &str) -> bool {
+        if level >= LogLevel::ERROR {
+            return true;
+        }
+        let level_stdout = if self.component_levels.is_empty() {
+            self.level_stdout
+        } else {
+            *self
+                .component_levels
+                .get(component)
+                .unwrap_or(&self.level_stdout)
+        };
+        level >= level_stdout
+    }
+
+    /// If the logger writes from a background thread.
+    #[inline]
+    pub fn is_async(&self) -> bool {
+        matches!(self.sink, LogSink::Async(_))
+    }
+
     #[inline]
     fn log(
         &mut self,
@@ -134,30 +440,29 @@ impl Logger {
         component: &str,
         msg: &str,
     ) -> Result<(), io::Error> {
-        let secs = (timestamp_ns / 1_000_000_000) as i64;
-        let nsecs = (timestamp_ns as i64 - (secs * 1_000_000_000)) as u32;
-        let datetime = NaiveDateTime::from_timestamp(secs, nsecs);
-        let fmt_line = format!(
-            "{bold}{utc}{startc} {color}[{level}] {trader_id}.{component}: {msg}{endc}\n",
-            bold = LogFormat::BOLD,
-            utc = DateTime::<Utc>::from_utc(datetime, Utc)
-                .to_rfc3339_opts(SecondsFormat::Nanos, true),
-            startc = LogFormat::ENDC,
-            color = color,
-            level = level,
-            trader_id = self.trader_id,
-            component = component,
-            msg = msg,
-            endc = LogFormat::ENDC,
-        );
-        if level >= LogLevel::ERROR {
-            self.err.write_all(fmt_line.as_bytes())?;
-            self.err.flush()
-        } else if level >= self.level_stdout {
-            self.out.write_all(fmt_line.as_bytes())?;
-            self.out.flush()
-        } else {
-            Ok(())
+        let to_stdout = self.is_stdout_enabled(level, component);
+        if !to_stdout && !matches!(self.level_file, Some(level_file) if level >= level_file) {
+            return Ok(());
+        }
+        match &mut self.sink {
+            LogSink::Sync(writer) => {
+                writer.write(timestamp_ns, level, color, component, msg, to_stdout)?;
+                if level >= LogLevel::ERROR {
+                    writer.flush()
+                } else if to_stdout {
+                    writer.out.flush()
+                } else {
+                    Ok(())
+                }
+            }
+            LogSink::Async(writer) => writer.send(LogLine {
+                timestamp_ns,
+                level,
+                color,
+                component: component.to_string(),
+                msg: msg.to_string(),
+                to_stdout,
+            }),
         }
     }
 
@@ -218,8 +523,10 @@ impl Logger {
 
     #[inline]
     fn flush(&mut self) -> Result<(), io::Error> {
-        self.out.flush()?;
-        self.err.flush()
+        match &mut self.sink {
+            LogSink::Sync(writer) => writer.flush(),
+            LogSink::Async(writer) => writer.flush(),
+        }
     }
 }
 
@@ -248,6 +555,9 @@ impl DerefMut for CLogger {
 
 /// Creates a logger from a valid Python object pointer and a defined logging level.
 ///
+/// If `is_async` is set then lines are passed through a ring buffer to a
+/// background thread for formatting and writing.
+///
 /// # Safety
 /// - `trader_id_ptr` must be borrowed from a valid Python UTF-8 `str`.
 /// - `machine_id_ptr` must be borrowed from a valid Python UTF-8 `str`.
@@ -259,6 +569,7 @@ pub unsafe extern "C" fn logger_new(
     instance_id_ptr: *mut ffi::PyObject,
     level_stdout: LogLevel,
     is_bypassed: u8,
+    is_async: u8,
 ) -> CLogger {
     CLogger(Box::new(Logger::new(
         TraderId::from(pystr_to_string(trader_id_ptr).as_str()),
@@ -266,13 +577,14 @@ pub unsafe extern "C" fn logger_new(
         UUID4::from(pystr_to_string(instance_id_ptr).as_str()),
         level_stdout,
         is_bypassed != 0,
+        is_async != 0,
     )))
 }
 
 #[no_mangle]
 pub extern "C" fn logger_free(mut logger: CLogger) {
     let _ = logger.flush(); // ignore flushing error if any
-    drop(logger); // Memory freed here
+    drop(logger); // Memory freed here (async writer thread joined)
 }
 
 #[no_mangle]
@@ -312,6 +624,71 @@ pub extern "C" fn logger_is_bypassed(logger: &CLogger) -> u8 {
     logger.is_bypassed as u8
 }
 
+#[no_mangle]
+pub extern "C" fn logger_is_async(logger: &CLogger) -> u8 {
+    logger.is_async() as u8
+}
+
+/// Sets the minimum level for logging messages from the given component to stdout.
+///
+/// # Safety
+/// - `component_ptr` must be borrowed from a valid Python UTF-8 `str`.
+#[no_mangle]
+pub unsafe extern "C" fn logger_set_component_level(
+    logger: &mut CLogger,
+    component_ptr: *mut ffi::PyObject,
+    level: LogLevel,
+) {
+    logger.set_component_level(pystr_to_str(component_ptr), level);
+}
+
+/// Adds a file sink to the logger which writes records at or above the given
+/// level to files in the given directory, rotating by size and/or time.
+///
+/// Returns 1 if the sink was added, or 0 if the first file could not be opened.
+///
+/// # Safety
+/// - `directory_ptr` must be borrowed from a valid Python UTF-8 `str`.
+/// - `basename_ptr` must be borrowed from a valid Python UTF-8 `str`.
+#[no_mangle]
+pub unsafe extern "C" fn logger_add_file_sink(
+    logger: &mut CLogger,
+    directory_ptr: *mut ffi::PyObject,
+    basename_ptr: *mut ffi::PyObject,
+    level: LogLevel,
+    format: LogFileFormat,
+    max_size_bytes: u64,
+    rotation_interval_ns: u64,
+) -> u8 {
+    match LogFileSink::new(
+        Path::new(pystr_to_str(directory_ptr)),
+        pystr_to_str(basename_ptr),
+        level,
+        format,
+        max_size_bytes,
+        rotation_interval_ns,
+    ) {
+        Ok(sink) => {
+            logger.add_file_sink(sink);
+            1
+        }
+        Err(_) => 0,
+    }
+}
+
+/// Return whether a message at the given level from the given component would be logged.
+///
+/// # Safety
+/// - `component_ptr` must be borrowed from a valid Python UTF-8 `str`.
+#[no_mangle]
+pub unsafe extern "C" fn logger_is_enabled(
+    logger: &CLogger,
+    level: LogLevel,
+    component_ptr: *mut ffi::PyObject,
+) -> u8 {
+    logger.is_enabled(level, pystr_to_str(component_ptr)) as u8
+}
+
 /// Log a message from valid Python object pointers.
 ///
 /// # Safety
@@ -326,9 +703,12 @@ pub unsafe extern "C" fn logger_log(
     component_ptr: *mut ffi::PyObject,
     msg_ptr: *mut ffi::PyObject,
 ) {
-    let component = pystr_to_string(component_ptr);
-    let msg = pystr_to_string(msg_ptr);
-    let _ = logger.log(timestamp_ns, level, color, component.as_str(), msg.as_str());
+    let component = pystr_to_str(component_ptr);
+    if !logger.is_enabled(level, component) {
+        return;
+    }
+    let msg = pystr_to_str(msg_ptr);
+    let _ = logger.log(timestamp_ns, level, color, component, msg);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -336,7 +716,9 @@ pub unsafe extern "C" fn logger_log(
 ////////////////////////////////////////////////////////////////////////////////
 #[cfg(test)]
 mod tests {
-    use crate::logging::{LogColor, LogLevel, Logger};
+    use crate::log_file::{BinaryLogReader, LogFileFormat, LogFileSink, LogRecord};
+    use crate::logging::{LogColor, LogLevel, Logger, TimestampFormatter};
+    use chrono::{DateTime, NaiveDateTime, SecondsFormat, Utc};
     use nautilus_core::uuid::UUID4;
     use nautilus_model::identifiers::trader_id::TraderId;
 
@@ -348,6 +730,7 @@ mod tests {
             UUID4::new(),
             LogLevel::DEBUG,
             false,
+            false,
         );
 
         assert_eq!(logger.trader_id, TraderId::from("TRADER-000"));
@@ -362,6 +745,7 @@ mod tests {
             UUID4::new(),
             LogLevel::INFO,
             false,
+            false,
         );
 
         logger
@@ -373,4 +757,120 @@ mod tests {
             )
             .expect("Error while logging");
     }
+
+    #[test]
+    fn test_is_enabled_with_component_levels() {
+        let mut logger = Logger::new(
+            TraderId::from("TRADER-001"),
+            String::from("user-01"),
+            UUID4::new(),
+            LogLevel::INFO,
+            false,
+            false,
+        );
+        logger.set_component_level("DataEngine", LogLevel::DEBUG);
+        logger.set_component_level("RiskEngine", LogLevel::WARNING);
+
+        assert!(!logger.is_enabled(LogLevel::DEBUG, "ExecEngine"));
+        assert!(logger.is_enabled(LogLevel::INFO, "ExecEngine"));
+        assert!(logger.is_enabled(LogLevel::DEBUG, "DataEngine"));
+        assert!(!logger.is_enabled(LogLevel::INFO, "RiskEngine"));
+        assert!(logger.is_enabled(LogLevel::WARNING, "RiskEngine"));
+        assert!(logger.is_enabled(LogLevel::ERROR, "RiskEngine"));
+    }
+
+    #[test]
+    fn test_file_sink_captures_below_stdout_level() {
+        let dir = std::env::temp_dir().join("nautilus_logger_file_sink");
+        let _ = std::fs::remove_dir_all(&dir);
+        for is_async in [false, true] {
+            let mut logger = Logger::new(
+                TraderId::from("TRADER-001"),
+                String::from("user-01"),
+                UUID4::new(),
+                LogLevel::ERROR,
+                false,
+                is_async,
+            );
+            let sink = LogFileSink::new(&dir, "test", LogLevel::DEBUG, LogFileFormat::BINARY, 0, 0)
+                .unwrap();
+            let path = sink.path().to_path_buf();
+            logger.add_file_sink(sink);
+
+            assert!(logger.is_enabled(LogLevel::DEBUG, "RiskEngine"));
+            logger
+                .debug(1, LogColor::NORMAL, "RiskEngine", "Captured.")
+                .unwrap();
+            logger.flush().unwrap();
+
+            let records: Vec<LogRecord> = BinaryLogReader::open(&path)
+                .unwrap()
+                .map(|r| r.unwrap())
+                .collect();
+            assert_eq!(records.len(), 1);
+            assert_eq!(records[0].msg, "Captured.");
+        }
+        std::fs::remove_dir_all(&dir).unwrap();
+    }
+
+    #[test]
+    fn test_timestamp_formatter_matches_rfc3339() {
+        let mut formatter = TimestampFormatter::new();
+        let mut buf = Vec::new();
+
+        for timestamp_ns in [
+            0,
+            1,
+            1650000000000000,
+            1650000000123456789,
+            1650000000999999999,
+            1650000001000000000,
+            1650000000000000001, // Earlier second after a later one
+        ] {
+            buf.clear();
+            formatter.write(&mut buf, timestamp_ns);
+
+            let secs = (timestamp_ns / 1_000_000_000) as i64;
+            let nsecs = (timestamp_ns % 1_000_000_000) as u32;
+            let expected =
+                DateTime::<Utc>::from_utc(NaiveDateTime::from_timestamp(secs, nsecs), Utc)
+                    .to_rfc3339_opts(SecondsFormat::Nanos, true);
+            assert_eq!(std::str::from_utf8(&buf).unwrap(), expected);
+        }
+    }
+
+    #[test]
+    fn test_async_logger_writes_and_shuts_down() {
+        let mut logger = Logger::new(
+            TraderId::from("TRADER-001"),
+            String::from("user-01"),
+            UUID4::new(),
+            LogLevel::INFO,
+            false,
+            true,
+        );
+        assert!(logger.is_async());
+
+        for i in 0..1_000 {
+            logger
+                .info(
+                    1650000000000000 + i,
+                    LogColor::NORMAL,
+                    "RiskEngine",
+                    "Async.",
+                )
+                .expect("Error while logging");
+        }
+        logger
+            .error(
+                1650000000001000,
+                LogColor::RED,
+                "RiskEngine",
+                "Async error.",
+            )
+            .expect("Error while logging");
+        logger.flush().expect("Error while flushing");
+
+        drop(logger); // Joins the writer thread
+    }
 }
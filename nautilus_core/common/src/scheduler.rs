@@ -0,0 +1,349 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use std::cmp::Reverse;
+use std::collections::BinaryHeap;
+use std::ops::{Deref, DerefMut};
+
+use crate::timer_group::{GroupSchedule, TimerGroups};
+use nautilus_core::time::Timestamp;
+
+/// Represents a time event which occurred for a scheduled timer.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub struct TimeEventRecord {
+    pub timer_id: u64,
+    pub ts_event: Timestamp,
+    pub is_expired: u8,
+}
+
+/// Provides a single time event scheduler which can be shared by many clocks.
+///
+/// Timers with an identical schedule are coalesced into groups (see
+/// [TimerGroups]), and groups are kept in a min-heap keyed by next time, with
+/// ties broken by the insertion sequence of each groups earliest set timer.
+/// Advancing when no timer is due is O(1), and firing a group of n timers
+/// costs one heap operation plus n event records. Entries for canceled groups,
+/// or groups since rescheduled, are discarded lazily from the heap.
+pub struct TimeEventScheduler {
+    pub time_ns: Timestamp,
+    groups: TimerGroups,
+    schedule: BinaryHeap<Reverse<(Timestamp, u64, u64)>>,
+    events: Vec<TimeEventRecord>,
+}
+
+impl TimeEventScheduler {
+    pub fn new(initial_ns: Timestamp) -> Self {
+        TimeEventScheduler {
+            time_ns: initial_ns,
+            groups: TimerGroups::default(),
+            schedule: BinaryHeap::new(),
+            events: Vec::new(),
+        }
+    }
+
+    /// Returns the number of active timers.
+    #[inline]
+    pub fn timer_count(&self) -> usize {
+        self.groups.timer_count()
+    }
+
+    /// Adds a timer which next fires at `next_time_ns` then every `interval_ns`,
+    /// expiring once an event at or after `stop_time_ns` has fired (zero for
+    /// no stop time). Replaces any existing timer with the same ID.
+    pub fn add_timer(
+        &mut self,
+        timer_id: u64,
+        interval_ns: u64,
+        next_time_ns: Timestamp,
+        stop_time_ns: Timestamp,
+    ) {
+        self.cancel_timer(timer_id);
+        let schedule = self
+            .groups
+            .add_timer(timer_id, interval_ns, next_time_ns, stop_time_ns);
+        self.push(schedule);
+    }
+
+    /// Cancels the timer with the given ID (if found).
+    pub fn cancel_timer(&mut self, timer_id: u64) {
+        let schedule = self.groups.cancel_timer(timer_id);
+        self.push(schedule);
+    }
+
+    #[inline]
+    fn push(&mut self, schedule: Option<GroupSchedule>) {
+        if let Some((group_id, next_time_ns, min_seq)) = schedule {
+            self.schedule.push(Reverse((next_time_ns, min_seq, group_id)));
+        }
+    }
+
+    #[inline]
+    fn discard_canceled(&mut self) {
+        while let Some(Reverse((next_time_ns, min_seq, group_id))) = self.schedule.peek() {
+            match self.groups.get(*group_id) {
+                Some(group)
+                    if group.next_time_ns == *next_time_ns && group.min_seq() == *min_seq =>
+                {
+                    return
+                }
+                _ => {
+                    self.schedule.pop();
+                }
+            }
+        }
+    }
+
+    /// Returns the time of the next scheduled event (zero if no timers).
+    #[inline]
+    pub fn next_time_ns(&mut self) -> Timestamp {
+        self.discard_canceled();
+        self.schedule
+            .peek()
+            .map(|Reverse((next_time_ns, _, _))| *next_time_ns)
+            .unwrap_or(0)
+    }
+
+    /// Advances the scheduler to the given time, returning the events for all
+    /// timers which fired in chronological order.
+    pub fn advance_time(&mut self, to_time_ns: Timestamp) -> &[TimeEventRecord] {
+        self.events.clear();
+        loop {
+            self.discard_canceled();
+            let group_id = match self.schedule.peek() {
+                Some(Reverse((next_time_ns, _, group_id))) if *next_time_ns <= to_time_ns => {
+                    *group_id
+                }
+                _ => break,
+            };
+            self.schedule.pop();
+
+            let schedule = self.groups.fire(group_id, &mut self.events);
+            self.push(schedule);
+        }
+        self.time_ns = to_time_ns;
+        &self.events
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// C API
+////////////////////////////////////////////////////////////////////////////////
+/// TimeEventScheduler is not C FFI safe, so we box and pass it as an opaque
+/// pointer.
+#[repr(C)]
+pub struct CTimeEventScheduler(Box<TimeEventScheduler>);
+
+impl Deref for CTimeEventScheduler {
+    type Target = TimeEventScheduler;
+
+    fn deref(&self) -> &Self::Target {
+        &self.0
+    }
+}
+
+impl DerefMut for CTimeEventScheduler {
+    fn deref_mut(&mut self) -> &mut Self::Target {
+        &mut self.0
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn time_event_scheduler_new(initial_ns: Timestamp) -> CTimeEventScheduler {
+    CTimeEventScheduler(Box::new(TimeEventScheduler::new(initial_ns)))
+}
+
+#[no_mangle]
+pub extern "C" fn time_event_scheduler_free(scheduler: CTimeEventScheduler) {
+    drop(scheduler); // Memory freed here
+}
+
+#[no_mangle]
+pub extern "C" fn time_event_scheduler_set_time(
+    scheduler: &mut CTimeEventScheduler,
+    to_time_ns: Timestamp,
+) {
+    scheduler.time_ns = to_time_ns;
+}
+
+#[no_mangle]
+pub extern "C" fn time_event_scheduler_timer_count(scheduler: &CTimeEventScheduler) -> u64 {
+    scheduler.timer_count() as u64
+}
+
+#[no_mangle]
+pub extern "C" fn time_event_scheduler_add_timer(
+    scheduler: &mut CTimeEventScheduler,
+    timer_id: u64,
+    interval_ns: u64,
+    next_time_ns: Timestamp,
+    stop_time_ns: Timestamp,
+) {
+    scheduler.add_timer(timer_id, interval_ns, next_time_ns, stop_time_ns);
+}
+
+#[no_mangle]
+pub extern "C" fn time_event_scheduler_cancel_timer(
+    scheduler: &mut CTimeEventScheduler,
+    timer_id: u64,
+) {
+    scheduler.cancel_timer(timer_id);
+}
+
+#[no_mangle]
+pub extern "C" fn time_event_scheduler_next_time_ns(
+    scheduler: &mut CTimeEventScheduler,
+) -> Timestamp {
+    scheduler.next_time_ns()
+}
+
+/// Advances the scheduler to the given time, returning the number of events
+/// which can then be read with `time_event_scheduler_events`.
+#[no_mangle]
+pub extern "C" fn time_event_scheduler_advance_time(
+    scheduler: &mut CTimeEventScheduler,
+    to_time_ns: Timestamp,
+) -> u64 {
+    scheduler.advance_time(to_time_ns).len() as u64
+}
+
+/// Returns a pointer to the events generated by the last advance.
+///
+/// The pointer is valid until the scheduler is next mutated.
+#[no_mangle]
+pub extern "C" fn time_event_scheduler_events(
+    scheduler: &CTimeEventScheduler,
+) -> *const TimeEventRecord {
+    scheduler.events.as_ptr()
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use crate::scheduler::{TimeEventRecord, TimeEventScheduler};
+
+    #[test]
+    fn test_advance_with_no_timers() {
+        let mut scheduler = TimeEventScheduler::new(0);
+
+        assert!(scheduler.advance_time(10).is_empty());
+        assert_eq!(scheduler.time_ns, 10);
+        assert_eq!(scheduler.next_time_ns(), 0);
+    }
+
+    #[test]
+    fn test_advance_orders_events_across_timers() {
+        let mut scheduler = TimeEventScheduler::new(0);
+        scheduler.add_timer(1, 20, 20, 0);
+        scheduler.add_timer(2, 60, 60, 120);
+        scheduler.add_timer(3, 30, 30, 0);
+
+        let ids: Vec<(u64, u64)> = scheduler
+            .advance_time(120)
+            .iter()
+            .map(|e| (e.ts_event, e.timer_id))
+            .collect();
+
+        assert_eq!(
+            ids,
+            vec![
+                (20, 1),
+                (30, 3),
+                (40, 1),
+                (60, 1),
+                (60, 2), // Ties broken in timer insertion order
+                (60, 3),
+                (80, 1),
+                (90, 3),
+                (100, 1),
+                (120, 1),
+                (120, 2),
+                (120, 3),
+            ]
+        );
+        assert_eq!(scheduler.timer_count(), 2);
+        assert_eq!(scheduler.next_time_ns(), 140);
+    }
+
+    #[test]
+    fn test_timer_expires_at_stop_time() {
+        let mut scheduler = TimeEventScheduler::new(0);
+        scheduler.add_timer(7, 5, 5, 5); // Time alert
+
+        let events = scheduler.advance_time(100).to_vec();
+
+        assert_eq!(
+            events,
+            vec![TimeEventRecord {
+                timer_id: 7,
+                ts_event: 5,
+                is_expired: 1
+            }]
+        );
+        assert_eq!(scheduler.timer_count(), 0);
+    }
+
+    #[test]
+    fn test_advance_fans_out_coalesced_timers() {
+        let mut scheduler = TimeEventScheduler::new(0);
+        scheduler.add_timer(1, 60, 60, 0);
+        scheduler.add_timer(2, 30, 30, 0);
+        scheduler.add_timer(3, 60, 60, 0); // Coalesced with timer 1
+        scheduler.add_timer(4, 60, 120, 0); // Merged with timer 1 once aligned
+
+        let events: Vec<(u64, u64)> = scheduler
+            .advance_time(120)
+            .iter()
+            .map(|e| (e.ts_event, e.timer_id))
+            .collect();
+
+        assert_eq!(
+            events,
+            vec![
+                (30, 2),
+                (60, 1), // Group of timers 1 and 3 (earliest set timer 1)
+                (60, 3),
+                (60, 2),
+                (90, 2),
+                (120, 1), // Timer 4 merged into the group of timers 1 and 3
+                (120, 3),
+                (120, 4),
+                (120, 2),
+            ]
+        );
+        assert_eq!(scheduler.groups.group_count(), 2);
+        assert_eq!(scheduler.timer_count(), 4);
+    }
+
+    #[test]
+    fn test_cancel_and_replace_timer() {
+        let mut scheduler = TimeEventScheduler::new(0);
+        scheduler.add_timer(1, 10, 10, 0);
+        scheduler.add_timer(2, 10, 10, 0);
+        scheduler.cancel_timer(1);
+        scheduler.add_timer(2, 15, 15, 0); // Replaces timer 2
+
+        let events: Vec<u64> = scheduler
+            .advance_time(30)
+            .iter()
+            .map(|e| e.ts_event)
+            .collect();
+
+        assert_eq!(events, vec![15, 30]);
+        assert_eq!(scheduler.next_time_ns(), 45);
+    }
+}
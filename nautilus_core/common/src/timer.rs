@@ -82,32 +82,35 @@ impl TestTimer {
             is_expired: false,
         }
     }
-    pub fn advance(&mut self, to_time_ns: Timestamp) -> impl Iterator<Item = TimeEvent> + '_ {
-        self.take_while(move |(_, next_time_ns)| to_time_ns >= *next_time_ns)
-            .map(|(event, _)| event)
+    /// Advances the timer to the given time, yielding the timestamps of the
+    /// time events which occurred.
+    pub fn advance(&mut self, to_time_ns: Timestamp) -> impl Iterator<Item = Timestamp> + '_ {
+        self.take_while(move |next_time_ns| to_time_ns >= *next_time_ns)
     }
+
+    /// Returns the next time event for this timer.
     pub fn pop_next_event(&mut self) -> TimeEvent {
-        self.next().unwrap().0
+        let ts_event = self.next().unwrap();
+        TimeEvent {
+            event_id: UUID4::new(),
+            category: EventCategory::EVENT,
+            ts_init: ts_event,
+            ts_event,
+            name: self.name.clone(), // clone increments ref count on PyObject
+        }
     }
 }
 
+/// Yields the timestamp of each time event, so that a [TimeEvent] (with its
+/// UUID and name) is only created when one is needed.
 impl Iterator for TestTimer {
-    type Item = (TimeEvent, Timestamp);
+    type Item = Timestamp;
 
     fn next(&mut self) -> Option<Self::Item> {
         if self.is_expired {
             None
         } else {
-            let item = (
-                TimeEvent {
-                    event_id: UUID4::new(),
-                    category: EventCategory::EVENT,
-                    ts_init: self.next_time_ns,
-                    ts_event: self.next_time_ns,
-                    name: self.name.clone(), // clone increments ref count on PyObject
-                },
-                self.next_time_ns,
-            );
+            let item = self.next_time_ns;
 
             // if current next event time has exceeded
             // stop time expire timer
@@ -129,7 +132,8 @@ impl Iterator for TestTimer {
 ////////////////////////////////////////////////////////////////////////////////
 #[cfg(test)]
 mod tests {
-    use super::{TestTimer, TimeEvent};
+    use super::TestTimer;
+    use nautilus_core::time::Timestamp;
     use pyo3::prelude::*;
     use pyo3::types::PyString;
 
@@ -149,8 +153,8 @@ mod tests {
         pyo3::prepare_freethreaded_python();
         let name: PyObject = Python::with_gil(|py| PyString::new(py, "G'day mate").into());
         let mut timer = TestTimer::new(name, 1, 0, None);
-        let events: Vec<TimeEvent> = timer.advance(5).collect();
-        assert_eq!(events.len(), 5);
+        let events: Vec<Timestamp> = timer.advance(5).collect();
+        assert_eq!(events, vec![1, 2, 3, 4, 5]);
     }
 
     #[test]
@@ -158,7 +162,7 @@ mod tests {
         pyo3::prepare_freethreaded_python();
         let name: PyObject = Python::with_gil(|py| PyString::new(py, "G'day mate").into());
         let mut timer = TestTimer::new(name, 1, 0, Some(5));
-        let events: Vec<TimeEvent> = timer.advance(10).collect();
+        let events: Vec<Timestamp> = timer.advance(10).collect();
         assert_eq!(events.len(), 5);
     }
 }
@@ -0,0 +1,290 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use std::collections::HashMap;
+
+use crate::scheduler::TimeEventRecord;
+use nautilus_core::time::Timestamp;
+
+/// Represents a group of timers with an identical schedule.
+#[derive(Debug)]
+pub struct TimerGroup {
+    pub interval_ns: u64,
+    pub next_time_ns: Timestamp,
+    pub stop_time_ns: Timestamp,
+    /// The (insertion sequence, timer ID) of each timer, sorted by sequence.
+    pub timers: Vec<(u64, u64)>,
+}
+
+type ScheduleKey = (u64, Timestamp, Timestamp);
+
+impl TimerGroup {
+    #[inline]
+    fn key(&self) -> ScheduleKey {
+        (self.interval_ns, self.next_time_ns, self.stop_time_ns)
+    }
+
+    /// Returns the insertion sequence of the earliest set timer in the group.
+    #[inline]
+    pub fn min_seq(&self) -> u64 {
+        self.timers[0].0
+    }
+
+    pub fn timer_ids(&self) -> Vec<u64> {
+        self.timers.iter().map(|(_, timer_id)| *timer_id).collect()
+    }
+}
+
+/// Represents a group which must be (re)scheduled as
+/// (group ID, next time, minimum insertion sequence).
+pub type GroupSchedule = (u64, Timestamp, u64);
+
+/// Provides coalescing of timers with identical interval, next time and stop
+/// time into groups, so that each group needs only one schedule entry and one
+/// dispatch however many timers it holds.
+///
+/// Each timer carries the sequence in which it was set. A group fires its
+/// timers in sequence order, and is ordered against other groups due at the
+/// same time by its minimum sequence. A group which reaches the schedule of
+/// another group (such as a timer set later on the same boundaries) is merged
+/// into it, keeping the timers in sequence order.
+#[derive(Debug, Default)]
+pub struct TimerGroups {
+    groups: HashMap<u64, TimerGroup>,
+    index: HashMap<ScheduleKey, u64>,
+    timer_groups: HashMap<u64, u64>,
+    next_group_id: u64,
+    next_seq: u64,
+}
+
+impl TimerGroups {
+    /// Returns the number of active timers.
+    #[inline]
+    pub fn timer_count(&self) -> usize {
+        self.timer_groups.len()
+    }
+
+    /// Returns the number of active groups.
+    #[inline]
+    pub fn group_count(&self) -> usize {
+        self.groups.len()
+    }
+
+    #[inline]
+    pub fn get(&self, group_id: u64) -> Option<&TimerGroup> {
+        self.groups.get(&group_id)
+    }
+
+    /// Adds the timer (replacing any existing timer with the same ID), returning
+    /// the groups schedule if the group is new and must be scheduled.
+    ///
+    /// Callers replacing a timer should first call `cancel_timer` themselves
+    /// to reschedule any group whose minimum sequence changed.
+    pub fn add_timer(
+        &mut self,
+        timer_id: u64,
+        interval_ns: u64,
+        next_time_ns: Timestamp,
+        stop_time_ns: Timestamp,
+    ) -> Option<GroupSchedule> {
+        self.cancel_timer(timer_id);
+
+        let seq = self.next_seq;
+        self.next_seq += 1;
+
+        let key = (interval_ns, next_time_ns, stop_time_ns);
+        if let Some(group_id) = self.index.get(&key) {
+            // The new sequence is the largest, so the group stays sorted
+            self.groups
+                .get_mut(group_id)
+                .expect("Indexed group was not found")
+                .timers
+                .push((seq, timer_id));
+            self.timer_groups.insert(timer_id, *group_id);
+            return None;
+        }
+
+        let group_id = self.next_group_id;
+        self.next_group_id += 1;
+        self.groups.insert(
+            group_id,
+            TimerGroup {
+                interval_ns,
+                next_time_ns,
+                stop_time_ns,
+                timers: vec![(seq, timer_id)],
+            },
+        );
+        self.index.insert(key, group_id);
+        self.timer_groups.insert(timer_id, group_id);
+        Some((group_id, next_time_ns, seq))
+    }
+
+    /// Cancels the timer with the given ID (if found), removing its group once
+    /// empty.
+    ///
+    /// Returns the groups schedule if the group remains and its minimum
+    /// sequence changed, so it must be rescheduled.
+    pub fn cancel_timer(&mut self, timer_id: u64) -> Option<GroupSchedule> {
+        let group_id = self.timer_groups.remove(&timer_id)?;
+        let group = self
+            .groups
+            .get_mut(&group_id)
+            .expect("Timer group was not found");
+        let min_seq = group.min_seq();
+        group.timers.retain(|(_, id)| *id != timer_id);
+        if group.timers.is_empty() {
+            let key = group.key();
+            self.groups.remove(&group_id);
+            self.index.remove(&key);
+            return None;
+        }
+        if group.min_seq() != min_seq {
+            return Some((group_id, group.next_time_ns, group.min_seq()));
+        }
+        None
+    }
+
+    /// Fires the group, appending one event per timer in sequence order.
+    ///
+    /// Returns the schedule for the group to (re)schedule, which is the group
+    /// itself, or the group it was merged into if that groups minimum sequence
+    /// changed. Returns `None` if the group expired, or was merged into a group
+    /// already scheduled correctly.
+    pub fn fire(
+        &mut self,
+        group_id: u64,
+        events: &mut Vec<TimeEventRecord>,
+    ) -> Option<GroupSchedule> {
+        let group = self.groups.get_mut(&group_id)?;
+        let ts_event = group.next_time_ns;
+        let is_expired = group.stop_time_ns != 0 && ts_event >= group.stop_time_ns;
+        events.extend(group.timers.iter().map(|(_, timer_id)| TimeEventRecord {
+            timer_id: *timer_id,
+            ts_event,
+            is_expired: is_expired as u8,
+        }));
+        self.index.remove(&group.key());
+
+        if is_expired {
+            let group = self.groups.remove(&group_id).unwrap();
+            for (_, timer_id) in group.timers {
+                self.timer_groups.remove(&timer_id);
+            }
+            return None;
+        }
+
+        group.next_time_ns += group.interval_ns;
+        let key = group.key();
+        match self.index.get(&key) {
+            Some(other_id) => {
+                // Merge into the group already on this schedule
+                let other_id = *other_id;
+                let group = self.groups.remove(&group_id).unwrap();
+                for (_, timer_id) in &group.timers {
+                    self.timer_groups.insert(*timer_id, other_id);
+                }
+                let other = self.groups.get_mut(&other_id).unwrap();
+                let min_seq = other.min_seq();
+                other.timers.extend(group.timers);
+                other.timers.sort_unstable();
+                if other.min_seq() != min_seq {
+                    return Some((other_id, other.next_time_ns, other.min_seq()));
+                }
+                None
+            }
+            None => {
+                self.index.insert(key, group_id);
+                Some((group_id, group.next_time_ns, group.min_seq()))
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use crate::timer_group::TimerGroups;
+
+    #[test]
+    fn test_add_timers_with_identical_schedule_share_group() {
+        let mut groups = TimerGroups::default();
+
+        let schedule1 = groups.add_timer(1, 60, 60, 0);
+        let schedule2 = groups.add_timer(2, 60, 60, 0);
+        let schedule3 = groups.add_timer(3, 60, 30, 0); // Different phase
+
+        assert_eq!(schedule1, Some((0, 60, 0)));
+        assert_eq!(schedule2, None);
+        assert_eq!(schedule3, Some((1, 30, 2)));
+        assert_eq!(groups.get(0).unwrap().timer_ids(), vec![1, 2]);
+        assert_eq!(groups.timer_count(), 3);
+        assert_eq!(groups.group_count(), 2);
+    }
+
+    #[test]
+    fn test_fire_fans_out_to_all_timers() {
+        let mut groups = TimerGroups::default();
+        let (group_id, _, _) = groups.add_timer(1, 60, 60, 120).unwrap();
+        groups.add_timer(2, 60, 60, 120);
+
+        let mut events = Vec::new();
+        assert_eq!(groups.fire(group_id, &mut events), Some((group_id, 120, 0)));
+        assert_eq!(groups.fire(group_id, &mut events), None); // Expired
+
+        let events: Vec<(u64, u64, u8)> = events
+            .iter()
+            .map(|e| (e.timer_id, e.ts_event, e.is_expired))
+            .collect();
+        assert_eq!(
+            events,
+            vec![(1, 60, 0), (2, 60, 0), (1, 120, 1), (2, 120, 1)]
+        );
+        assert_eq!(groups.timer_count(), 0);
+        assert_eq!(groups.group_count(), 0);
+    }
+
+    #[test]
+    fn test_fire_merges_into_group_on_same_schedule_in_sequence_order() {
+        let mut groups = TimerGroups::default();
+        let (early_id, _, _) = groups.add_timer(1, 60, 60, 0).unwrap();
+        let (late_id, _, _) = groups.add_timer(2, 60, 120, 0).unwrap();
+
+        let mut events = Vec::new();
+        // Merged, and the later group now starts with the earlier timer
+        assert_eq!(groups.fire(early_id, &mut events), Some((late_id, 120, 0)));
+
+        assert!(groups.get(early_id).is_none());
+        assert_eq!(groups.get(late_id).unwrap().timer_ids(), vec![1, 2]);
+
+        assert_eq!(groups.cancel_timer(1), Some((late_id, 120, 1)));
+        assert_eq!(groups.get(late_id).unwrap().timer_ids(), vec![2]);
+        assert_eq!(groups.timer_count(), 1);
+    }
+
+    #[test]
+    fn test_cancel_last_timer_removes_group() {
+        let mut groups = TimerGroups::default();
+        let (group_id, _, _) = groups.add_timer(1, 60, 60, 0).unwrap();
+
+        assert_eq!(groups.cancel_timer(1), None);
+        assert_eq!(groups.cancel_timer(1), None); // Already canceled
+
+        assert!(groups.get(group_id).is_none());
+        assert!(groups.add_timer(2, 60, 60, 0).is_some());
+    }
+}
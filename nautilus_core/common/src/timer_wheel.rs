@@ -0,0 +1,470 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use std::ops::{Deref, DerefMut};
+use std::sync::{Condvar, Mutex};
+use std::time::Duration;
+
+use crate::scheduler::TimeEventRecord;
+use crate::timer_group::TimerGroups;
+use nautilus_core::time::{unix_timestamp_ns, Timestamp};
+
+#[derive(Clone, Copy, Debug)]
+struct WheelEntry {
+    group_id: u64,
+    deadline_tick: u64,
+}
+
+/// Provides the state of a hashed timing wheel.
+///
+/// Timers with an identical schedule are coalesced into groups (see
+/// [TimerGroups]). Each group sits in the slot for the tick at (or after) its
+/// next time, so adding, canceling and firing a timer are all O(1), and
+/// advancing only visits the slots for the ticks which have passed. Canceled
+/// groups are discarded lazily when their slot is next visited.
+#[derive(Debug)]
+pub struct TimerWheelState {
+    tick_ns: u64,
+    slots: Vec<Vec<WheelEntry>>,
+    current_tick: u64,
+    groups: TimerGroups,
+    pending: Vec<TimeEventRecord>,
+    is_shutdown: bool,
+}
+
+impl TimerWheelState {
+    pub fn new(tick_ns: u64, num_slots: usize, now_ns: Timestamp) -> Self {
+        assert!(tick_ns > 0, "`tick_ns` was zero");
+        assert!(num_slots > 0, "`num_slots` was zero");
+        TimerWheelState {
+            tick_ns,
+            slots: vec![Vec::new(); num_slots],
+            current_tick: now_ns / tick_ns,
+            groups: TimerGroups::default(),
+            pending: Vec::new(),
+            is_shutdown: false,
+        }
+    }
+
+    /// Returns the number of active timers.
+    #[inline]
+    pub fn timer_count(&self) -> usize {
+        self.groups.timer_count()
+    }
+
+    #[inline]
+    fn schedule(&mut self, group_id: u64, next_time_ns: Timestamp) {
+        // Round up so a timer never fires before its next time
+        let deadline_tick = next_time_ns
+            .div_ceil_tick(self.tick_ns)
+            .max(self.current_tick + 1);
+        let slot = (deadline_tick % self.slots.len() as u64) as usize;
+        self.slots[slot].push(WheelEntry {
+            group_id,
+            deadline_tick,
+        });
+    }
+
+    /// Adds a timer which next fires at `next_time_ns` then every `interval_ns`,
+    /// expiring once an event at or after `stop_time_ns` has fired (zero for
+    /// no stop time). Replaces any existing timer with the same ID.
+    pub fn add_timer(
+        &mut self,
+        timer_id: u64,
+        interval_ns: u64,
+        next_time_ns: Timestamp,
+        stop_time_ns: Timestamp,
+    ) {
+        if let Some((group_id, next_time_ns, _)) =
+            self.groups
+                .add_timer(timer_id, interval_ns, next_time_ns, stop_time_ns)
+        {
+            self.schedule(group_id, next_time_ns);
+        }
+    }
+
+    /// Cancels the timer with the given ID (if found).
+    pub fn cancel_timer(&mut self, timer_id: u64) {
+        // Slots are not ordered by sequence, so a changed group needs no entry
+        self.groups.cancel_timer(timer_id);
+    }
+
+    /// Advances the wheel to the given time, appending the events for all
+    /// timers which are now due to the pending events.
+    pub fn advance_time(&mut self, now_ns: Timestamp) {
+        let now_tick = now_ns / self.tick_ns;
+        if now_tick <= self.current_tick {
+            return; // Still within the current tick
+        }
+
+        // Visit each slot at most once, even when many ticks have passed
+        let num_slots = self.slots.len() as u64;
+        let first_tick = self.current_tick + 1;
+        let last_tick = now_tick.min(self.current_tick + num_slots);
+        self.current_tick = now_tick;
+
+        let start = self.pending.len();
+        for tick in first_tick..=last_tick {
+            let slot = (tick % num_slots) as usize;
+            let mut entries = std::mem::take(&mut self.slots[slot]);
+            entries.retain(|entry| {
+                if entry.deadline_tick > now_tick {
+                    return true; // Due in a later rotation
+                }
+                self.fire(entry.group_id, entry.deadline_tick, now_ns);
+                false
+            });
+            // Entries rescheduled while firing may have been pushed to this slot
+            entries.append(&mut self.slots[slot]);
+            self.slots[slot] = entries;
+        }
+
+        // Events within a batch are ordered by time
+        self.pending[start..].sort_by_key(|event| event.ts_event);
+    }
+
+    fn fire(&mut self, group_id: u64, deadline_tick: u64, now_ns: Timestamp) {
+        match self.groups.get(group_id) {
+            Some(group) if group.next_time_ns.div_ceil_tick(self.tick_ns) <= deadline_tick => {}
+            _ => return, // Canceled, or a stale entry for a merged group
+        }
+
+        // Catch up on any intervals which have passed
+        while let Some((scheduled_id, next_time_ns, _)) =
+            self.groups.fire(group_id, &mut self.pending)
+        {
+            if scheduled_id != group_id {
+                return; // Merged into a group which is already in the wheel
+            }
+            if next_time_ns > now_ns || self.groups.get(group_id).unwrap().interval_ns == 0 {
+                self.schedule(group_id, next_time_ns);
+                return;
+            }
+        }
+    }
+
+    /// Returns the time until the next tick with a scheduled timer (if any).
+    fn time_to_next_deadline(&self, now_ns: Timestamp) -> Option<Duration> {
+        if self.groups.timer_count() == 0 {
+            return None;
+        }
+        let num_slots = self.slots.len() as u64;
+        let next_tick = (1..=num_slots)
+            .map(|offset| self.current_tick + offset)
+            .find(|tick| !self.slots[(tick % num_slots) as usize].is_empty())
+            .unwrap_or(self.current_tick + num_slots);
+        let deadline_ns = next_tick * self.tick_ns;
+        Some(Duration::from_nanos(deadline_ns.saturating_sub(now_ns)))
+    }
+}
+
+trait DivCeilTick {
+    fn div_ceil_tick(self, tick_ns: u64) -> u64;
+}
+
+impl DivCeilTick for u64 {
+    #[inline]
+    fn div_ceil_tick(self, tick_ns: u64) -> u64 {
+        (self + tick_ns - 1) / tick_ns
+    }
+}
+
+/// Provides a timing wheel for live timers, driven by a single thread which
+/// blocks in `wait` until timers are due.
+pub struct TimerWheel {
+    state: Mutex<TimerWheelState>,
+    condvar: Condvar,
+}
+
+impl TimerWheel {
+    pub fn new(tick_ns: u64, num_slots: usize) -> Self {
+        TimerWheel {
+            state: Mutex::new(TimerWheelState::new(
+                tick_ns,
+                num_slots,
+                unix_timestamp_ns(),
+            )),
+            condvar: Condvar::new(),
+        }
+    }
+
+    pub fn timer_count(&self) -> usize {
+        self.state.lock().unwrap().timer_count()
+    }
+
+    pub fn add_timer(
+        &self,
+        timer_id: u64,
+        interval_ns: u64,
+        next_time_ns: Timestamp,
+        stop_time_ns: Timestamp,
+    ) {
+        let mut state = self.state.lock().unwrap();
+        state.add_timer(timer_id, interval_ns, next_time_ns, stop_time_ns);
+        self.condvar.notify_one(); // The next deadline may now be sooner
+    }
+
+    pub fn cancel_timer(&self, timer_id: u64) {
+        self.state.lock().unwrap().cancel_timer(timer_id);
+    }
+
+    /// Wakes the waiting thread, with all subsequent waits returning no events.
+    pub fn shutdown(&self) {
+        self.state.lock().unwrap().is_shutdown = true;
+        self.condvar.notify_all();
+    }
+
+    /// Blocks until at least one timer is due, then moves up to `buffer.len()`
+    /// of the due events into the buffer (any remaining events are returned by
+    /// the next call without blocking).
+    ///
+    /// Returns the number of events written, which is zero only on shutdown.
+    pub fn wait(&self, buffer: &mut [TimeEventRecord]) -> usize {
+        let mut state = self.state.lock().unwrap();
+        loop {
+            if state.is_shutdown {
+                return 0;
+            }
+            let now_ns = unix_timestamp_ns();
+            state.advance_time(now_ns);
+            if !state.pending.is_empty() {
+                let count = state.pending.len().min(buffer.len());
+                for (slot, event) in buffer.iter_mut().zip(state.pending.drain(..count)) {
+                    *slot = event;
+                }
+                return count;
+            }
+            state = match state.time_to_next_deadline(now_ns) {
+                Some(timeout) => self.condvar.wait_timeout(state, timeout).unwrap().0,
+                None => self.condvar.wait(state).unwrap(),
+            };
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// C API
+////////////////////////////////////////////////////////////////////////////////
+/// TimerWheel is not C FFI safe, so we box and pass it as an opaque pointer.
+///
+/// All functions other than `timer_wheel_free` may be called concurrently.
+#[repr(C)]
+pub struct CTimerWheel(Box<TimerWheel>);
+
+impl Deref for CTimerWheel {
+    type Target = TimerWheel;
+
+    fn deref(&self) -> &Self::Target {
+        &self.0
+    }
+}
+
+impl DerefMut for CTimerWheel {
+    fn deref_mut(&mut self) -> &mut Self::Target {
+        &mut self.0
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn timer_wheel_new(tick_ns: u64, num_slots: u64) -> CTimerWheel {
+    CTimerWheel(Box::new(TimerWheel::new(tick_ns, num_slots as usize)))
+}
+
+#[no_mangle]
+pub extern "C" fn timer_wheel_free(wheel: CTimerWheel) {
+    drop(wheel); // Memory freed here
+}
+
+#[no_mangle]
+pub extern "C" fn timer_wheel_timer_count(wheel: &CTimerWheel) -> u64 {
+    wheel.timer_count() as u64
+}
+
+#[no_mangle]
+pub extern "C" fn timer_wheel_add_timer(
+    wheel: &CTimerWheel,
+    timer_id: u64,
+    interval_ns: u64,
+    next_time_ns: Timestamp,
+    stop_time_ns: Timestamp,
+) {
+    wheel.add_timer(timer_id, interval_ns, next_time_ns, stop_time_ns);
+}
+
+#[no_mangle]
+pub extern "C" fn timer_wheel_cancel_timer(wheel: &CTimerWheel, timer_id: u64) {
+    wheel.cancel_timer(timer_id);
+}
+
+#[no_mangle]
+pub extern "C" fn timer_wheel_shutdown(wheel: &CTimerWheel) {
+    wheel.shutdown();
+}
+
+/// Blocks until timers are due, writing up to `capacity` events to `buffer`.
+///
+/// Returns the number of events written, which is zero only on shutdown.
+///
+/// # Safety
+/// - `buffer` must point to at least `capacity` writable `TimeEventRecord_t`.
+#[no_mangle]
+pub unsafe extern "C" fn timer_wheel_wait(
+    wheel: &CTimerWheel,
+    buffer: *mut TimeEventRecord,
+    capacity: u64,
+) -> u64 {
+    let buffer = std::slice::from_raw_parts_mut(buffer, capacity as usize);
+    wheel.wait(buffer) as u64
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use std::sync::Arc;
+    use std::thread;
+
+    use crate::scheduler::TimeEventRecord;
+    use crate::timer_wheel::{TimerWheel, TimerWheelState};
+    use nautilus_core::time::unix_timestamp_ns;
+
+    fn drain(state: &mut TimerWheelState) -> Vec<(u64, u64, u8)> {
+        state
+            .pending
+            .drain(..)
+            .map(|e| (e.timer_id, e.ts_event, e.is_expired))
+            .collect()
+    }
+
+    #[test]
+    fn test_advance_within_tick_fires_nothing() {
+        let mut state = TimerWheelState::new(10, 8, 0);
+        state.add_timer(1, 5, 5, 0);
+
+        state.advance_time(9);
+
+        assert!(state.pending.is_empty());
+    }
+
+    #[test]
+    fn test_advance_fires_due_timers_in_order() {
+        let mut state = TimerWheelState::new(10, 8, 0);
+        state.add_timer(1, 30, 30, 0);
+        state.add_timer(2, 20, 20, 40);
+        state.add_timer(3, 15, 15, 15);
+
+        state.advance_time(45);
+
+        assert_eq!(
+            drain(&mut state),
+            vec![(3, 15, 1), (2, 20, 0), (1, 30, 0), (2, 40, 1)]
+        );
+        assert_eq!(state.timer_count(), 1);
+
+        state.advance_time(60);
+
+        assert_eq!(drain(&mut state), vec![(1, 60, 0)]);
+    }
+
+    #[test]
+    fn test_timer_beyond_one_rotation_waits_for_later_rotation() {
+        let mut state = TimerWheelState::new(10, 4, 0);
+        state.add_timer(1, 100, 100, 0);
+
+        state.advance_time(50);
+        assert!(state.pending.is_empty());
+
+        state.advance_time(100);
+        assert_eq!(drain(&mut state), vec![(1, 100, 0)]);
+    }
+
+    #[test]
+    fn test_advance_after_stall_catches_up_intervals() {
+        let mut state = TimerWheelState::new(10, 4, 0);
+        state.add_timer(1, 10, 10, 0);
+
+        state.advance_time(1_000);
+
+        let events = drain(&mut state);
+        assert_eq!(events.len(), 100);
+        assert_eq!(events.last(), Some(&(1, 1_000, 0)));
+    }
+
+    #[test]
+    fn test_coalesced_timers_share_one_entry() {
+        let mut state = TimerWheelState::new(10, 8, 0);
+        for timer_id in 1..=100 {
+            state.add_timer(timer_id, 60, 60, 0);
+        }
+
+        state.advance_time(60);
+
+        assert_eq!(state.slots.iter().map(Vec::len).sum::<usize>(), 1);
+        let events = drain(&mut state);
+        assert_eq!(events.len(), 100);
+        assert!(events.iter().all(|e| e.1 == 60));
+        assert_eq!(events.first(), Some(&(1, 60, 0)));
+        assert_eq!(events.last(), Some(&(100, 60, 0)));
+    }
+
+    #[test]
+    fn test_cancel_and_replace_timer() {
+        let mut state = TimerWheelState::new(10, 8, 0);
+        state.add_timer(1, 10, 10, 0);
+        state.add_timer(2, 10, 10, 0);
+        state.cancel_timer(1);
+        state.add_timer(2, 25, 25, 0); // Replaces timer 2
+
+        state.advance_time(50);
+
+        assert_eq!(drain(&mut state), vec![(2, 25, 0), (2, 50, 0)]);
+    }
+
+    #[test]
+    fn test_wait_returns_due_events_and_shutdown() {
+        let wheel = Arc::new(TimerWheel::new(1_000_000, 64));
+        let now_ns = unix_timestamp_ns();
+        wheel.add_timer(1, 5_000_000, now_ns + 5_000_000, now_ns + 5_000_000);
+
+        let waiter = {
+            let wheel = wheel.clone();
+            thread::spawn(move || {
+                let mut buffer = [TimeEventRecord {
+                    timer_id: 0,
+                    ts_event: 0,
+                    is_expired: 0,
+                }; 4];
+                let count = wheel.wait(&mut buffer);
+                (buffer[..count].to_vec(), wheel.wait(&mut buffer))
+            })
+        };
+
+        thread::sleep(std::time::Duration::from_millis(50));
+        wheel.shutdown();
+        let (events, count_after_shutdown) = waiter.join().unwrap();
+
+        assert_eq!(
+            events,
+            vec![TimeEventRecord {
+                timer_id: 1,
+                ts_event: now_ns + 5_000_000,
+                is_expired: 1,
+            }]
+        );
+        assert!(unix_timestamp_ns() >= now_ns + 5_000_000);
+        assert_eq!(count_after_shutdown, 0);
+    }
+}
@@ -1,4 +1,4 @@
-use nautilus_common::clock::{new_test_clock, set_time_alert_ns};
+use nautilus_common::clock::{new_test_clock, set_time_alert_ns, set_timer_ns};
 use pyo3::{prelude::*, types::*};
 use std::str::FromStr;
 
@@ -34,7 +34,7 @@ fn test_clock_advance() {
     assert_eq!(test_clock.timers.values().next().unwrap().is_expired, true);
     assert_eq!(events.len(), 1);
     assert_eq!(
-        events.iter().next().unwrap().event.name.to_string(),
+        events.iter().next().unwrap().name.to_string(),
         String::from_str(timer_name).unwrap()
     );
 }
@@ -69,3 +69,35 @@ fn test_clock_even_callback() {
 
     assert_eq!(count, 1);
 }
+
+#[test]
+fn test_clock_advance_orders_events_across_timers() {
+    pyo3::prepare_freethreaded_python();
+    let mut test_clock = Python::with_gil(|py| {
+        let dummy = PyDict::new(py).into();
+        new_test_clock(0, dummy)
+    });
+
+    let (name1, name2) = Python::with_gil(|py| {
+        let name1: PyObject = PyString::new(py, "timer1").into();
+        let name2: PyObject = PyString::new(py, "timer2").into();
+        (name1, name2)
+    });
+
+    unsafe {
+        set_timer_ns(&mut test_clock, name1, 3, 0, 9, None);
+        set_timer_ns(&mut test_clock, name2, 2, 0, 4, None);
+    }
+    assert_eq!(test_clock.next_time_ns, 2);
+
+    let events = test_clock.advance_time(1);
+    assert!(events.is_empty());
+    assert_eq!(test_clock.next_time_ns, 2);
+
+    let events = test_clock.advance_time(10);
+    let timestamps: Vec<u64> = events.iter().map(|e| e.ts_event).collect();
+
+    assert_eq!(timestamps, vec![2, 3, 4, 6, 9]);
+    assert!(test_clock.timers.values().all(|timer| timer.is_expired));
+    assert_eq!(test_clock.next_time_ns, 0);
+}
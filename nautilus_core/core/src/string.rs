@@ -25,6 +25,21 @@ pub unsafe fn pystr_to_string(ptr: *mut ffi::PyObject) -> String {
     Python::with_gil(|py| PyString::from_borrowed_ptr(py, ptr).to_string())
 }
 
+/// Returns a string slice borrowed from a valid Python object pointer, without
+/// copying the UTF-8 data.
+///
+/// # Safety
+/// - `ptr` must be borrowed from a valid Python UTF-8 `str` which outlives the
+/// returned slice.
+/// - Assumes the GIL is held by the caller.
+#[inline(always)]
+pub unsafe fn pystr_to_str<'a>(ptr: *mut ffi::PyObject) -> &'a str {
+    let py = Python::assume_gil_acquired();
+    PyString::from_borrowed_ptr(py, ptr)
+        .to_str()
+        .expect("Python `str` was not valid UTF-8")
+}
+
 /// Returns a pointer to a valid Python UTF-8 string.
 ///
 /// # Safety
@@ -71,6 +86,18 @@ mod tests {
         assert_eq!(string.to_string(), "hello, world")
     }
 
+    #[test]
+    fn test_pystr_to_str() {
+        prepare_freethreaded_python();
+        let gil = Python::acquire_gil();
+        let py = gil.python();
+        let pystr = PyString::new(py, "hello, world").into_ptr();
+
+        let s = unsafe { pystr_to_str(pystr) };
+
+        assert_eq!(s, "hello, world")
+    }
+
     #[test]
     fn test_string_to_pystr() {
         prepare_freethreaded_python();
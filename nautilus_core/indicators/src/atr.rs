@@ -0,0 +1,286 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use crate::average::{MovingAverage, MovingAverageType};
+use std::ops::{Deref, DerefMut};
+
+/// An indicator which calculates the average true range across a rolling window.
+/// Different moving average types can be selected for the inner calculation.
+#[derive(Clone, Debug)]
+pub struct AverageTrueRange {
+    pub period: usize,
+    pub value: f64,
+    pub has_inputs: bool,
+    pub initialized: bool,
+    ma: MovingAverage,
+    use_previous: bool,
+    value_floor: f64,
+    previous_close: f64,
+}
+
+impl AverageTrueRange {
+    pub fn new(
+        period: usize,
+        ma_type: MovingAverageType,
+        use_previous: bool,
+        value_floor: f64,
+    ) -> Self {
+        assert!(value_floor >= 0.0, "`value_floor` was negative");
+        AverageTrueRange {
+            period,
+            value: 0.0,
+            has_inputs: false,
+            initialized: false,
+            ma: MovingAverage::new(period, ma_type),
+            use_previous,
+            value_floor,
+            previous_close: 0.0,
+        }
+    }
+
+    /// Update the indicator with the given raw values.
+    #[inline]
+    pub fn update_raw(&mut self, high: f64, low: f64, close: f64) {
+        let true_range = self.true_range(high, low, close);
+        self.ma.update_raw(true_range);
+
+        self.floor_value();
+        self.check_initialized();
+    }
+
+    /// Update the indicator with each of the given raw values in order.
+    ///
+    /// # Panics
+    /// - If the input slices are not of equal length.
+    pub fn update_many(&mut self, high: &[f64], low: &[f64], close: &[f64]) {
+        assert_eq!(high.len(), low.len());
+        assert_eq!(high.len(), close.len());
+        if high.is_empty() {
+            return;
+        }
+
+        let true_ranges: Vec<f64> = (0..high.len())
+            .map(|i| self.true_range(high[i], low[i], close[i]))
+            .collect();
+        self.ma.update_many(&true_ranges);
+
+        self.floor_value();
+        self.check_initialized();
+    }
+
+    pub fn reset(&mut self) {
+        self.ma.reset();
+        self.previous_close = 0.0;
+        self.value = 0.0;
+        self.has_inputs = false;
+        self.initialized = false;
+    }
+
+    #[inline]
+    fn true_range(&mut self, high: f64, low: f64, close: f64) -> f64 {
+        if self.use_previous {
+            if !self.has_inputs {
+                self.previous_close = close;
+                self.has_inputs = true;
+            }
+            let true_range = self.previous_close.max(high) - low.min(self.previous_close);
+            self.previous_close = close;
+            true_range
+        } else {
+            high - low
+        }
+    }
+
+    #[inline]
+    fn floor_value(&mut self) {
+        let ma_value = self.ma.value();
+        if self.value_floor == 0.0 || self.value_floor < ma_value {
+            self.value = ma_value;
+        } else {
+            // Floor the value
+            self.value = self.value_floor;
+        }
+    }
+
+    #[inline]
+    fn check_initialized(&mut self) {
+        if !self.initialized {
+            self.has_inputs = true;
+            if self.ma.initialized() {
+                self.initialized = true;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// C API
+////////////////////////////////////////////////////////////////////////////////
+/// AverageTrueRange is not C FFI safe, so we box and pass it as an opaque pointer.
+#[repr(C)]
+pub struct CAverageTrueRange(Box<AverageTrueRange>);
+
+impl Deref for CAverageTrueRange {
+    type Target = AverageTrueRange;
+
+    fn deref(&self) -> &Self::Target {
+        &self.0
+    }
+}
+
+impl DerefMut for CAverageTrueRange {
+    fn deref_mut(&mut self) -> &mut Self::Target {
+        &mut self.0
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn atr_new(
+    period: usize,
+    ma_type: MovingAverageType,
+    use_previous: u8,
+    value_floor: f64,
+) -> CAverageTrueRange {
+    CAverageTrueRange(Box::new(AverageTrueRange::new(
+        period,
+        ma_type,
+        use_previous != 0,
+        value_floor,
+    )))
+}
+
+#[no_mangle]
+pub extern "C" fn atr_free(atr: CAverageTrueRange) {
+    drop(atr); // Memory freed here
+}
+
+#[no_mangle]
+pub extern "C" fn atr_update_raw(
+    atr: &mut CAverageTrueRange,
+    high: f64,
+    low: f64,
+    close: f64,
+) -> f64 {
+    atr.update_raw(high, low, close);
+    atr.value
+}
+
+/// Update the indicator with `len` raw values and return the latest value.
+///
+/// # Safety
+/// - `high`, `low` and `close` must each point to `len` contiguous values.
+#[no_mangle]
+pub unsafe extern "C" fn atr_update_many(
+    atr: &mut CAverageTrueRange,
+    high: *const f64,
+    low: *const f64,
+    close: *const f64,
+    len: usize,
+) -> f64 {
+    if len > 0 {
+        atr.update_many(
+            std::slice::from_raw_parts(high, len),
+            std::slice::from_raw_parts(low, len),
+            std::slice::from_raw_parts(close, len),
+        );
+    }
+    atr.value
+}
+
+#[no_mangle]
+pub extern "C" fn atr_reset(atr: &mut CAverageTrueRange) {
+    atr.reset();
+}
+
+#[no_mangle]
+pub extern "C" fn atr_initialized(atr: &CAverageTrueRange) -> u8 {
+    atr.initialized as u8
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use crate::atr::AverageTrueRange;
+    use crate::average::MovingAverageType;
+
+    fn atr() -> AverageTrueRange {
+        AverageTrueRange::new(10, MovingAverageType::Simple, true, 0.0)
+    }
+
+    #[test]
+    fn test_atr_with_no_inputs_returns_zero() {
+        assert_eq!(atr().value, 0.0);
+    }
+
+    #[test]
+    fn test_atr_with_close_on_high_returns_expected_value() {
+        let mut atr = atr();
+        let mut high = 1.00010;
+        let mut low = 1.00000;
+
+        for _ in 0..1000 {
+            high += 0.00010;
+            low += 0.00010;
+            let close = high;
+            atr.update_raw(high, low, close);
+        }
+
+        assert!((atr.value - 0.00010).abs() < 1e-9);
+        assert!(atr.initialized);
+    }
+
+    #[test]
+    fn test_atr_with_value_floor_returns_floor() {
+        let mut atr = AverageTrueRange::new(10, MovingAverageType::Simple, true, 0.00005);
+
+        atr.update_raw(1.00020, 1.00020, 1.00020);
+
+        assert_eq!(atr.value, 0.00005);
+    }
+
+    #[test]
+    fn test_atr_update_many_matches_single_updates() {
+        let high: Vec<f64> = (0..100).map(|i| 1.1 + (i as f64 * 0.1).sin()).collect();
+        let low: Vec<f64> = high.iter().map(|h| h - 0.05).collect();
+        let close: Vec<f64> = high.iter().map(|h| h - 0.02).collect();
+
+        for ma_type in [MovingAverageType::Simple, MovingAverageType::Exponential] {
+            let mut single = AverageTrueRange::new(14, ma_type, true, 0.0);
+            let mut batch = AverageTrueRange::new(14, ma_type, true, 0.0);
+            for i in 0..high.len() {
+                single.update_raw(high[i], low[i], close[i]);
+            }
+            batch.update_many(&high[..50], &low[..50], &close[..50]);
+            batch.update_many(&high[50..], &low[50..], &close[50..]);
+
+            assert_eq!(batch.value, single.value);
+            assert_eq!(batch.initialized, single.initialized);
+        }
+    }
+
+    #[test]
+    fn test_atr_reset() {
+        let mut atr = atr();
+        atr.update_raw(1.00020, 1.00010, 1.00015);
+
+        atr.reset();
+
+        assert_eq!(atr.value, 0.0);
+        assert!(!atr.has_inputs);
+        assert!(!atr.initialized);
+    }
+}
@@ -0,0 +1,226 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use std::ops::{Deref, DerefMut};
+
+/// An indicator which calculates an exponential moving average across a
+/// rolling window.
+#[derive(Clone, Debug)]
+pub struct ExponentialMovingAverage {
+    pub period: usize,
+    pub alpha: f64,
+    pub value: f64,
+    pub count: usize,
+    pub has_inputs: bool,
+    pub initialized: bool,
+}
+
+impl ExponentialMovingAverage {
+    pub fn new(period: usize) -> Self {
+        Self::with_alpha(period, 2.0 / (period as f64 + 1.0))
+    }
+
+    pub fn with_alpha(period: usize, alpha: f64) -> Self {
+        assert!(period > 0, "`period` was not positive");
+        ExponentialMovingAverage {
+            period,
+            alpha,
+            value: 0.0,
+            count: 0,
+            has_inputs: false,
+            initialized: false,
+        }
+    }
+
+    /// Update the indicator with the given raw value.
+    #[inline]
+    pub fn update_raw(&mut self, value: f64) {
+        // Check if this is the initial input
+        if !self.has_inputs {
+            self.value = value;
+        }
+
+        self.value = self.alpha * value + ((1.0 - self.alpha) * self.value);
+        self.increment_count();
+    }
+
+    /// Update the indicator with each of the given raw values in order.
+    pub fn update_many(&mut self, values: &[f64]) {
+        // The recurrence is inherently sequential, so the batch path only saves
+        // the per value dispatch
+        for &value in values {
+            self.update_raw(value);
+        }
+    }
+
+    pub fn reset(&mut self) {
+        self.value = 0.0;
+        self.count = 0;
+        self.has_inputs = false;
+        self.initialized = false;
+    }
+
+    #[inline]
+    fn increment_count(&mut self) {
+        self.count += 1;
+
+        // Initialization logic
+        if !self.initialized {
+            self.has_inputs = true;
+            if self.count >= self.period {
+                self.initialized = true;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// C API
+////////////////////////////////////////////////////////////////////////////////
+/// ExponentialMovingAverage is not C FFI safe, so we box and pass it as an
+/// opaque pointer.
+#[repr(C)]
+pub struct CExponentialMovingAverage(Box<ExponentialMovingAverage>);
+
+impl Deref for CExponentialMovingAverage {
+    type Target = ExponentialMovingAverage;
+
+    fn deref(&self) -> &Self::Target {
+        &self.0
+    }
+}
+
+impl DerefMut for CExponentialMovingAverage {
+    fn deref_mut(&mut self) -> &mut Self::Target {
+        &mut self.0
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn ema_new(period: usize, alpha: f64) -> CExponentialMovingAverage {
+    CExponentialMovingAverage(Box::new(ExponentialMovingAverage::with_alpha(
+        period, alpha,
+    )))
+}
+
+#[no_mangle]
+pub extern "C" fn ema_free(ema: CExponentialMovingAverage) {
+    drop(ema); // Memory freed here
+}
+
+#[no_mangle]
+pub extern "C" fn ema_update_raw(ema: &mut CExponentialMovingAverage, value: f64) -> f64 {
+    ema.update_raw(value);
+    ema.value
+}
+
+/// Update the indicator with `len` raw values and return the latest value.
+///
+/// # Safety
+/// - `values` must point to `len` contiguous values.
+#[no_mangle]
+pub unsafe extern "C" fn ema_update_many(
+    ema: &mut CExponentialMovingAverage,
+    values: *const f64,
+    len: usize,
+) -> f64 {
+    if len > 0 {
+        ema.update_many(std::slice::from_raw_parts(values, len));
+    }
+    ema.value
+}
+
+#[no_mangle]
+pub extern "C" fn ema_reset(ema: &mut CExponentialMovingAverage) {
+    ema.reset();
+}
+
+#[no_mangle]
+pub extern "C" fn ema_count(ema: &CExponentialMovingAverage) -> usize {
+    ema.count
+}
+
+#[no_mangle]
+pub extern "C" fn ema_initialized(ema: &CExponentialMovingAverage) -> u8 {
+    ema.initialized as u8
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use crate::average::ema::ExponentialMovingAverage;
+
+    #[test]
+    fn test_ema_with_one_input_returns_expected_value() {
+        let mut ema = ExponentialMovingAverage::new(10);
+
+        ema.update_raw(1.0);
+
+        assert_eq!(ema.value, 1.0);
+        assert_eq!(ema.count, 1);
+        assert!(ema.has_inputs);
+        assert!(!ema.initialized);
+    }
+
+    #[test]
+    fn test_ema_with_three_inputs_returns_expected_value() {
+        let mut ema = ExponentialMovingAverage::new(10);
+
+        ema.update_raw(1.0);
+        ema.update_raw(2.0);
+        ema.update_raw(3.0);
+
+        assert_eq!(ema.value, 1.5123966942148757);
+    }
+
+    #[test]
+    fn test_ema_initialized_after_period_inputs() {
+        let mut ema = ExponentialMovingAverage::new(3);
+
+        ema.update_many(&[1.0, 2.0, 3.0]);
+
+        assert!(ema.initialized);
+    }
+
+    #[test]
+    fn test_ema_update_many_matches_single_updates() {
+        let values: Vec<f64> = (0..100).map(|i| (i as f64 * 0.1).sin()).collect();
+        let mut single = ExponentialMovingAverage::new(20);
+        let mut batch = ExponentialMovingAverage::new(20);
+
+        for value in &values {
+            single.update_raw(*value);
+        }
+        batch.update_many(&values);
+
+        assert_eq!(batch.value, single.value);
+        assert_eq!(batch.count, single.count);
+    }
+
+    #[test]
+    fn test_ema_reset() {
+        let mut ema = ExponentialMovingAverage::new(10);
+        ema.update_raw(1.0);
+
+        ema.reset();
+
+        assert_eq!(ema.value, 0.0);
+        assert_eq!(ema.count, 0);
+        assert!(!ema.has_inputs);
+        assert!(!ema.initialized);
+    }
+}
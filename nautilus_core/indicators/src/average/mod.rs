@@ -0,0 +1,111 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+pub mod ema;
+pub mod sma;
+
+use crate::average::ema::ExponentialMovingAverage;
+use crate::average::sma::SimpleMovingAverage;
+
+/// Represents the type of moving average.
+///
+/// The discriminants match the Python `MovingAverageType` enum.
+#[repr(C)]
+#[derive(Copy, Clone, Debug, Hash, PartialEq, Eq)]
+#[allow(non_camel_case_types)]
+pub enum MovingAverageType {
+    Simple = 0,
+    Exponential = 1,
+    Wilder = 5,
+}
+
+/// Provides static dispatch over the moving averages used as inner
+/// calculations by other indicators.
+#[derive(Clone, Debug)]
+pub enum MovingAverage {
+    Simple(SimpleMovingAverage),
+    Exponential(ExponentialMovingAverage),
+}
+
+impl MovingAverage {
+    pub fn new(period: usize, ma_type: MovingAverageType) -> Self {
+        match ma_type {
+            MovingAverageType::Simple => MovingAverage::Simple(SimpleMovingAverage::new(period)),
+            MovingAverageType::Exponential => {
+                MovingAverage::Exponential(ExponentialMovingAverage::new(period))
+            }
+            MovingAverageType::Wilder => MovingAverage::Exponential(
+                ExponentialMovingAverage::with_alpha(period, 1.0 / period as f64),
+            ),
+        }
+    }
+
+    #[inline]
+    pub fn update_raw(&mut self, value: f64) {
+        match self {
+            MovingAverage::Simple(ma) => ma.update_raw(value),
+            MovingAverage::Exponential(ma) => ma.update_raw(value),
+        }
+    }
+
+    pub fn update_many(&mut self, values: &[f64]) {
+        match self {
+            MovingAverage::Simple(ma) => ma.update_many(values),
+            MovingAverage::Exponential(ma) => ma.update_many(values),
+        }
+    }
+
+    #[inline]
+    pub fn value(&self) -> f64 {
+        match self {
+            MovingAverage::Simple(ma) => ma.value,
+            MovingAverage::Exponential(ma) => ma.value,
+        }
+    }
+
+    #[inline]
+    pub fn initialized(&self) -> bool {
+        match self {
+            MovingAverage::Simple(ma) => ma.initialized,
+            MovingAverage::Exponential(ma) => ma.initialized,
+        }
+    }
+
+    pub fn reset(&mut self) {
+        match self {
+            MovingAverage::Simple(ma) => ma.reset(),
+            MovingAverage::Exponential(ma) => ma.reset(),
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use crate::average::{MovingAverage, MovingAverageType};
+
+    #[test]
+    fn test_wilder_moving_average_uses_reciprocal_period_alpha() {
+        let mut ma = MovingAverage::new(10, MovingAverageType::Wilder);
+
+        ma.update_raw(1.0);
+        ma.update_raw(2.0);
+
+        assert_eq!(ma.value(), 1.1);
+        assert!(!ma.initialized());
+    }
+}
@@ -0,0 +1,251 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use std::collections::VecDeque;
+use std::ops::{Deref, DerefMut};
+
+/// An indicator which calculates a simple moving average across a rolling window.
+#[derive(Clone, Debug)]
+pub struct SimpleMovingAverage {
+    pub period: usize,
+    pub value: f64,
+    pub count: usize,
+    pub has_inputs: bool,
+    pub initialized: bool,
+    inputs: VecDeque<f64>,
+}
+
+impl SimpleMovingAverage {
+    pub fn new(period: usize) -> Self {
+        assert!(period > 0, "`period` was not positive");
+        SimpleMovingAverage {
+            period,
+            value: 0.0,
+            count: 0,
+            has_inputs: false,
+            initialized: false,
+            inputs: VecDeque::with_capacity(period),
+        }
+    }
+
+    /// Update the indicator with the given raw value.
+    #[inline]
+    pub fn update_raw(&mut self, value: f64) {
+        self.push(value);
+        self.value = self.mean();
+        self.increment_count(1);
+    }
+
+    /// Update the indicator with each of the given raw values in order.
+    ///
+    /// Only the final window is averaged, as the intermediate values would be
+    /// overwritten.
+    pub fn update_many(&mut self, values: &[f64]) {
+        if values.is_empty() {
+            return;
+        }
+
+        let start = values.len().saturating_sub(self.period);
+        for &value in &values[start..] {
+            self.push(value);
+        }
+
+        self.value = self.mean();
+        self.increment_count(values.len());
+    }
+
+    pub fn reset(&mut self) {
+        self.inputs.clear();
+        self.value = 0.0;
+        self.count = 0;
+        self.has_inputs = false;
+        self.initialized = false;
+    }
+
+    #[inline]
+    fn push(&mut self, value: f64) {
+        if self.inputs.len() == self.period {
+            self.inputs.pop_front();
+        }
+        self.inputs.push_back(value);
+    }
+
+    /// Returns the mean of the window, summed in insertion order.
+    #[inline]
+    fn mean(&self) -> f64 {
+        self.inputs.iter().sum::<f64>() / self.inputs.len() as f64
+    }
+
+    #[inline]
+    fn increment_count(&mut self, count: usize) {
+        self.count += count;
+
+        // Initialization logic
+        if !self.initialized {
+            self.has_inputs = true;
+            if self.count >= self.period {
+                self.initialized = true;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// C API
+////////////////////////////////////////////////////////////////////////////////
+/// SimpleMovingAverage is not C FFI safe, so we box and pass it as an opaque
+/// pointer.
+#[repr(C)]
+pub struct CSimpleMovingAverage(Box<SimpleMovingAverage>);
+
+impl Deref for CSimpleMovingAverage {
+    type Target = SimpleMovingAverage;
+
+    fn deref(&self) -> &Self::Target {
+        &self.0
+    }
+}
+
+impl DerefMut for CSimpleMovingAverage {
+    fn deref_mut(&mut self) -> &mut Self::Target {
+        &mut self.0
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sma_new(period: usize) -> CSimpleMovingAverage {
+    CSimpleMovingAverage(Box::new(SimpleMovingAverage::new(period)))
+}
+
+#[no_mangle]
+pub extern "C" fn sma_free(sma: CSimpleMovingAverage) {
+    drop(sma); // Memory freed here
+}
+
+#[no_mangle]
+pub extern "C" fn sma_update_raw(sma: &mut CSimpleMovingAverage, value: f64) -> f64 {
+    sma.update_raw(value);
+    sma.value
+}
+
+/// Update the indicator with `len` raw values and return the latest value.
+///
+/// # Safety
+/// - `values` must point to `len` contiguous values.
+#[no_mangle]
+pub unsafe extern "C" fn sma_update_many(
+    sma: &mut CSimpleMovingAverage,
+    values: *const f64,
+    len: usize,
+) -> f64 {
+    if len > 0 {
+        sma.update_many(std::slice::from_raw_parts(values, len));
+    }
+    sma.value
+}
+
+#[no_mangle]
+pub extern "C" fn sma_reset(sma: &mut CSimpleMovingAverage) {
+    sma.reset();
+}
+
+#[no_mangle]
+pub extern "C" fn sma_count(sma: &CSimpleMovingAverage) -> usize {
+    sma.count
+}
+
+#[no_mangle]
+pub extern "C" fn sma_initialized(sma: &CSimpleMovingAverage) -> u8 {
+    sma.initialized as u8
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use crate::average::sma::SimpleMovingAverage;
+
+    #[test]
+    fn test_sma_with_one_input_returns_expected_value() {
+        let mut sma = SimpleMovingAverage::new(10);
+
+        sma.update_raw(1.0);
+
+        assert_eq!(sma.value, 1.0);
+        assert!(sma.has_inputs);
+        assert!(!sma.initialized);
+    }
+
+    #[test]
+    fn test_sma_with_ten_inputs_returns_expected_value() {
+        let mut sma = SimpleMovingAverage::new(10);
+
+        for i in 1..=10 {
+            sma.update_raw(i as f64);
+        }
+
+        assert_eq!(sma.value, 5.5);
+        assert_eq!(sma.count, 10);
+        assert!(sma.initialized);
+    }
+
+    #[test]
+    fn test_sma_rolls_window() {
+        let mut sma = SimpleMovingAverage::new(2);
+
+        sma.update_raw(1.0);
+        sma.update_raw(2.0);
+        sma.update_raw(3.0);
+
+        assert_eq!(sma.value, 2.5);
+    }
+
+    #[test]
+    fn test_sma_update_many_matches_single_updates() {
+        let values: Vec<f64> = (0..100).map(|i| (i as f64 * 0.1).sin()).collect();
+        let mut single = SimpleMovingAverage::new(20);
+        let mut batch = SimpleMovingAverage::new(20);
+
+        for value in &values[..5] {
+            single.update_raw(*value);
+        }
+        batch.update_many(&values[..5]);
+        assert_eq!(batch.value, single.value);
+        assert!(!batch.initialized);
+
+        for value in &values[5..] {
+            single.update_raw(*value);
+        }
+        batch.update_many(&values[5..]);
+
+        assert_eq!(batch.value, single.value);
+        assert_eq!(batch.count, single.count);
+        assert!(batch.initialized);
+    }
+
+    #[test]
+    fn test_sma_reset() {
+        let mut sma = SimpleMovingAverage::new(10);
+        sma.update_raw(1.0);
+
+        sma.reset();
+
+        assert_eq!(sma.value, 0.0);
+        assert_eq!(sma.count, 0);
+        assert!(!sma.has_inputs);
+        assert!(!sma.initialized);
+    }
+}
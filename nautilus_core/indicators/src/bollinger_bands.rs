@@ -0,0 +1,273 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use crate::average::{MovingAverage, MovingAverageType};
+use std::collections::VecDeque;
+use std::ops::{Deref, DerefMut};
+
+/// An indicator which calculates Bollinger Bands®, a set of trend lines plotted
+/// `k` standard deviations above and below a moving average of the typical price.
+#[derive(Clone, Debug)]
+pub struct BollingerBands {
+    pub period: usize,
+    pub k: f64,
+    pub upper: f64,
+    pub middle: f64,
+    pub lower: f64,
+    pub has_inputs: bool,
+    pub initialized: bool,
+    ma: MovingAverage,
+    prices: VecDeque<f64>,
+}
+
+impl BollingerBands {
+    pub fn new(period: usize, k: f64, ma_type: MovingAverageType) -> Self {
+        BollingerBands {
+            period,
+            k,
+            upper: 0.0,
+            middle: 0.0,
+            lower: 0.0,
+            has_inputs: false,
+            initialized: false,
+            ma: MovingAverage::new(period, ma_type),
+            prices: VecDeque::with_capacity(period + 1),
+        }
+    }
+
+    /// Update the indicator with the given prices.
+    #[inline]
+    pub fn update_raw(&mut self, high: f64, low: f64, close: f64) {
+        let typical = (high + low + close) / 3.0;
+
+        self.push_price(typical);
+        self.ma.update_raw(typical);
+        self.calculate();
+    }
+
+    /// Update the indicator with each of the given prices in order.
+    ///
+    /// The bands only depend on the final window, so the standard deviation is
+    /// calculated once for the whole batch.
+    ///
+    /// # Panics
+    /// - If the input slices are not of equal length.
+    pub fn update_many(&mut self, high: &[f64], low: &[f64], close: &[f64]) {
+        assert_eq!(high.len(), low.len());
+        assert_eq!(high.len(), close.len());
+        if high.is_empty() {
+            return;
+        }
+
+        let typicals: Vec<f64> = (0..high.len())
+            .map(|i| (high[i] + low[i] + close[i]) / 3.0)
+            .collect();
+        let start = typicals.len().saturating_sub(self.period);
+        for &typical in &typicals[start..] {
+            self.push_price(typical);
+        }
+        self.ma.update_many(&typicals);
+        self.calculate();
+    }
+
+    pub fn reset(&mut self) {
+        self.ma.reset();
+        self.prices.clear();
+        self.upper = 0.0;
+        self.middle = 0.0;
+        self.lower = 0.0;
+        self.has_inputs = false;
+        self.initialized = false;
+    }
+
+    #[inline]
+    fn push_price(&mut self, price: f64) {
+        if self.prices.len() == self.period {
+            self.prices.pop_front();
+        }
+        self.prices.push_back(price);
+    }
+
+    #[inline]
+    fn calculate(&mut self) {
+        // Initialization logic
+        if !self.initialized {
+            self.has_inputs = true;
+            if self.prices.len() >= self.period {
+                self.initialized = true;
+            }
+        }
+
+        let mean = self.ma.value();
+        let mut std_dev = 0.0;
+        for price in &self.prices {
+            let v = price - mean;
+            std_dev += v * v;
+        }
+        let std = (std_dev / self.prices.len() as f64).sqrt();
+
+        self.upper = mean + (self.k * std);
+        self.middle = mean;
+        self.lower = mean - (self.k * std);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// C API
+////////////////////////////////////////////////////////////////////////////////
+/// BollingerBands is not C FFI safe, so we box and pass it as an opaque pointer.
+#[repr(C)]
+pub struct CBollingerBands(Box<BollingerBands>);
+
+impl Deref for CBollingerBands {
+    type Target = BollingerBands;
+
+    fn deref(&self) -> &Self::Target {
+        &self.0
+    }
+}
+
+impl DerefMut for CBollingerBands {
+    fn deref_mut(&mut self) -> &mut Self::Target {
+        &mut self.0
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn bb_new(period: usize, k: f64, ma_type: MovingAverageType) -> CBollingerBands {
+    CBollingerBands(Box::new(BollingerBands::new(period, k, ma_type)))
+}
+
+#[no_mangle]
+pub extern "C" fn bb_free(bb: CBollingerBands) {
+    drop(bb); // Memory freed here
+}
+
+#[no_mangle]
+pub extern "C" fn bb_update_raw(bb: &mut CBollingerBands, high: f64, low: f64, close: f64) {
+    bb.update_raw(high, low, close);
+}
+
+/// Update the indicator with `len` prices.
+///
+/// # Safety
+/// - `high`, `low` and `close` must each point to `len` contiguous values.
+#[no_mangle]
+pub unsafe extern "C" fn bb_update_many(
+    bb: &mut CBollingerBands,
+    high: *const f64,
+    low: *const f64,
+    close: *const f64,
+    len: usize,
+) {
+    if len > 0 {
+        bb.update_many(
+            std::slice::from_raw_parts(high, len),
+            std::slice::from_raw_parts(low, len),
+            std::slice::from_raw_parts(close, len),
+        );
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn bb_reset(bb: &mut CBollingerBands) {
+    bb.reset();
+}
+
+#[no_mangle]
+pub extern "C" fn bb_upper(bb: &CBollingerBands) -> f64 {
+    bb.upper
+}
+
+#[no_mangle]
+pub extern "C" fn bb_middle(bb: &CBollingerBands) -> f64 {
+    bb.middle
+}
+
+#[no_mangle]
+pub extern "C" fn bb_lower(bb: &CBollingerBands) -> f64 {
+    bb.lower
+}
+
+#[no_mangle]
+pub extern "C" fn bb_initialized(bb: &CBollingerBands) -> u8 {
+    bb.initialized as u8
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use crate::average::MovingAverageType;
+    use crate::bollinger_bands::BollingerBands;
+
+    #[test]
+    fn test_bb_value_with_one_input() {
+        let mut bb = BollingerBands::new(20, 2.0, MovingAverageType::Simple);
+
+        bb.update_raw(1.00020, 1.00000, 1.00010);
+
+        assert_eq!(bb.upper, 1.00010);
+        assert_eq!(bb.middle, 1.00010);
+        assert_eq!(bb.lower, 1.00010);
+    }
+
+    #[test]
+    fn test_bb_value_with_three_inputs() {
+        let mut bb = BollingerBands::new(20, 2.0, MovingAverageType::Simple);
+
+        bb.update_raw(1.00020, 1.00000, 1.00015);
+        bb.update_raw(1.00030, 1.00010, 1.00015);
+        bb.update_raw(1.00040, 1.00020, 1.00021);
+
+        assert_eq!(bb.upper, 1.0003155506390384);
+        assert_eq!(bb.middle, 1.0001900000000001);
+        assert_eq!(bb.lower, 1.0000644493609618);
+    }
+
+    #[test]
+    fn test_bb_update_many_matches_single_updates() {
+        let high: Vec<f64> = (0..60).map(|i| 1.1 + (i as f64 * 0.1).cos()).collect();
+        let low: Vec<f64> = high.iter().map(|h| h - 0.05).collect();
+        let close: Vec<f64> = high.iter().map(|h| h - 0.01).collect();
+        let mut single = BollingerBands::new(20, 2.0, MovingAverageType::Simple);
+        let mut batch = BollingerBands::new(20, 2.0, MovingAverageType::Simple);
+
+        for i in 0..high.len() {
+            single.update_raw(high[i], low[i], close[i]);
+        }
+        batch.update_many(&high[..7], &low[..7], &close[..7]);
+        batch.update_many(&high[7..], &low[7..], &close[7..]);
+
+        assert_eq!(batch.upper, single.upper);
+        assert_eq!(batch.middle, single.middle);
+        assert_eq!(batch.lower, single.lower);
+        assert!(batch.initialized);
+    }
+
+    #[test]
+    fn test_bb_reset() {
+        let mut bb = BollingerBands::new(20, 2.0, MovingAverageType::Simple);
+        bb.update_raw(1.00020, 1.00000, 1.00010);
+
+        bb.reset();
+
+        assert_eq!(bb.upper, 0.0);
+        assert_eq!(bb.middle, 0.0);
+        assert_eq!(bb.lower, 0.0);
+        assert!(!bb.initialized);
+    }
+}
@@ -0,0 +1,222 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use crate::average::{MovingAverage, MovingAverageType};
+use std::ops::{Deref, DerefMut};
+
+const RSI_MAX: f64 = 1.0;
+
+/// An indicator which calculates a relative strength index (RSI) across a
+/// rolling window.
+#[derive(Clone, Debug)]
+pub struct RelativeStrengthIndex {
+    pub period: usize,
+    pub value: f64,
+    pub has_inputs: bool,
+    pub initialized: bool,
+    average_gain: MovingAverage,
+    average_loss: MovingAverage,
+    last_value: f64,
+}
+
+impl RelativeStrengthIndex {
+    pub fn new(period: usize, ma_type: MovingAverageType) -> Self {
+        RelativeStrengthIndex {
+            period,
+            value: 0.0,
+            has_inputs: false,
+            initialized: false,
+            average_gain: MovingAverage::new(period, ma_type),
+            average_loss: MovingAverage::new(period, ma_type),
+            last_value: 0.0,
+        }
+    }
+
+    /// Update the indicator with the given value.
+    #[inline]
+    pub fn update_raw(&mut self, value: f64) {
+        // Check if first input
+        if !self.has_inputs {
+            self.last_value = value;
+            self.has_inputs = true;
+        }
+
+        let gain = value - self.last_value;
+
+        if gain > 0.0 {
+            self.average_gain.update_raw(gain);
+            self.average_loss.update_raw(0.0);
+        } else if gain < 0.0 {
+            self.average_loss.update_raw(-gain);
+            self.average_gain.update_raw(0.0);
+        } else {
+            self.average_gain.update_raw(0.0);
+            self.average_loss.update_raw(0.0);
+        }
+
+        // Initialization logic
+        if !self.initialized && self.average_gain.initialized() && self.average_loss.initialized() {
+            self.initialized = true;
+        }
+
+        if self.average_loss.value() == 0.0 {
+            self.value = RSI_MAX;
+            return;
+        }
+
+        let rs = self.average_gain.value() / self.average_loss.value();
+
+        self.value = RSI_MAX - (RSI_MAX / (1.0 + rs));
+        self.last_value = value;
+    }
+
+    /// Update the indicator with each of the given values in order.
+    ///
+    /// Each value depends on the previous gain and loss averages, so the batch
+    /// is applied sequentially without any per-value dispatch overhead.
+    pub fn update_many(&mut self, values: &[f64]) {
+        for &value in values {
+            self.update_raw(value);
+        }
+    }
+
+    pub fn reset(&mut self) {
+        self.average_gain.reset();
+        self.average_loss.reset();
+        self.last_value = 0.0;
+        self.value = 0.0;
+        self.has_inputs = false;
+        self.initialized = false;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// C API
+////////////////////////////////////////////////////////////////////////////////
+/// RelativeStrengthIndex is not C FFI safe, so we box and pass it as an opaque pointer.
+#[repr(C)]
+pub struct CRelativeStrengthIndex(Box<RelativeStrengthIndex>);
+
+impl Deref for CRelativeStrengthIndex {
+    type Target = RelativeStrengthIndex;
+
+    fn deref(&self) -> &Self::Target {
+        &self.0
+    }
+}
+
+impl DerefMut for CRelativeStrengthIndex {
+    fn deref_mut(&mut self) -> &mut Self::Target {
+        &mut self.0
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn rsi_new(period: usize, ma_type: MovingAverageType) -> CRelativeStrengthIndex {
+    CRelativeStrengthIndex(Box::new(RelativeStrengthIndex::new(period, ma_type)))
+}
+
+#[no_mangle]
+pub extern "C" fn rsi_free(rsi: CRelativeStrengthIndex) {
+    drop(rsi); // Memory freed here
+}
+
+#[no_mangle]
+pub extern "C" fn rsi_update_raw(rsi: &mut CRelativeStrengthIndex, value: f64) -> f64 {
+    rsi.update_raw(value);
+    rsi.value
+}
+
+/// Update the indicator with `len` values and return the latest value.
+///
+/// # Safety
+/// - `values` must point to `len` contiguous values.
+#[no_mangle]
+pub unsafe extern "C" fn rsi_update_many(
+    rsi: &mut CRelativeStrengthIndex,
+    values: *const f64,
+    len: usize,
+) -> f64 {
+    if len > 0 {
+        rsi.update_many(std::slice::from_raw_parts(values, len));
+    }
+    rsi.value
+}
+
+#[no_mangle]
+pub extern "C" fn rsi_reset(rsi: &mut CRelativeStrengthIndex) {
+    rsi.reset();
+}
+
+#[no_mangle]
+pub extern "C" fn rsi_initialized(rsi: &CRelativeStrengthIndex) -> u8 {
+    rsi.initialized as u8
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use crate::average::MovingAverageType;
+    use crate::rsi::RelativeStrengthIndex;
+
+    fn rsi() -> RelativeStrengthIndex {
+        RelativeStrengthIndex::new(10, MovingAverageType::Exponential)
+    }
+
+    #[test]
+    fn test_rsi_initialized_with_required_inputs() {
+        let mut rsi = rsi();
+
+        rsi.update_many(&[1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0]);
+        assert!(!rsi.initialized);
+        rsi.update_raw(10.0);
+
+        assert!(rsi.initialized);
+    }
+
+    #[test]
+    fn test_rsi_value_with_all_lower_inputs() {
+        let mut rsi = rsi();
+
+        rsi.update_many(&[3.0, 2.0, 1.0, 0.5]);
+
+        assert_eq!(rsi.value, 0.0);
+    }
+
+    #[test]
+    fn test_rsi_value_with_various_inputs() {
+        let mut rsi = rsi();
+
+        rsi.update_many(&[3.0, 2.0, 5.0, 6.0, 7.0, 6.0]);
+        assert_eq!(rsi.value, 0.6837363325825265);
+
+        rsi.update_many(&[6.0, 7.0]);
+        assert_eq!(rsi.value, 0.7615344667662725);
+    }
+
+    #[test]
+    fn test_rsi_reset() {
+        let mut rsi = rsi();
+        rsi.update_many(&[1.00020, 1.00030, 1.00050]);
+
+        rsi.reset();
+
+        assert_eq!(rsi.value, 0.0);
+        assert!(!rsi.has_inputs);
+        assert!(!rsi.initialized);
+    }
+}
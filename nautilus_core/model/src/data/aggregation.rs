@@ -0,0 +1,878 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use crate::data::bar::{Bar, BarType};
+use crate::data::tick::{QuoteTick, TradeTick};
+use crate::enums::{BarAggregation, PriceType};
+use crate::types::fixed::FIXED_PRECISION;
+use crate::types::price::Price;
+use crate::types::quantity::Quantity;
+use nautilus_core::string::string_to_pystr;
+use nautilus_core::time::Timestamp;
+use pyo3::ffi;
+use std::collections::VecDeque;
+use std::fmt::{Display, Formatter, Result};
+use std::ops::{Deref, DerefMut};
+
+const FIXED_RAW_SCALAR: u128 = 1_000_000_000; // 10**FIXED_PRECISION
+
+/// Rounds a raw fixed-point size half-up to the given precision.
+#[inline]
+fn round_raw_to_precision(raw: u64, precision: u8) -> u64 {
+    debug_assert!(precision <= FIXED_PRECISION);
+    let increment = 10_u64.pow((FIXED_PRECISION - precision) as u32);
+    ((raw + increment / 2) / increment) * increment
+}
+
+/// Returns `numerator / denominator` rounded half-up.
+#[inline]
+fn div_round(numerator: u128, denominator: u128) -> u128 {
+    (numerator + denominator / 2) / denominator
+}
+
+/// Provides a generic bar builder for aggregation.
+///
+/// All OHLCV arithmetic is performed on the raw fixed-point values.
+pub struct BarBuilder {
+    pub bar_type: BarType,
+    pub price_precision: u8,
+    pub size_precision: u8,
+    pub initialized: bool,
+    pub ts_last: Timestamp,
+    pub count: u64,
+    partial_set: bool,
+    last_close: Option<Price>,
+    open: Option<Price>,
+    high: Option<Price>,
+    low: Option<Price>,
+    close: Option<Price>,
+    volume: Quantity,
+}
+
+impl BarBuilder {
+    pub fn new(bar_type: BarType, price_precision: u8, size_precision: u8) -> Self {
+        BarBuilder {
+            bar_type,
+            price_precision,
+            size_precision,
+            initialized: false,
+            ts_last: 0,
+            count: 0,
+            partial_set: false,
+            last_close: None,
+            open: None,
+            high: None,
+            low: None,
+            close: None,
+            volume: Quantity::from_raw(0, size_precision),
+        }
+    }
+
+    /// Set the initial values for a partially completed bar.
+    ///
+    /// This method can only be called once per instance.
+    pub fn set_partial(&mut self, partial_bar: &Bar) {
+        if self.partial_set {
+            return; // Already updated
+        }
+
+        self.open = Some(partial_bar.open.clone());
+
+        if self.high.is_none() || partial_bar.high > *self.high.as_ref().unwrap() {
+            self.high = Some(partial_bar.high.clone());
+        }
+
+        if self.low.is_none() || partial_bar.low < *self.low.as_ref().unwrap() {
+            self.low = Some(partial_bar.low.clone());
+        }
+
+        if self.close.is_none() {
+            self.close = Some(partial_bar.close.clone());
+        }
+
+        self.volume.raw += partial_bar.volume.raw;
+
+        if self.ts_last == 0 {
+            self.ts_last = partial_bar.ts_init;
+        }
+
+        self.partial_set = true;
+        self.initialized = true;
+    }
+
+    /// Update the bar builder.
+    ///
+    /// Updates with a timestamp prior to the last update are ignored.
+    pub fn update(&mut self, price: Price, size: Quantity, ts_event: Timestamp) {
+        if ts_event < self.ts_last {
+            return; // Not applicable
+        }
+
+        match (&self.high, &self.low) {
+            (Some(high), Some(low)) => {
+                if price > *high {
+                    self.high = Some(price.clone());
+                } else if price < *low {
+                    self.low = Some(price.clone());
+                }
+            }
+            _ => {
+                // Initialize builder
+                self.open = Some(price.clone());
+                self.high = Some(price.clone());
+                self.low = Some(price.clone());
+                self.initialized = true;
+            }
+        }
+
+        self.close = Some(price);
+        self.volume.raw += size.raw;
+        self.count += 1;
+        self.ts_last = ts_event;
+    }
+
+    /// Reset the bar builder.
+    ///
+    /// All stateful fields are reset to their initial value, with the
+    /// open, high and low carried from the last close.
+    pub fn reset(&mut self) {
+        self.open = self.close.clone();
+        self.high = self.close.clone();
+        self.low = self.close.clone();
+
+        self.volume = Quantity::from_raw(0, self.size_precision);
+        self.count = 0;
+    }
+
+    /// Return the aggregated bar and reset.
+    pub fn build_now(&mut self) -> Bar {
+        self.build(self.ts_last)
+    }
+
+    /// Return the aggregated bar with the given closing timestamp, and reset.
+    ///
+    /// # Panics
+    /// - If the builder has not received any update or partial bar.
+    pub fn build(&mut self, ts_event: Timestamp) -> Bar {
+        if self.open.is_none() {
+            // No tick was received
+            self.open = self.last_close.clone();
+            self.high = self.last_close.clone();
+            self.low = self.last_close.clone();
+            self.close = self.last_close.clone();
+        }
+
+        let bar = Bar {
+            bar_type: self.bar_type.clone(),
+            open: self.open.clone().expect("Cannot build bar: no updates"),
+            high: self.high.clone().expect("Cannot build bar: no updates"),
+            low: self.low.clone().expect("Cannot build bar: no updates"),
+            close: self.close.clone().expect("Cannot build bar: no updates"),
+            volume: Quantity::from_raw(
+                round_raw_to_precision(self.volume.raw, self.size_precision),
+                self.size_precision,
+            ),
+            ts_event,
+            ts_init: ts_event,
+        };
+
+        self.last_close = self.close.clone();
+        self.reset();
+        bar
+    }
+}
+
+impl Display for BarBuilder {
+    fn fmt(&self, f: &mut Formatter<'_>) -> Result {
+        let fmt_price = |price: &Option<Price>| match price {
+            Some(price) => price.to_string(),
+            None => String::from("None"),
+        };
+        write!(
+            f,
+            "BarBuilder({},{},{},{},{},{})",
+            self.bar_type,
+            fmt_price(&self.open),
+            fmt_price(&self.high),
+            fmt_price(&self.low),
+            fmt_price(&self.close),
+            self.volume,
+        )
+    }
+}
+
+/// Provides a means of aggregating raw tick values into bars.
+///
+/// Tick, volume and value bars are built as the step threshold of the bar
+/// specification is reached. Time bars are only built on request, as the
+/// build is driven by a clock timer external to the aggregator.
+///
+/// Completed bars are queued until popped by the caller.
+pub struct BarAggregator {
+    pub builder: BarBuilder,
+    step: u64,
+    aggregation: BarAggregation,
+    price_type: PriceType,
+    cum_value: u64,
+    bars: VecDeque<Bar>,
+}
+
+impl BarAggregator {
+    pub fn new(bar_type: BarType, price_precision: u8, size_precision: u8) -> Self {
+        let aggregation = bar_type.spec.aggregation;
+        assert!(
+            matches!(
+                aggregation,
+                BarAggregation::Tick | BarAggregation::Volume | BarAggregation::Value
+            ) || bar_type.spec.is_time_aggregated(),
+            "Unsupported bar aggregation {}",
+            aggregation,
+        );
+
+        BarAggregator {
+            step: bar_type.spec.step,
+            aggregation,
+            price_type: bar_type.spec.price_type,
+            builder: BarBuilder::new(bar_type, price_precision, size_precision),
+            cum_value: 0,
+            bars: VecDeque::new(),
+        }
+    }
+
+    /// Returns the cumulative notional value (raw fixed-point) of a value
+    /// bar aggregator.
+    pub fn cum_value(&self) -> u64 {
+        self.cum_value
+    }
+
+    /// Returns the number of completed bars waiting to be popped.
+    pub fn pending(&self) -> usize {
+        self.bars.len()
+    }
+
+    /// Returns the oldest completed bar (if any).
+    pub fn pop(&mut self) -> Option<Bar> {
+        self.bars.pop_front()
+    }
+
+    pub fn handle_quote_tick(&mut self, tick: &QuoteTick) {
+        self.update(
+            tick.extract_price(self.price_type),
+            tick.extract_volume(self.price_type),
+            tick.ts_event,
+        );
+    }
+
+    pub fn handle_trade_tick(&mut self, tick: &TradeTick) {
+        self.update(tick.price.clone(), tick.size.clone(), tick.ts_event);
+    }
+
+    /// Update the aggregator with a batch of raw tick values.
+    ///
+    /// # Panics
+    /// - If the input slices are not of equal length.
+    pub fn update_batch(
+        &mut self,
+        prices: &[i64],
+        price_prec: u8,
+        sizes: &[u64],
+        size_prec: u8,
+        ts_events: &[Timestamp],
+    ) {
+        assert_eq!(prices.len(), sizes.len());
+        assert_eq!(prices.len(), ts_events.len());
+
+        for i in 0..prices.len() {
+            self.update(
+                Price::from_raw(prices[i], price_prec),
+                Quantity::from_raw(sizes[i], size_prec),
+                ts_events[i],
+            );
+        }
+    }
+
+    /// Update the aggregator with the given values, building any bars for
+    /// which the step threshold has been reached.
+    pub fn update(&mut self, price: Price, size: Quantity, ts_event: Timestamp) {
+        match self.aggregation {
+            BarAggregation::Tick => self.update_tick(price, size, ts_event),
+            BarAggregation::Volume => self.update_volume(price, size, ts_event),
+            BarAggregation::Value => self.update_value(price, size, ts_event),
+            _ => self.builder.update(price, size, ts_event),
+        }
+    }
+
+    /// Build a bar with the given closing timestamp and queue it.
+    pub fn build(&mut self, ts_event: Timestamp) {
+        let bar = self.builder.build(ts_event);
+        self.bars.push_back(bar);
+    }
+
+    /// Build a bar at the builders last update timestamp and queue it.
+    pub fn build_now(&mut self) {
+        let bar = self.builder.build_now();
+        self.bars.push_back(bar);
+    }
+
+    #[inline]
+    fn update_tick(&mut self, price: Price, size: Quantity, ts_event: Timestamp) {
+        self.builder.update(price, size, ts_event);
+
+        if self.builder.count == self.step {
+            self.build_now();
+        }
+    }
+
+    #[inline]
+    fn update_volume(&mut self, price: Price, size: Quantity, ts_event: Timestamp) {
+        let raw_step = self.step * FIXED_RAW_SCALAR as u64;
+        let mut raw_size_update = size.raw;
+
+        while raw_size_update > 0 {
+            // While there is size to apply
+            if self.builder.volume.raw + raw_size_update < raw_step {
+                // Update and break
+                self.builder.update(
+                    price,
+                    Quantity::from_raw(raw_size_update, size.precision),
+                    ts_event,
+                );
+                break;
+            }
+
+            let raw_size_diff = raw_step - self.builder.volume.raw;
+            // Update builder to the step threshold
+            self.builder.update(
+                price.clone(),
+                Quantity::from_raw(raw_size_diff, size.precision),
+                ts_event,
+            );
+
+            // Build a bar and reset builder
+            self.build_now();
+
+            // Decrement the update size
+            raw_size_update -= raw_size_diff;
+        }
+    }
+
+    /// The value of each update is the notional `|price| * size`, so that
+    /// aggregation always progresses for instruments trading at negative prices.
+    ///
+    /// Split sizes are applied at full fixed precision, with the bar volume
+    /// rounded to the size precision on build.
+    #[inline]
+    fn update_value(&mut self, price: Price, size: Quantity, ts_event: Timestamp) {
+        let raw_step = self.step as u128 * FIXED_RAW_SCALAR;
+        let raw_price = price.raw.unsigned_abs() as u128;
+        let mut raw_size_update = size.raw as u128;
+
+        while raw_size_update > 0 {
+            // While there is value to apply
+            let value_update = div_round(raw_price * raw_size_update, FIXED_RAW_SCALAR);
+            if self.cum_value as u128 + value_update < raw_step {
+                // Update and break
+                self.cum_value += value_update as u64;
+                self.builder.update(
+                    price,
+                    Quantity::from_raw(raw_size_update as u64, size.precision),
+                    ts_event,
+                );
+                break;
+            }
+
+            let value_diff = raw_step - self.cum_value as u128;
+            // Always apply some size so the loop is guaranteed to progress
+            let size_diff =
+                div_round(raw_size_update * value_diff, value_update).clamp(1, raw_size_update);
+            // Update builder to the step threshold
+            self.builder.update(
+                price.clone(),
+                Quantity::from_raw(size_diff as u64, size.precision),
+                ts_event,
+            );
+
+            // Build a bar and reset builder and cumulative value
+            self.build_now();
+            self.cum_value = 0;
+
+            // Decrement the update size
+            raw_size_update -= size_diff;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// C API
+////////////////////////////////////////////////////////////////////////////////
+/// BarBuilder is not C FFI safe, so we box and pass it as an opaque pointer.
+#[repr(C)]
+pub struct CBarBuilder(Box<BarBuilder>);
+
+impl Deref for CBarBuilder {
+    type Target = BarBuilder;
+
+    fn deref(&self) -> &Self::Target {
+        &self.0
+    }
+}
+
+impl DerefMut for CBarBuilder {
+    fn deref_mut(&mut self) -> &mut Self::Target {
+        &mut self.0
+    }
+}
+
+/// BarAggregator is not C FFI safe, so we box and pass it as an opaque pointer.
+#[repr(C)]
+pub struct CBarAggregator(Box<BarAggregator>);
+
+impl Deref for CBarAggregator {
+    type Target = BarAggregator;
+
+    fn deref(&self) -> &Self::Target {
+        &self.0
+    }
+}
+
+impl DerefMut for CBarAggregator {
+    fn deref_mut(&mut self) -> &mut Self::Target {
+        &mut self.0
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn bar_builder_new(
+    bar_type: BarType,
+    price_precision: u8,
+    size_precision: u8,
+) -> CBarBuilder {
+    CBarBuilder(Box::new(BarBuilder::new(
+        bar_type,
+        price_precision,
+        size_precision,
+    )))
+}
+
+#[no_mangle]
+pub extern "C" fn bar_builder_free(builder: CBarBuilder) {
+    drop(builder); // Memory freed here
+}
+
+#[no_mangle]
+pub extern "C" fn bar_builder_set_partial(builder: &mut CBarBuilder, partial_bar: &Bar) {
+    builder.set_partial(partial_bar);
+}
+
+#[no_mangle]
+pub extern "C" fn bar_builder_update(
+    builder: &mut CBarBuilder,
+    price: Price,
+    size: Quantity,
+    ts_event: u64,
+) {
+    builder.update(price, size, ts_event);
+}
+
+#[no_mangle]
+pub extern "C" fn bar_builder_reset(builder: &mut CBarBuilder) {
+    builder.reset();
+}
+
+#[no_mangle]
+pub extern "C" fn bar_builder_build(builder: &mut CBarBuilder, ts_event: u64) -> Bar {
+    builder.build(ts_event)
+}
+
+#[no_mangle]
+pub extern "C" fn bar_builder_initialized(builder: &CBarBuilder) -> u8 {
+    builder.initialized as u8
+}
+
+#[no_mangle]
+pub extern "C" fn bar_builder_ts_last(builder: &CBarBuilder) -> u64 {
+    builder.ts_last
+}
+
+#[no_mangle]
+pub extern "C" fn bar_builder_count(builder: &CBarBuilder) -> u64 {
+    builder.count
+}
+
+/// Returns a pointer to a valid Python UTF-8 string.
+///
+/// # Safety
+/// - Assumes that since the data is originating from Rust, the GIL does not need
+/// to be acquired.
+/// - Assumes you are immediately returning this pointer to Python.
+#[no_mangle]
+pub unsafe extern "C" fn bar_builder_to_pystr(builder: &CBarBuilder) -> *mut ffi::PyObject {
+    string_to_pystr(builder.to_string().as_str())
+}
+
+#[no_mangle]
+pub extern "C" fn bar_aggregator_new(
+    bar_type: BarType,
+    price_precision: u8,
+    size_precision: u8,
+) -> CBarAggregator {
+    CBarAggregator(Box::new(BarAggregator::new(
+        bar_type,
+        price_precision,
+        size_precision,
+    )))
+}
+
+#[no_mangle]
+pub extern "C" fn bar_aggregator_free(aggregator: CBarAggregator) {
+    drop(aggregator); // Memory freed here
+}
+
+/// Update the aggregator from the quote tick and return the number of completed
+/// bars pending.
+#[no_mangle]
+pub extern "C" fn bar_aggregator_handle_quote_tick(
+    aggregator: &mut CBarAggregator,
+    tick: &QuoteTick,
+) -> u64 {
+    aggregator.handle_quote_tick(tick);
+    aggregator.pending() as u64
+}
+
+/// Update the aggregator from the trade tick and return the number of completed
+/// bars pending.
+#[no_mangle]
+pub extern "C" fn bar_aggregator_handle_trade_tick(
+    aggregator: &mut CBarAggregator,
+    tick: &TradeTick,
+) -> u64 {
+    aggregator.handle_trade_tick(tick);
+    aggregator.pending() as u64
+}
+
+/// Update the aggregator from `len` raw tick values and return the number of
+/// completed bars pending.
+///
+/// # Safety
+/// - `prices`, `sizes` and `ts_events` must each point to `len` contiguous values.
+#[no_mangle]
+pub unsafe extern "C" fn bar_aggregator_update_batch(
+    aggregator: &mut CBarAggregator,
+    prices: *const i64,
+    price_prec: u8,
+    sizes: *const u64,
+    size_prec: u8,
+    ts_events: *const u64,
+    len: usize,
+) -> u64 {
+    if len > 0 {
+        aggregator.update_batch(
+            std::slice::from_raw_parts(prices, len),
+            price_prec,
+            std::slice::from_raw_parts(sizes, len),
+            size_prec,
+            std::slice::from_raw_parts(ts_events, len),
+        );
+    }
+    aggregator.pending() as u64
+}
+
+#[no_mangle]
+pub extern "C" fn bar_aggregator_set_partial(aggregator: &mut CBarAggregator, partial_bar: &Bar) {
+    aggregator.builder.set_partial(partial_bar);
+}
+
+/// Build a bar with the given closing timestamp and return the number of
+/// completed bars pending.
+#[no_mangle]
+pub extern "C" fn bar_aggregator_build(aggregator: &mut CBarAggregator, ts_event: u64) -> u64 {
+    aggregator.build(ts_event);
+    aggregator.pending() as u64
+}
+
+#[no_mangle]
+pub extern "C" fn bar_aggregator_pending(aggregator: &CBarAggregator) -> u64 {
+    aggregator.pending() as u64
+}
+
+/// Pops the oldest completed bar.
+///
+/// # Panics
+/// - If there are no completed bars pending.
+#[no_mangle]
+pub extern "C" fn bar_aggregator_pop(aggregator: &mut CBarAggregator) -> Bar {
+    aggregator.pop().expect("No bars pending")
+}
+
+#[no_mangle]
+pub extern "C" fn bar_aggregator_initialized(aggregator: &CBarAggregator) -> u8 {
+    aggregator.builder.initialized as u8
+}
+
+#[no_mangle]
+pub extern "C" fn bar_aggregator_cum_value(aggregator: &CBarAggregator) -> u64 {
+    aggregator.cum_value()
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use crate::data::aggregation::{BarAggregator, BarBuilder};
+    use crate::data::bar::{Bar, BarSpecification, BarType};
+    use crate::data::tick::{QuoteTick, TradeTick};
+    use crate::enums::{AggregationSource, BarAggregation, OrderSide, PriceType};
+    use crate::identifiers::instrument_id::InstrumentId;
+    use crate::identifiers::trade_id::TradeId;
+    use crate::types::price::Price;
+    use crate::types::quantity::Quantity;
+
+    fn bar_type(step: u64, aggregation: BarAggregation, price_type: PriceType) -> BarType {
+        BarType {
+            instrument_id: InstrumentId::from("AUD/USD.SIM"),
+            spec: BarSpecification {
+                step,
+                aggregation,
+                price_type,
+            },
+            aggregation_source: AggregationSource::Internal,
+        }
+    }
+
+    fn quote_tick(bid: &str, ask: &str, bid_size: &str, ask_size: &str) -> QuoteTick {
+        QuoteTick {
+            instrument_id: InstrumentId::from("AUD/USD.SIM"),
+            bid: Price::from(bid),
+            ask: Price::from(ask),
+            bid_size: Quantity::from(bid_size),
+            ask_size: Quantity::from(ask_size),
+            ts_event: 0,
+            ts_init: 0,
+        }
+    }
+
+    fn trade_tick(price: &str, size: &str) -> TradeTick {
+        TradeTick {
+            instrument_id: InstrumentId::from("AUD/USD.SIM"),
+            price: Price::from(price),
+            size: Quantity::from(size),
+            aggressor_side: OrderSide::Buy,
+            trade_id: TradeId::from("123456"),
+            ts_event: 0,
+            ts_init: 0,
+        }
+    }
+
+    #[test]
+    fn test_builder_to_string() {
+        let builder = BarBuilder::new(bar_type(100, BarAggregation::Tick, PriceType::Last), 5, 6);
+
+        assert_eq!(
+            builder.to_string(),
+            "BarBuilder(AUD/USD.SIM-100-TICK-LAST-INTERNAL,None,None,None,None,0.000000)"
+        );
+    }
+
+    #[test]
+    fn test_builder_set_partial() {
+        let bar_type = bar_type(100, BarAggregation::Tick, PriceType::Last);
+        let mut builder = BarBuilder::new(bar_type.clone(), 5, 0);
+        let partial_bar = Bar {
+            bar_type,
+            open: Price::from("1.00001"),
+            high: Price::from("1.00010"),
+            low: Price::from("1.00000"),
+            close: Price::from("1.00002"),
+            volume: Quantity::from("1"),
+            ts_event: 1_000_000_000,
+            ts_init: 1_000_000_000,
+        };
+
+        builder.set_partial(&partial_bar);
+        let bar = builder.build_now();
+
+        assert_eq!(bar.open, Price::from("1.00001"));
+        assert_eq!(bar.high, Price::from("1.00010"));
+        assert_eq!(bar.low, Price::from("1.00000"));
+        assert_eq!(bar.close, Price::from("1.00002"));
+        assert_eq!(bar.volume, Quantity::from("1"));
+        assert_eq!(bar.ts_init, 1_000_000_000);
+        assert_eq!(builder.ts_last, 1_000_000_000);
+    }
+
+    #[test]
+    fn test_builder_update_when_timestamp_less_than_last_update_ignores() {
+        let mut builder =
+            BarBuilder::new(bar_type(100, BarAggregation::Tick, PriceType::Last), 5, 0);
+
+        builder.update(Price::from("1.00000"), Quantity::from("1"), 1_000);
+        builder.update(Price::from("1.00001"), Quantity::from("1"), 500);
+
+        assert!(builder.initialized);
+        assert_eq!(builder.ts_last, 1_000);
+        assert_eq!(builder.count, 1);
+    }
+
+    #[test]
+    fn test_builder_build_with_previous_close() {
+        let mut builder =
+            BarBuilder::new(bar_type(100, BarAggregation::Tick, PriceType::Last), 5, 1);
+
+        builder.update(Price::from("1.00001"), Quantity::from("1.0"), 0);
+        builder.build_now(); // This close should become the next open
+
+        builder.update(Price::from("1.00000"), Quantity::from("1.0"), 0);
+        builder.update(Price::from("1.00003"), Quantity::from("1.0"), 0);
+        builder.update(Price::from("1.00002"), Quantity::from("1.0"), 0);
+
+        let bar = builder.build_now();
+
+        assert_eq!(bar.open, Price::from("1.00001"));
+        assert_eq!(bar.high, Price::from("1.00003"));
+        assert_eq!(bar.low, Price::from("1.00000"));
+        assert_eq!(bar.close, Price::from("1.00002"));
+        assert_eq!(bar.volume, Quantity::from("3.0"));
+        assert_eq!(builder.count, 0);
+    }
+
+    #[test]
+    fn test_tick_aggregator_builds_bar_at_step() {
+        let mut aggregator =
+            BarAggregator::new(bar_type(3, BarAggregation::Tick, PriceType::Mid), 5, 0);
+
+        aggregator.handle_quote_tick(&quote_tick("1.00001", "1.00004", "1", "1"));
+        aggregator.handle_quote_tick(&quote_tick("1.00002", "1.00005", "1", "1"));
+        assert_eq!(aggregator.pending(), 0);
+        aggregator.handle_quote_tick(&quote_tick("1.00000", "1.00003", "1", "1"));
+
+        assert_eq!(aggregator.pending(), 1);
+        let bar = aggregator.pop().unwrap();
+        assert_eq!(bar.open, Price::from("1.000025"));
+        assert_eq!(bar.high, Price::from("1.000035"));
+        assert_eq!(bar.low, Price::from("1.000015"));
+        assert_eq!(bar.close, Price::from("1.000015"));
+        assert_eq!(bar.volume, Quantity::from("3"));
+        assert!(aggregator.pop().is_none());
+    }
+
+    #[test]
+    fn test_volume_aggregator_splits_update_across_bars() {
+        let mut aggregator = BarAggregator::new(
+            bar_type(10000, BarAggregation::Volume, PriceType::Bid),
+            5,
+            0,
+        );
+
+        aggregator.handle_quote_tick(&quote_tick("1.00001", "1.00004", "2000", "2000"));
+        aggregator.handle_quote_tick(&quote_tick("1.00002", "1.00005", "3000", "3000"));
+        aggregator.handle_quote_tick(&quote_tick("1.00000", "1.00003", "25000", "25000"));
+
+        assert_eq!(aggregator.pending(), 3);
+        let bar1 = aggregator.pop().unwrap();
+        assert_eq!(bar1.open, Price::from("1.00001"));
+        assert_eq!(bar1.high, Price::from("1.00002"));
+        assert_eq!(bar1.low, Price::from("1.00000"));
+        assert_eq!(bar1.volume, Quantity::from("10000"));
+        assert_eq!(aggregator.pop().unwrap().volume, Quantity::from("10000"));
+        assert_eq!(aggregator.pop().unwrap().volume, Quantity::from("10000"));
+        assert_eq!(aggregator.builder.count, 0);
+    }
+
+    #[test]
+    fn test_value_aggregator_below_threshold_accumulates() {
+        let mut aggregator = BarAggregator::new(
+            bar_type(100000, BarAggregation::Value, PriceType::Bid),
+            5,
+            0,
+        );
+
+        aggregator.handle_quote_tick(&quote_tick("1.00001", "1.00004", "3000", "2000"));
+
+        assert_eq!(aggregator.pending(), 0);
+        assert_eq!(aggregator.cum_value(), 3000_030000000);
+    }
+
+    #[test]
+    fn test_value_aggregator_beyond_threshold_builds_bars() {
+        let mut aggregator = BarAggregator::new(
+            bar_type(100000, BarAggregation::Value, PriceType::Last),
+            5,
+            2,
+        );
+
+        aggregator.handle_trade_tick(&trade_tick("20.00001", "3000.00"));
+        aggregator.handle_trade_tick(&trade_tick("20.00002", "4000.00"));
+        aggregator.handle_trade_tick(&trade_tick("20.00000", "5000.00"));
+
+        assert_eq!(aggregator.pending(), 2);
+        let bar1 = aggregator.pop().unwrap();
+        assert_eq!(bar1.open, Price::from("20.00001"));
+        assert_eq!(bar1.high, Price::from("20.00002"));
+        assert_eq!(bar1.close, Price::from("20.00002"));
+        assert_eq!(bar1.volume, Quantity::from("5000.00"));
+        let bar2 = aggregator.pop().unwrap();
+        assert_eq!(bar2.open, Price::from("20.00002"));
+        assert_eq!(bar2.low, Price::from("20.00000"));
+        assert_eq!(bar2.volume, Quantity::from("5000.00"));
+        assert_eq!(aggregator.cum_value(), 40000_110000000);
+    }
+
+    #[test]
+    fn test_update_batch_matches_single_updates() {
+        let bar_type = bar_type(2, BarAggregation::Tick, PriceType::Last);
+        let mut single = BarAggregator::new(bar_type.clone(), 2, 0);
+        let mut batch = BarAggregator::new(bar_type, 2, 0);
+        let prices = [
+            100_000_000_000,
+            101_000_000_000,
+            99_000_000_000,
+            98_000_000_000,
+        ];
+        let sizes = [1_000_000_000, 2_000_000_000, 3_000_000_000, 4_000_000_000];
+        let ts_events = [1, 2, 3, 4];
+
+        for i in 0..prices.len() {
+            single.update(
+                Price::from_raw(prices[i], 2),
+                Quantity::from_raw(sizes[i], 0),
+                ts_events[i],
+            );
+        }
+        batch.update_batch(&prices, 2, &sizes, 0, &ts_events);
+
+        assert_eq!(batch.pending(), 2);
+        while let Some(bar) = batch.pop() {
+            assert_eq!(Some(bar), single.pop());
+        }
+    }
+
+    #[test]
+    fn test_time_aggregator_builds_on_request() {
+        let mut aggregator =
+            BarAggregator::new(bar_type(1, BarAggregation::Minute, PriceType::Last), 5, 0);
+
+        aggregator.handle_trade_tick(&trade_tick("1.00001", "1"));
+        aggregator.handle_trade_tick(&trade_tick("1.00002", "1"));
+        assert_eq!(aggregator.pending(), 0);
+
+        aggregator.build(60_000_000_000);
+
+        let bar = aggregator.pop().unwrap();
+        assert_eq!(bar.close, Price::from("1.00002"));
+        assert_eq!(bar.volume, Quantity::from("2"));
+        assert_eq!(bar.ts_event, 60_000_000_000);
+    }
+}
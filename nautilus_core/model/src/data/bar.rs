@@ -0,0 +1,226 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use crate::enums::{AggregationSource, BarAggregation, PriceType};
+use crate::identifiers::instrument_id::InstrumentId;
+use crate::types::price::Price;
+use crate::types::quantity::Quantity;
+use nautilus_core::string::string_to_pystr;
+use nautilus_core::time::Timestamp;
+use pyo3::ffi;
+use std::fmt::{Debug, Display, Formatter, Result};
+
+/// Represents a bar aggregation specification including a step, aggregation
+/// method/rule and price type.
+#[repr(C)]
+#[derive(Clone, Hash, PartialEq, Debug)]
+pub struct BarSpecification {
+    pub step: u64,
+    pub aggregation: BarAggregation,
+    pub price_type: PriceType,
+}
+
+impl BarSpecification {
+    pub fn is_time_aggregated(&self) -> bool {
+        matches!(
+            self.aggregation,
+            BarAggregation::Millisecond
+                | BarAggregation::Second
+                | BarAggregation::Minute
+                | BarAggregation::Hour
+                | BarAggregation::Day
+                | BarAggregation::Week
+                | BarAggregation::Month
+        )
+    }
+}
+
+impl Display for BarSpecification {
+    fn fmt(&self, f: &mut Formatter<'_>) -> Result {
+        write!(f, "{}-{}-{}", self.step, self.aggregation, self.price_type)
+    }
+}
+
+/// Represents a bar type including the instrument ID, bar specification and
+/// aggregation source.
+#[repr(C)]
+#[derive(Clone, Hash, PartialEq, Debug)]
+pub struct BarType {
+    pub instrument_id: InstrumentId,
+    pub spec: BarSpecification,
+    pub aggregation_source: AggregationSource,
+}
+
+impl Display for BarType {
+    fn fmt(&self, f: &mut Formatter<'_>) -> Result {
+        write!(
+            f,
+            "{}-{}-{}",
+            self.instrument_id, self.spec, self.aggregation_source
+        )
+    }
+}
+
+/// Represents an aggregated bar.
+#[repr(C)]
+#[derive(Clone, Hash, PartialEq, Debug)]
+pub struct Bar {
+    pub bar_type: BarType,
+    pub open: Price,
+    pub high: Price,
+    pub low: Price,
+    pub close: Price,
+    pub volume: Quantity,
+    pub ts_event: Timestamp,
+    pub ts_init: Timestamp,
+}
+
+impl Display for Bar {
+    fn fmt(&self, f: &mut Formatter<'_>) -> Result {
+        write!(
+            f,
+            "{},{},{},{},{},{},{}",
+            self.bar_type, self.open, self.high, self.low, self.close, self.volume, self.ts_event
+        )
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// C API
+////////////////////////////////////////////////////////////////////////////////
+#[no_mangle]
+pub extern "C" fn bar_type_new(
+    instrument_id: InstrumentId,
+    step: u64,
+    aggregation: BarAggregation,
+    price_type: PriceType,
+    aggregation_source: AggregationSource,
+) -> BarType {
+    BarType {
+        instrument_id,
+        spec: BarSpecification {
+            step,
+            aggregation,
+            price_type,
+        },
+        aggregation_source,
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn bar_type_free(bar_type: BarType) {
+    drop(bar_type); // Memory freed here
+}
+
+#[no_mangle]
+pub extern "C" fn bar_free(bar: Bar) {
+    drop(bar); // Memory freed here
+}
+
+#[no_mangle]
+#[allow(clippy::too_many_arguments)]
+pub extern "C" fn bar_from_raw(
+    bar_type: BarType,
+    open: i64,
+    high: i64,
+    low: i64,
+    close: i64,
+    price_prec: u8,
+    volume: u64,
+    size_prec: u8,
+    ts_event: u64,
+    ts_init: u64,
+) -> Bar {
+    Bar {
+        bar_type,
+        open: Price::from_raw(open, price_prec),
+        high: Price::from_raw(high, price_prec),
+        low: Price::from_raw(low, price_prec),
+        close: Price::from_raw(close, price_prec),
+        volume: Quantity::from_raw(volume, size_prec),
+        ts_event,
+        ts_init,
+    }
+}
+
+/// Returns a pointer to a valid Python UTF-8 string.
+///
+/// # Safety
+/// - Assumes that since the data is originating from Rust, the GIL does not need
+/// to be acquired.
+/// - Assumes you are immediately returning this pointer to Python.
+#[no_mangle]
+pub unsafe extern "C" fn bar_to_pystr(bar: &Bar) -> *mut ffi::PyObject {
+    string_to_pystr(bar.to_string().as_str())
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use crate::data::bar::{Bar, BarSpecification, BarType};
+    use crate::enums::{AggregationSource, BarAggregation, PriceType};
+    use crate::identifiers::instrument_id::InstrumentId;
+    use crate::types::price::Price;
+    use crate::types::quantity::Quantity;
+
+    #[test]
+    fn test_bar_type_to_string() {
+        let bar_type = BarType {
+            instrument_id: InstrumentId::from("BTCUSDT.BINANCE"),
+            spec: BarSpecification {
+                step: 100,
+                aggregation: BarAggregation::Tick,
+                price_type: PriceType::Last,
+            },
+            aggregation_source: AggregationSource::External,
+        };
+
+        assert!(!bar_type.spec.is_time_aggregated());
+        assert_eq!(
+            bar_type.to_string(),
+            "BTCUSDT.BINANCE-100-TICK-LAST-EXTERNAL"
+        );
+    }
+
+    #[test]
+    fn test_bar_to_string() {
+        let bar = Bar {
+            bar_type: BarType {
+                instrument_id: InstrumentId::from("AUD/USD.SIM"),
+                spec: BarSpecification {
+                    step: 1,
+                    aggregation: BarAggregation::Minute,
+                    price_type: PriceType::Bid,
+                },
+                aggregation_source: AggregationSource::Internal,
+            },
+            open: Price::new(1.00001, 5),
+            high: Price::new(1.00010, 5),
+            low: Price::new(1.00000, 5),
+            close: Price::new(1.00002, 5),
+            volume: Quantity::new(100000.0, 0),
+            ts_event: 0,
+            ts_init: 0,
+        };
+
+        assert!(bar.bar_type.spec.is_time_aggregated());
+        assert_eq!(
+            bar.to_string(),
+            "AUD/USD.SIM-1-MINUTE-BID-INTERNAL,1.00001,1.00010,1.00000,1.00002,100000,0"
+        );
+    }
+}
@@ -13,7 +13,7 @@
 //  limitations under the License.
 // -------------------------------------------------------------------------------------------------
 
-use crate::enums::OrderSide;
+use crate::enums::{OrderSide, PriceType};
 use crate::identifiers::instrument_id::InstrumentId;
 use crate::identifiers::trade_id::TradeId;
 use crate::types::price::Price;
@@ -36,6 +36,36 @@ pub struct QuoteTick {
     pub ts_init: Timestamp,
 }
 
+impl QuoteTick {
+    /// Returns the price for the given price type.
+    ///
+    /// A `Mid` price carries one extra decimal of precision, as the average of
+    /// the bid and ask may fall between their ticks.
+    pub fn extract_price(&self, price_type: PriceType) -> Price {
+        match price_type {
+            PriceType::Bid => self.bid.clone(),
+            PriceType::Ask => self.ask.clone(),
+            PriceType::Mid => {
+                Price::from_raw((self.bid.raw + self.ask.raw) / 2, self.bid.precision + 1)
+            }
+            _ => panic!("Cannot extract with price type {}", price_type),
+        }
+    }
+
+    /// Returns the volume for the given price type.
+    pub fn extract_volume(&self, price_type: PriceType) -> Quantity {
+        match price_type {
+            PriceType::Bid => self.bid_size.clone(),
+            PriceType::Ask => self.ask_size.clone(),
+            PriceType::Mid => Quantity::from_raw(
+                (self.bid_size.raw + self.ask_size.raw) / 2,
+                self.bid_size.precision + 1,
+            ),
+            _ => panic!("Cannot extract with price type {}", price_type),
+        }
+    }
+}
+
 impl Display for QuoteTick {
     fn fmt(&self, f: &mut Formatter<'_>) -> Result {
         write!(
@@ -182,7 +212,7 @@ pub unsafe extern "C" fn trade_tick_to_pystr(tick: &TradeTick) -> *mut ffi::PyOb
 #[cfg(test)]
 mod tests {
     use crate::data::tick::{QuoteTick, TradeTick};
-    use crate::enums::OrderSide;
+    use crate::enums::{OrderSide, PriceType};
     use crate::identifiers::instrument_id::InstrumentId;
     use crate::identifiers::trade_id::TradeId;
     use crate::types::price::Price;
@@ -206,6 +236,24 @@ mod tests {
         );
     }
 
+    #[test]
+    fn test_quote_tick_extract_price() {
+        let tick = QuoteTick {
+            instrument_id: InstrumentId::from("ETH-PERP.FTX"),
+            bid: Price::new(10000.0, 4),
+            ask: Price::new(10001.0, 4),
+            bid_size: Quantity::new(1.0, 8),
+            ask_size: Quantity::new(2.0, 8),
+            ts_event: 0,
+            ts_init: 0,
+        };
+
+        assert_eq!(tick.extract_price(PriceType::Bid), Price::new(10000.0, 4));
+        assert_eq!(tick.extract_price(PriceType::Ask), Price::new(10001.0, 4));
+        assert_eq!(tick.extract_price(PriceType::Mid), Price::new(10000.5, 5));
+        assert_eq!(tick.extract_volume(PriceType::Mid), Quantity::new(1.5, 9));
+    }
+
     #[test]
     fn test_trade_tick_to_string() {
         let tick = TradeTick {
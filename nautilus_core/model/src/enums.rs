@@ -84,6 +84,23 @@ pub enum PriceType {
     Last = 4,
 }
 
+impl PriceType {
+    pub fn as_str(&self) -> &'static str {
+        match self {
+            PriceType::Bid => "BID",
+            PriceType::Ask => "ASK",
+            PriceType::Mid => "MID",
+            PriceType::Last => "LAST",
+        }
+    }
+}
+
+impl Display for PriceType {
+    fn fmt(&self, f: &mut Formatter<'_>) -> Result {
+        write!(f, "{}", self.as_str())
+    }
+}
+
 #[repr(C)]
 #[derive(Copy, Clone, Debug, Hash, PartialEq, Eq)]
 #[allow(non_camel_case_types)]
@@ -110,3 +127,77 @@ pub enum DepthType {
     Volume = 1,
     Exposure = 2,
 }
+
+#[repr(C)]
+#[derive(Copy, Clone, Debug, Hash, PartialEq, Eq)]
+#[allow(non_camel_case_types)]
+pub enum BarAggregation {
+    Tick = 1,
+    TickImbalance = 2,
+    TickRuns = 3,
+    Volume = 4,
+    VolumeImbalance = 5,
+    VolumeRuns = 6,
+    Value = 7,
+    ValueImbalance = 8,
+    ValueRuns = 9,
+    Millisecond = 10,
+    Second = 11,
+    Minute = 12,
+    Hour = 13,
+    Day = 14,
+    Week = 15,
+    Month = 16,
+}
+
+impl BarAggregation {
+    pub fn as_str(&self) -> &'static str {
+        match self {
+            BarAggregation::Tick => "TICK",
+            BarAggregation::TickImbalance => "TICK_IMBALANCE",
+            BarAggregation::TickRuns => "TICK_RUNS",
+            BarAggregation::Volume => "VOLUME",
+            BarAggregation::VolumeImbalance => "VOLUME_IMBALANCE",
+            BarAggregation::VolumeRuns => "VOLUME_RUNS",
+            BarAggregation::Value => "VALUE",
+            BarAggregation::ValueImbalance => "VALUE_IMBALANCE",
+            BarAggregation::ValueRuns => "VALUE_RUNS",
+            BarAggregation::Millisecond => "MILLISECOND",
+            BarAggregation::Second => "SECOND",
+            BarAggregation::Minute => "MINUTE",
+            BarAggregation::Hour => "HOUR",
+            BarAggregation::Day => "DAY",
+            BarAggregation::Week => "WEEK",
+            BarAggregation::Month => "MONTH",
+        }
+    }
+}
+
+impl Display for BarAggregation {
+    fn fmt(&self, f: &mut Formatter<'_>) -> Result {
+        write!(f, "{}", self.as_str())
+    }
+}
+
+#[repr(C)]
+#[derive(Copy, Clone, Debug, Hash, PartialEq, Eq)]
+#[allow(non_camel_case_types)]
+pub enum AggregationSource {
+    External = 1,
+    Internal = 2,
+}
+
+impl AggregationSource {
+    pub fn as_str(&self) -> &'static str {
+        match self {
+            AggregationSource::External => "EXTERNAL",
+            AggregationSource::Internal => "INTERNAL",
+        }
+    }
+}
+
+impl Display for AggregationSource {
+    fn fmt(&self, f: &mut Formatter<'_>) -> Result {
+        write!(f, "{}", self.as_str())
+    }
+}
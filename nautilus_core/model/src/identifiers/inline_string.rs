@@ -0,0 +1,148 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use std::fmt::{Debug, Display, Formatter, Result};
+use std::hash::{Hash, Hasher};
+
+/// The number of bytes which can be held without a heap allocation.
+pub const INLINE_CAPACITY: usize = 36;
+
+/// Represents an immutable string which is stored inline when it fits within
+/// 36 bytes (a hyphenated UUID), otherwise it spills onto the heap.
+///
+/// Most venue assigned identifiers fit inline, so passing them by value across
+/// the C ABI avoids a heap allocation per identifier.
+#[repr(C)]
+#[derive(Clone)]
+#[allow(clippy::box_collection)] // C ABI compatibility
+pub struct InlineString {
+    len: u8,
+    buf: [u8; INLINE_CAPACITY],
+    spill: Option<Box<String>>,
+}
+
+impl InlineString {
+    pub fn new(s: &str) -> Self {
+        let mut buf = [0; INLINE_CAPACITY];
+        if s.len() > INLINE_CAPACITY {
+            return InlineString {
+                len: 0,
+                buf,
+                spill: Some(Box::new(s.to_string())),
+            };
+        }
+
+        buf[..s.len()].copy_from_slice(s.as_bytes());
+        InlineString {
+            len: s.len() as u8,
+            buf,
+            spill: None,
+        }
+    }
+
+    #[inline]
+    pub fn as_str(&self) -> &str {
+        match &self.spill {
+            Some(s) => s.as_str(),
+            // SAFETY: The inline bytes were copied from a valid `str`
+            None => unsafe { std::str::from_utf8_unchecked(&self.buf[..self.len as usize]) },
+        }
+    }
+
+    /// Returns whether the value is held without a heap allocation.
+    #[inline]
+    pub fn is_inline(&self) -> bool {
+        self.spill.is_none()
+    }
+}
+
+impl PartialEq for InlineString {
+    fn eq(&self, other: &Self) -> bool {
+        self.as_str() == other.as_str()
+    }
+}
+
+impl Eq for InlineString {}
+
+impl Hash for InlineString {
+    fn hash<H: Hasher>(&self, state: &mut H) {
+        self.as_str().hash(state);
+    }
+}
+
+impl Debug for InlineString {
+    fn fmt(&self, f: &mut Formatter<'_>) -> Result {
+        write!(f, "{:?}", self.as_str())
+    }
+}
+
+impl Display for InlineString {
+    fn fmt(&self, f: &mut Formatter<'_>) -> Result {
+        write!(f, "{}", self.as_str())
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use super::InlineString;
+
+    #[test]
+    fn test_short_value_is_inline() {
+        let s = InlineString::new("123456789");
+
+        assert!(s.is_inline());
+        assert_eq!(s.as_str(), "123456789");
+    }
+
+    #[test]
+    fn test_uuid_value_is_inline() {
+        let s = InlineString::new("2d89666b-1a1e-4a75-b193-4eb3b454c757");
+
+        assert!(s.is_inline());
+        assert_eq!(s.as_str(), "2d89666b-1a1e-4a75-b193-4eb3b454c757");
+    }
+
+    #[test]
+    fn test_long_value_spills_to_heap() {
+        let value = "O-20220616-120000-001-001-1-BINANCE-SPOT";
+        let s = InlineString::new(value);
+
+        assert!(!s.is_inline());
+        assert_eq!(s.as_str(), value);
+        assert_eq!(s.clone(), s);
+    }
+
+    #[test]
+    fn test_empty_value() {
+        let s = InlineString::new("");
+
+        assert!(s.is_inline());
+        assert_eq!(s.as_str(), "");
+    }
+
+    #[test]
+    fn test_equality_and_display() {
+        let s1 = InlineString::new("ABC");
+        let s2 = InlineString::new("ABD");
+
+        assert_eq!(s1, s1.clone());
+        assert_ne!(s1, s2);
+        assert_eq!(s1.to_string(), "ABC");
+        assert_eq!(format!("{s1:?}"), "\"ABC\"");
+    }
+}
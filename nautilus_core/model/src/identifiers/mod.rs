@@ -17,6 +17,7 @@ pub mod account_id;
 pub mod client_id;
 pub mod client_order_id;
 pub mod component_id;
+pub mod inline_string;
 pub mod instrument_id;
 pub mod order_list_id;
 pub mod position_id;
@@ -13,7 +13,8 @@
 //  limitations under the License.
 // -------------------------------------------------------------------------------------------------
 
-use nautilus_core::string::{pystr_to_string, string_to_pystr};
+use crate::identifiers::inline_string::InlineString;
+use nautilus_core::string::{pystr_to_str, string_to_pystr};
 use pyo3::ffi;
 use std::collections::hash_map::DefaultHasher;
 use std::fmt::{Debug, Display, Formatter, Result};
@@ -21,15 +22,14 @@ use std::hash::{Hash, Hasher};
 
 #[repr(C)]
 #[derive(Clone, Hash, PartialEq, Debug)]
-#[allow(clippy::box_collection)] // C ABI compatibility
 pub struct TradeId {
-    value: Box<String>,
+    value: InlineString,
 }
 
 impl From<&str> for TradeId {
     fn from(s: &str) -> TradeId {
         TradeId {
-            value: Box::new(s.to_string()),
+            value: InlineString::new(s),
         }
     }
 }
@@ -55,7 +55,7 @@ pub extern "C" fn trade_id_free(trade_id: TradeId) {
 #[no_mangle]
 pub unsafe extern "C" fn trade_id_from_pystr(ptr: *mut ffi::PyObject) -> TradeId {
     TradeId {
-        value: Box::new(pystr_to_string(ptr)),
+        value: InlineString::new(pystr_to_str(ptr)),
     }
 }
 
@@ -107,6 +107,14 @@ mod tests {
         assert_eq!(format!("{trade_id}"), "1234567890");
     }
 
+    #[test]
+    fn test_uuid_trade_id_is_held_inline() {
+        let trade_id = TradeId::from("2d89666b-1a1e-4a75-b193-4eb3b454c757");
+
+        assert!(trade_id.value.is_inline());
+        assert_eq!(trade_id.to_string(), "2d89666b-1a1e-4a75-b193-4eb3b454c757");
+    }
+
     #[test]
     fn test_trade_id_free() {
         let id = TradeId::from("123456789");
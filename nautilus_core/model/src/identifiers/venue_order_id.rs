@@ -13,7 +13,8 @@
 //  limitations under the License.
 // -------------------------------------------------------------------------------------------------
 
-use nautilus_core::string::{pystr_to_string, string_to_pystr};
+use crate::identifiers::inline_string::InlineString;
+use nautilus_core::string::{pystr_to_str, string_to_pystr};
 use pyo3::ffi;
 use std::collections::hash_map::DefaultHasher;
 use std::fmt::{Debug, Display, Formatter, Result};
@@ -21,15 +22,14 @@ use std::hash::{Hash, Hasher};
 
 #[repr(C)]
 #[derive(Clone, Hash, PartialEq, Debug)]
-#[allow(clippy::box_collection)] // C ABI compatibility
 pub struct VenueOrderId {
-    value: Box<String>,
+    value: InlineString,
 }
 
 impl From<&str> for VenueOrderId {
     fn from(s: &str) -> VenueOrderId {
         VenueOrderId {
-            value: Box::new(s.to_string()),
+            value: InlineString::new(s),
         }
     }
 }
@@ -55,7 +55,7 @@ pub extern "C" fn venue_order_id_free(venue_order_id: VenueOrderId) {
 #[no_mangle]
 pub unsafe extern "C" fn venue_order_id_from_pystr(ptr: *mut ffi::PyObject) -> VenueOrderId {
     VenueOrderId {
-        value: Box::new(pystr_to_string(ptr)),
+        value: InlineString::new(pystr_to_str(ptr)),
     }
 }
 
@@ -0,0 +1,282 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use crate::types::fixed::{f64_to_fixed_i64, f64_to_fixed_u64, FIXED_SCALAR};
+
+/// Represents the specification of an instrument needed to quantize prices and
+/// sizes, with all values held as raw fixed-point integers.
+#[repr(C)]
+#[derive(Copy, Clone, Debug, PartialEq, Eq)]
+pub struct InstrumentSpec {
+    pub price_precision: u8,
+    pub size_precision: u8,
+    pub price_increment: i64,
+    pub size_increment: u64,
+    pub multiplier: u64,
+    pub min_quantity: u64,
+    pub max_quantity: u64,
+    pub min_price: i64,
+    pub max_price: i64,
+}
+
+impl InstrumentSpec {
+    /// Creates a new specification where the min and max limits are unbounded.
+    pub fn new(
+        price_precision: u8,
+        size_precision: u8,
+        price_increment: i64,
+        size_increment: u64,
+        multiplier: u64,
+    ) -> Self {
+        assert!(price_increment > 0, "`price_increment` was not positive");
+        assert!(size_increment > 0, "`size_increment` was not positive");
+        InstrumentSpec {
+            price_precision,
+            size_precision,
+            price_increment,
+            size_increment,
+            multiplier,
+            min_quantity: 0,
+            max_quantity: u64::MAX,
+            min_price: i64::MIN,
+            max_price: i64::MAX,
+        }
+    }
+
+    /// Returns the raw price for the given value at the price precision.
+    #[inline]
+    pub fn make_price_raw(&self, value: f64) -> i64 {
+        f64_to_fixed_i64(value, self.price_precision)
+    }
+
+    /// Returns the raw quantity for the given value at the size precision.
+    #[inline]
+    pub fn make_qty_raw(&self, value: f64) -> u64 {
+        f64_to_fixed_u64(value, self.size_precision)
+    }
+
+    /// Returns the given raw price rounded to the nearest price increment (ties
+    /// round up), clamped to the min and max price.
+    #[inline]
+    pub fn round_to_tick(&self, raw: i64) -> i64 {
+        let remainder = raw.rem_euclid(self.price_increment);
+        let mut rounded = raw - remainder;
+        if remainder * 2 >= self.price_increment {
+            rounded += self.price_increment;
+        }
+        rounded.clamp(self.min_price, self.max_price)
+    }
+
+    /// Returns the given raw quantity rounded down to the size increment,
+    /// clamped to the min and max quantity.
+    #[inline]
+    pub fn clamp_to_lot(&self, raw: u64) -> u64 {
+        let floored = raw - (raw % self.size_increment);
+        floored.clamp(self.min_quantity, self.max_quantity)
+    }
+
+    /// Returns the raw price for the given value rounded to a valid tick.
+    #[inline]
+    pub fn quantize_price(&self, value: f64) -> i64 {
+        self.round_to_tick((value * FIXED_SCALAR).round() as i64)
+    }
+
+    /// Returns the raw quantity for the given value rounded to a valid lot.
+    #[inline]
+    pub fn quantize_qty(&self, value: f64) -> u64 {
+        self.clamp_to_lot((value * FIXED_SCALAR).round() as u64)
+    }
+
+    /// Quantizes each of the given price values into `out`.
+    ///
+    /// # Panics
+    /// - If `values` and `out` are not of equal length.
+    pub fn quantize_prices(&self, values: &[f64], out: &mut [i64]) {
+        assert_eq!(values.len(), out.len());
+        for (raw, value) in out.iter_mut().zip(values) {
+            *raw = self.quantize_price(*value);
+        }
+    }
+
+    /// Quantizes each of the given quantity values into `out`.
+    ///
+    /// # Panics
+    /// - If `values` and `out` are not of equal length.
+    pub fn quantize_qtys(&self, values: &[f64], out: &mut [u64]) {
+        assert_eq!(values.len(), out.len());
+        for (raw, value) in out.iter_mut().zip(values) {
+            *raw = self.quantize_qty(*value);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// C API
+////////////////////////////////////////////////////////////////////////////////
+#[allow(clippy::too_many_arguments)]
+#[no_mangle]
+pub extern "C" fn instrument_spec_new(
+    price_precision: u8,
+    size_precision: u8,
+    price_increment: i64,
+    size_increment: u64,
+    multiplier: u64,
+    min_quantity: u64,
+    max_quantity: u64,
+    min_price: i64,
+    max_price: i64,
+) -> InstrumentSpec {
+    InstrumentSpec {
+        min_quantity,
+        max_quantity,
+        min_price,
+        max_price,
+        ..InstrumentSpec::new(
+            price_precision,
+            size_precision,
+            price_increment,
+            size_increment,
+            multiplier,
+        )
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn instrument_spec_make_price_raw(spec: &InstrumentSpec, value: f64) -> i64 {
+    spec.make_price_raw(value)
+}
+
+#[no_mangle]
+pub extern "C" fn instrument_spec_make_qty_raw(spec: &InstrumentSpec, value: f64) -> u64 {
+    spec.make_qty_raw(value)
+}
+
+#[no_mangle]
+pub extern "C" fn instrument_spec_quantize_price(spec: &InstrumentSpec, value: f64) -> i64 {
+    spec.quantize_price(value)
+}
+
+#[no_mangle]
+pub extern "C" fn instrument_spec_quantize_qty(spec: &InstrumentSpec, value: f64) -> u64 {
+    spec.quantize_qty(value)
+}
+
+/// Quantizes `len` price values into `out`.
+///
+/// # Safety
+/// - `values` must point to `len` contiguous values.
+/// - `out` must point to `len` contiguous writable values.
+#[no_mangle]
+pub unsafe extern "C" fn instrument_spec_quantize_prices(
+    spec: &InstrumentSpec,
+    values: *const f64,
+    out: *mut i64,
+    len: usize,
+) {
+    if len > 0 {
+        spec.quantize_prices(
+            std::slice::from_raw_parts(values, len),
+            std::slice::from_raw_parts_mut(out, len),
+        );
+    }
+}
+
+/// Quantizes `len` quantity values into `out`.
+///
+/// # Safety
+/// - `values` must point to `len` contiguous values.
+/// - `out` must point to `len` contiguous writable values.
+#[no_mangle]
+pub unsafe extern "C" fn instrument_spec_quantize_qtys(
+    spec: &InstrumentSpec,
+    values: *const f64,
+    out: *mut u64,
+    len: usize,
+) {
+    if len > 0 {
+        spec.quantize_qtys(
+            std::slice::from_raw_parts(values, len),
+            std::slice::from_raw_parts_mut(out, len),
+        );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use crate::instruments::spec::InstrumentSpec;
+
+    fn spec() -> InstrumentSpec {
+        // Tick size 0.05 and lot size 0.1
+        InstrumentSpec::new(2, 1, 50_000_000, 100_000_000, 1_000_000_000)
+    }
+
+    #[test]
+    fn test_make_price_and_qty_raw() {
+        let spec = spec();
+
+        assert_eq!(spec.make_price_raw(1.234), 1_230_000_000);
+        assert_eq!(spec.make_qty_raw(1.26), 1_300_000_000);
+    }
+
+    #[test]
+    fn test_quantize_price_rounds_to_nearest_tick() {
+        let spec = spec();
+
+        assert_eq!(spec.quantize_price(1.02), 1_000_000_000);
+        assert_eq!(spec.quantize_price(1.025), 1_050_000_000);
+        assert_eq!(spec.quantize_price(1.07), 1_050_000_000);
+        assert_eq!(spec.quantize_price(-1.02), -1_000_000_000);
+    }
+
+    #[test]
+    fn test_quantize_price_clamps_to_limits() {
+        let mut spec = spec();
+        spec.min_price = 1_000_000_000;
+        spec.max_price = 2_000_000_000;
+
+        assert_eq!(spec.quantize_price(0.5), 1_000_000_000);
+        assert_eq!(spec.quantize_price(2.5), 2_000_000_000);
+    }
+
+    #[test]
+    fn test_quantize_qty_floors_to_lot_and_clamps() {
+        let mut spec = spec();
+        spec.min_quantity = 100_000_000;
+        spec.max_quantity = 5_000_000_000;
+
+        assert_eq!(spec.quantize_qty(1.29), 1_200_000_000);
+        assert_eq!(spec.quantize_qty(0.01), 100_000_000);
+        assert_eq!(spec.quantize_qty(10.0), 5_000_000_000);
+    }
+
+    #[test]
+    fn test_quantize_batch_matches_single() {
+        let spec = spec();
+        let values = [1.01, 1.026, 2.0, 3.333];
+        let mut prices = [0; 4];
+        let mut qtys = [0; 4];
+
+        spec.quantize_prices(&values, &mut prices);
+        spec.quantize_qtys(&values, &mut qtys);
+
+        for i in 0..values.len() {
+            assert_eq!(prices[i], spec.quantize_price(values[i]));
+            assert_eq!(qtys[i], spec.quantize_qty(values[i]));
+        }
+    }
+}
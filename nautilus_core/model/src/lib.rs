@@ -16,5 +16,6 @@
 pub mod data;
 pub mod enums;
 pub mod identifiers;
+pub mod instruments;
 pub mod orderbook;
 pub mod types;
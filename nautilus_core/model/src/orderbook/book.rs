@@ -16,8 +16,46 @@
 use crate::enums::{BookLevel, OrderSide};
 use crate::identifiers::instrument_id::InstrumentId;
 use crate::orderbook::ladder::Ladder;
+use crate::orderbook::level::Level;
 use crate::orderbook::order::Order;
+use crate::types::price::Price;
+use crate::types::quantity::Quantity;
 
+/// Provides the common interface for order books of every `BookLevel`.
+///
+/// Each book level has its own specialized storage, so callers can pick the
+/// cheapest book for the data they receive while handling them uniformly.
+pub trait Book {
+    fn book_level(&self) -> BookLevel;
+    fn instrument_id(&self) -> &InstrumentId;
+    fn ts_last(&self) -> u64;
+    fn add(&mut self, order: Order, ts_event: u64);
+    fn update(&mut self, order: Order, ts_event: u64);
+    fn delete(&mut self, order: Order, ts_event: u64);
+    fn clear(&mut self);
+    fn best_bid_price(&self) -> Option<Price>;
+    fn best_ask_price(&self) -> Option<Price>;
+    fn best_bid_size(&self) -> Option<Quantity>;
+    fn best_ask_size(&self) -> Option<Quantity>;
+
+    fn spread(&self) -> Option<f64> {
+        match (self.best_bid_price(), self.best_ask_price()) {
+            (Some(bid), Some(ask)) => Some(ask.as_f64() - bid.as_f64()),
+            _ => None,
+        }
+    }
+
+    fn midpoint(&self) -> Option<f64> {
+        match (self.best_bid_price(), self.best_ask_price()) {
+            (Some(bid), Some(ask)) => Some((ask.as_f64() + bid.as_f64()) / 2.0),
+            _ => None,
+        }
+    }
+}
+
+/// Provides an order book with full order queues at each price level.
+///
+/// Use `L1OrderBook` or `L2OrderBook` where individual orders are not needed.
 #[repr(C)]
 pub struct OrderBook {
     bids: Ladder,
@@ -70,6 +108,62 @@ impl OrderBook {
             OrderSide::Sell => self.asks.delete(order),
         }
     }
+
+    pub fn clear(&mut self) {
+        self.bids = Ladder::new(OrderSide::Buy);
+        self.asks = Ladder::new(OrderSide::Sell);
+    }
+}
+
+fn level_size(level: &Level) -> Quantity {
+    let precision = level.orders.first().map_or(0, |o| o.size.precision);
+    Quantity::from_raw(level.orders.iter().map(|o| o.size.raw).sum(), precision)
+}
+
+impl Book for OrderBook {
+    fn book_level(&self) -> BookLevel {
+        self.book_level
+    }
+
+    fn instrument_id(&self) -> &InstrumentId {
+        &self.instrument_id
+    }
+
+    fn ts_last(&self) -> u64 {
+        self.ts_last
+    }
+
+    fn add(&mut self, order: Order, ts_event: u64) {
+        OrderBook::add(self, order, ts_event);
+    }
+
+    fn update(&mut self, order: Order, ts_event: u64) {
+        OrderBook::update(self, order, ts_event);
+    }
+
+    fn delete(&mut self, order: Order, ts_event: u64) {
+        OrderBook::delete(self, order, ts_event);
+    }
+
+    fn clear(&mut self) {
+        OrderBook::clear(self);
+    }
+
+    fn best_bid_price(&self) -> Option<Price> {
+        self.bids.top().map(|l| l.price.value.clone())
+    }
+
+    fn best_ask_price(&self) -> Option<Price> {
+        self.asks.top().map(|l| l.price.value.clone())
+    }
+
+    fn best_bid_size(&self) -> Option<Quantity> {
+        self.bids.top().map(level_size)
+    }
+
+    fn best_ask_size(&self) -> Option<Quantity> {
+        self.asks.top().map(level_size)
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -79,3 +173,80 @@ impl OrderBook {
 pub extern "C" fn order_book_new(instrument_id: InstrumentId, book_level: BookLevel) -> OrderBook {
     OrderBook::new(instrument_id, book_level)
 }
+
+#[no_mangle]
+pub extern "C" fn order_book_free(book: OrderBook) {
+    drop(book); // Memory freed here
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use crate::enums::{BookLevel, OrderSide};
+    use crate::identifiers::instrument_id::InstrumentId;
+    use crate::orderbook::book::{Book, OrderBook};
+    use crate::orderbook::order::Order;
+    use crate::types::price::Price;
+    use crate::types::quantity::Quantity;
+
+    #[test]
+    fn test_l3_book_best_prices_and_sizes() {
+        let mut book = OrderBook::new(
+            InstrumentId::from("ETHUSDT-PERP.BINANCE"),
+            BookLevel::L3_MBO,
+        );
+        let order1 = Order::new(
+            Price::new(10.0, 1),
+            Quantity::new(1.0, 0),
+            OrderSide::Buy,
+            1,
+        );
+        let order2 = Order::new(
+            Price::new(10.0, 1),
+            Quantity::new(2.0, 0),
+            OrderSide::Buy,
+            2,
+        );
+        let order3 = Order::new(
+            Price::new(11.0, 1),
+            Quantity::new(5.0, 0),
+            OrderSide::Sell,
+            3,
+        );
+
+        Book::add(&mut book, order1, 1);
+        Book::add(&mut book, order2, 2);
+        Book::add(&mut book, order3, 3);
+
+        assert_eq!(book.book_level(), BookLevel::L3_MBO);
+        assert_eq!(book.best_bid_price(), Some(Price::new(10.0, 1)));
+        assert_eq!(book.best_ask_price(), Some(Price::new(11.0, 1)));
+        assert_eq!(book.best_bid_size(), Some(Quantity::new(3.0, 0)));
+        assert_eq!(book.best_ask_size(), Some(Quantity::new(5.0, 0)));
+        assert_eq!(book.spread(), Some(1.0));
+        assert_eq!(book.midpoint(), Some(10.5));
+        assert_eq!(Book::ts_last(&book), 3);
+    }
+
+    #[test]
+    fn test_l3_book_clear() {
+        let mut book = OrderBook::new(
+            InstrumentId::from("ETHUSDT-PERP.BINANCE"),
+            BookLevel::L3_MBO,
+        );
+        let order = Order::new(
+            Price::new(10.0, 1),
+            Quantity::new(1.0, 0),
+            OrderSide::Buy,
+            1,
+        );
+        book.add(order, 1);
+
+        Book::clear(&mut book);
+
+        assert_eq!(book.best_bid_price(), None);
+        assert_eq!(book.spread(), None);
+    }
+}
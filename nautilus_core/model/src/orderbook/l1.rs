@@ -0,0 +1,204 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use crate::enums::{BookLevel, OrderSide};
+use crate::identifiers::instrument_id::InstrumentId;
+use crate::orderbook::book::Book;
+use crate::orderbook::order::Order;
+use crate::types::price::Price;
+use crate::types::quantity::Quantity;
+
+/// Provides a L1 TBBO (top of book best bid/offer) order book.
+///
+/// Only the top level of each side is held, inline and without any heap
+/// allocation. A side with a zero size order is empty.
+#[repr(C)]
+pub struct L1OrderBook {
+    bid: Order,
+    ask: Order,
+    pub instrument_id: InstrumentId,
+    pub last_side: OrderSide,
+    pub ts_last: u64,
+}
+
+fn empty_order(side: OrderSide) -> Order {
+    Order::new(Price::from_raw(0, 0), Quantity::from_raw(0, 0), side, 0)
+}
+
+fn top(order: &Order) -> Option<&Order> {
+    if order.size.raw == 0 {
+        None
+    } else {
+        Some(order)
+    }
+}
+
+impl L1OrderBook {
+    pub fn new(instrument_id: InstrumentId) -> Self {
+        L1OrderBook {
+            bid: empty_order(OrderSide::Buy),
+            ask: empty_order(OrderSide::Sell),
+            instrument_id,
+            last_side: OrderSide::Buy,
+            ts_last: 0,
+        }
+    }
+}
+
+impl Book for L1OrderBook {
+    fn book_level(&self) -> BookLevel {
+        BookLevel::L1_TBBO
+    }
+
+    fn instrument_id(&self) -> &InstrumentId {
+        &self.instrument_id
+    }
+
+    fn ts_last(&self) -> u64 {
+        self.ts_last
+    }
+
+    /// Adding to a L1 book replaces the top level of the orders side.
+    fn add(&mut self, order: Order, ts_event: u64) {
+        self.update(order, ts_event);
+    }
+
+    fn update(&mut self, order: Order, ts_event: u64) {
+        if order.size.raw == 0 {
+            self.delete(order, ts_event);
+            return;
+        }
+
+        self.last_side = order.side;
+        self.ts_last = ts_event;
+
+        // Bid and ask updates typically arrive together, so the opposite side
+        // may still hold a stale price which would now cross this order
+        match order.side {
+            OrderSide::Buy => {
+                if matches!(top(&self.ask), Some(ask) if order.price >= ask.price) {
+                    self.ask = empty_order(OrderSide::Sell);
+                }
+                self.bid = order;
+            }
+            OrderSide::Sell => {
+                if matches!(top(&self.bid), Some(bid) if order.price <= bid.price) {
+                    self.bid = empty_order(OrderSide::Buy);
+                }
+                self.ask = order;
+            }
+        }
+    }
+
+    fn delete(&mut self, order: Order, ts_event: u64) {
+        self.last_side = order.side;
+        self.ts_last = ts_event;
+        match order.side {
+            OrderSide::Buy => self.bid = empty_order(OrderSide::Buy),
+            OrderSide::Sell => self.ask = empty_order(OrderSide::Sell),
+        }
+    }
+
+    fn clear(&mut self) {
+        self.bid = empty_order(OrderSide::Buy);
+        self.ask = empty_order(OrderSide::Sell);
+    }
+
+    fn best_bid_price(&self) -> Option<Price> {
+        top(&self.bid).map(|o| o.price.clone())
+    }
+
+    fn best_ask_price(&self) -> Option<Price> {
+        top(&self.ask).map(|o| o.price.clone())
+    }
+
+    fn best_bid_size(&self) -> Option<Quantity> {
+        top(&self.bid).map(|o| o.size.clone())
+    }
+
+    fn best_ask_size(&self) -> Option<Quantity> {
+        top(&self.ask).map(|o| o.size.clone())
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// C API
+////////////////////////////////////////////////////////////////////////////////
+#[no_mangle]
+pub extern "C" fn l1_order_book_new(instrument_id: InstrumentId) -> L1OrderBook {
+    L1OrderBook::new(instrument_id)
+}
+
+#[no_mangle]
+pub extern "C" fn l1_order_book_free(book: L1OrderBook) {
+    drop(book); // Memory freed here
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use crate::enums::{BookLevel, OrderSide};
+    use crate::identifiers::instrument_id::InstrumentId;
+    use crate::orderbook::book::Book;
+    use crate::orderbook::l1::L1OrderBook;
+    use crate::orderbook::order::Order;
+    use crate::types::price::Price;
+    use crate::types::quantity::Quantity;
+
+    fn order(price: f64, size: f64, side: OrderSide) -> Order {
+        Order::new(Price::new(price, 1), Quantity::new(size, 0), side, 0)
+    }
+
+    #[test]
+    fn test_l1_book_update_replaces_top_level() {
+        let mut book = L1OrderBook::new(InstrumentId::from("ETHUSDT-PERP.BINANCE"));
+
+        book.update(order(10.0, 1.0, OrderSide::Buy), 1);
+        book.update(order(10.1, 2.0, OrderSide::Buy), 2);
+        book.add(order(10.5, 3.0, OrderSide::Sell), 3);
+
+        assert_eq!(book.book_level(), BookLevel::L1_TBBO);
+        assert_eq!(book.best_bid_price(), Some(Price::new(10.1, 1)));
+        assert_eq!(book.best_bid_size(), Some(Quantity::new(2.0, 0)));
+        assert_eq!(book.best_ask_price(), Some(Price::new(10.5, 1)));
+        assert_eq!(book.best_ask_size(), Some(Quantity::new(3.0, 0)));
+        assert_eq!(book.ts_last(), 3);
+    }
+
+    #[test]
+    fn test_l1_book_update_clears_crossed_opposite_side() {
+        let mut book = L1OrderBook::new(InstrumentId::from("ETHUSDT-PERP.BINANCE"));
+        book.update(order(10.0, 1.0, OrderSide::Buy), 1);
+        book.update(order(10.5, 1.0, OrderSide::Sell), 2);
+
+        book.update(order(10.6, 1.0, OrderSide::Buy), 3);
+
+        assert_eq!(book.best_bid_price(), Some(Price::new(10.6, 1)));
+        assert_eq!(book.best_ask_price(), None);
+    }
+
+    #[test]
+    fn test_l1_book_zero_size_update_deletes_side() {
+        let mut book = L1OrderBook::new(InstrumentId::from("ETHUSDT-PERP.BINANCE"));
+        book.update(order(10.0, 1.0, OrderSide::Buy), 1);
+
+        book.update(order(10.0, 0.0, OrderSide::Buy), 2);
+
+        assert_eq!(book.best_bid_price(), None);
+        assert_eq!(book.midpoint(), None);
+    }
+}
@@ -0,0 +1,196 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use crate::enums::{BookLevel, OrderSide};
+use crate::identifiers::instrument_id::InstrumentId;
+use crate::orderbook::book::Book;
+use crate::orderbook::ladder::BookPrice;
+use crate::orderbook::order::Order;
+use crate::types::price::Price;
+use crate::types::quantity::Quantity;
+use std::collections::BTreeMap;
+
+/// Provides a L2 MBP (market by price) order book.
+///
+/// Each price level holds only its aggregated size, so there are no per order
+/// queues or order ID caches to maintain.
+#[repr(C)]
+pub struct L2OrderBook {
+    bids: Box<BTreeMap<BookPrice, Quantity>>,
+    asks: Box<BTreeMap<BookPrice, Quantity>>,
+    pub instrument_id: InstrumentId,
+    pub last_side: OrderSide,
+    pub ts_last: u64,
+}
+
+impl L2OrderBook {
+    pub fn new(instrument_id: InstrumentId) -> Self {
+        L2OrderBook {
+            bids: Box::new(BTreeMap::new()),
+            asks: Box::new(BTreeMap::new()),
+            instrument_id,
+            last_side: OrderSide::Buy,
+            ts_last: 0,
+        }
+    }
+
+    /// Returns the number of price levels on the given side.
+    pub fn levels(&self, side: OrderSide) -> usize {
+        match side {
+            OrderSide::Buy => self.bids.len(),
+            OrderSide::Sell => self.asks.len(),
+        }
+    }
+
+    fn side_mut(&mut self, side: OrderSide) -> &mut BTreeMap<BookPrice, Quantity> {
+        match side {
+            OrderSide::Buy => self.bids.as_mut(),
+            OrderSide::Sell => self.asks.as_mut(),
+        }
+    }
+}
+
+impl Book for L2OrderBook {
+    fn book_level(&self) -> BookLevel {
+        BookLevel::L2_MBP
+    }
+
+    fn instrument_id(&self) -> &InstrumentId {
+        &self.instrument_id
+    }
+
+    fn ts_last(&self) -> u64 {
+        self.ts_last
+    }
+
+    /// Adding to a L2 book sets the size of the orders price level.
+    fn add(&mut self, order: Order, ts_event: u64) {
+        self.update(order, ts_event);
+    }
+
+    fn update(&mut self, order: Order, ts_event: u64) {
+        if order.size.raw == 0 {
+            self.delete(order, ts_event);
+            return;
+        }
+
+        self.last_side = order.side;
+        self.ts_last = ts_event;
+        let book_price = order.to_book_price();
+        self.side_mut(order.side).insert(book_price, order.size);
+    }
+
+    fn delete(&mut self, order: Order, ts_event: u64) {
+        self.last_side = order.side;
+        self.ts_last = ts_event;
+        let book_price = order.to_book_price();
+        self.side_mut(order.side).remove(&book_price);
+    }
+
+    fn clear(&mut self) {
+        self.bids.clear();
+        self.asks.clear();
+    }
+
+    fn best_bid_price(&self) -> Option<Price> {
+        self.bids.keys().next().map(|p| p.value.clone())
+    }
+
+    fn best_ask_price(&self) -> Option<Price> {
+        self.asks.keys().next().map(|p| p.value.clone())
+    }
+
+    fn best_bid_size(&self) -> Option<Quantity> {
+        self.bids.values().next().cloned()
+    }
+
+    fn best_ask_size(&self) -> Option<Quantity> {
+        self.asks.values().next().cloned()
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// C API
+////////////////////////////////////////////////////////////////////////////////
+#[no_mangle]
+pub extern "C" fn l2_order_book_new(instrument_id: InstrumentId) -> L2OrderBook {
+    L2OrderBook::new(instrument_id)
+}
+
+#[no_mangle]
+pub extern "C" fn l2_order_book_free(book: L2OrderBook) {
+    drop(book); // Memory freed here
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use crate::enums::{BookLevel, OrderSide};
+    use crate::identifiers::instrument_id::InstrumentId;
+    use crate::orderbook::book::Book;
+    use crate::orderbook::l2::L2OrderBook;
+    use crate::orderbook::order::Order;
+    use crate::types::price::Price;
+    use crate::types::quantity::Quantity;
+
+    fn order(price: f64, size: f64, side: OrderSide) -> Order {
+        Order::new(Price::new(price, 1), Quantity::new(size, 0), side, 0)
+    }
+
+    #[test]
+    fn test_l2_book_levels_sorted_by_side() {
+        let mut book = L2OrderBook::new(InstrumentId::from("ETHUSDT-PERP.BINANCE"));
+
+        book.add(order(10.0, 1.0, OrderSide::Buy), 1);
+        book.add(order(10.2, 2.0, OrderSide::Buy), 2);
+        book.add(order(10.6, 3.0, OrderSide::Sell), 3);
+        book.add(order(10.4, 4.0, OrderSide::Sell), 4);
+
+        assert_eq!(book.book_level(), BookLevel::L2_MBP);
+        assert_eq!(book.levels(OrderSide::Buy), 2);
+        assert_eq!(book.best_bid_price(), Some(Price::new(10.2, 1)));
+        assert_eq!(book.best_bid_size(), Some(Quantity::new(2.0, 0)));
+        assert_eq!(book.best_ask_price(), Some(Price::new(10.4, 1)));
+        assert_eq!(book.best_ask_size(), Some(Quantity::new(4.0, 0)));
+        assert_eq!(book.midpoint(), Some(10.3));
+    }
+
+    #[test]
+    fn test_l2_book_update_replaces_level_size() {
+        let mut book = L2OrderBook::new(InstrumentId::from("ETHUSDT-PERP.BINANCE"));
+        book.add(order(10.0, 1.0, OrderSide::Buy), 1);
+
+        book.update(order(10.0, 5.0, OrderSide::Buy), 2);
+
+        assert_eq!(book.levels(OrderSide::Buy), 1);
+        assert_eq!(book.best_bid_size(), Some(Quantity::new(5.0, 0)));
+    }
+
+    #[test]
+    fn test_l2_book_delete_and_zero_size_update_remove_level() {
+        let mut book = L2OrderBook::new(InstrumentId::from("ETHUSDT-PERP.BINANCE"));
+        book.add(order(10.0, 1.0, OrderSide::Buy), 1);
+        book.add(order(10.1, 1.0, OrderSide::Buy), 2);
+
+        book.delete(order(10.1, 0.0, OrderSide::Buy), 3);
+        book.update(order(10.0, 0.0, OrderSide::Buy), 4);
+
+        assert_eq!(book.levels(OrderSide::Buy), 0);
+        assert_eq!(book.best_bid_price(), None);
+        assert_eq!(book.ts_last(), 4);
+    }
+}
@@ -14,6 +14,8 @@
 // -------------------------------------------------------------------------------------------------
 
 pub mod book;
+pub mod l1;
+pub mod l2;
 pub mod ladder;
 pub mod level;
 pub mod order;
@@ -0,0 +1,66 @@
+# -------------------------------------------------------------------------------------------------
+#  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+#  https://nautechsystems.io
+#
+#  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+#  You may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+# -------------------------------------------------------------------------------------------------
+
+from libc.stdint cimport int64_t
+from libc.stdint cimport uint8_t
+from libc.stdint cimport uint64_t
+
+from nautilus_trader.core.data cimport Data
+from nautilus_trader.model.identifiers cimport InstrumentId
+from nautilus_trader.model.identifiers cimport Venue
+
+
+cdef class DataStream:
+    cdef readonly uint64_t length
+    """The number of data elements in the stream.\n\n:returns: `uint64_t`"""
+    cdef readonly type data_type
+    """The type of all data in the stream (``None`` if mixed).\n\n:returns: `type` or ``None``"""
+    cdef readonly Venue venue
+    """The venue of all data in the stream (``None`` if not known).\n\n:returns: `Venue` or ``None``"""
+
+    cdef uint64_t ts_init_c(self, uint64_t index) except *
+    cdef Data get_c(self, uint64_t index)
+    cdef uint64_t bisect_c(self, uint64_t ts_init) except *
+    cpdef list to_list(self)
+
+
+cdef class ListDataStream(DataStream):
+    cdef list _data
+
+
+cdef class QuoteTickColumns(DataStream):
+    cdef readonly InstrumentId instrument_id
+    """The instrument ID for the ticks.\n\n:returns: `InstrumentId`"""
+    cdef uint8_t _price_prec
+    cdef uint8_t _size_prec
+    cdef const int64_t[:] _bid
+    cdef const int64_t[:] _ask
+    cdef const uint64_t[:] _bid_size
+    cdef const uint64_t[:] _ask_size
+    cdef const uint64_t[:] _ts_event
+    cdef const uint64_t[:] _ts_init
+
+
+cdef class TradeTickColumns(DataStream):
+    cdef readonly InstrumentId instrument_id
+    """The instrument ID for the ticks.\n\n:returns: `InstrumentId`"""
+    cdef uint8_t _price_prec
+    cdef uint8_t _size_prec
+    cdef const int64_t[:] _price
+    cdef const uint64_t[:] _size
+    cdef const uint8_t[:] _aggressor_side
+    cdef object _trade_id
+    cdef const uint64_t[:] _ts_event
+    cdef const uint64_t[:] _ts_init
@@ -0,0 +1,465 @@
+# -------------------------------------------------------------------------------------------------
+#  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+#  https://nautechsystems.io
+#
+#  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+#  You may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+# -------------------------------------------------------------------------------------------------
+
+import numpy as np
+import pyarrow as pa
+import pyarrow.compute as pc
+
+from libc.stdint cimport int64_t
+from libc.stdint cimport uint8_t
+from libc.stdint cimport uint64_t
+
+from nautilus_trader.core.correctness cimport Condition
+from nautilus_trader.core.data cimport Data
+from nautilus_trader.model.c_enums.aggressor_side cimport AggressorSide
+from nautilus_trader.model.data.tick cimport QuoteTick
+from nautilus_trader.model.data.tick cimport TradeTick
+from nautilus_trader.model.identifiers cimport InstrumentId
+from nautilus_trader.model.identifiers cimport TradeId
+from nautilus_trader.model.instruments.base cimport Instrument
+
+
+cdef class DataStream:
+    """
+    The abstract base class for all backtest data streams.
+
+    A data stream holds data sorted by `ts_init`, and only needs to produce a
+    `Data` object for the element currently being dispatched.
+
+    Warnings
+    --------
+    This class should not be used directly, but through a concrete subclass.
+    """
+
+    cdef uint64_t ts_init_c(self, uint64_t index) except *:
+        raise NotImplementedError("method must be implemented in the subclass")  # pragma: no cover
+
+    cdef Data get_c(self, uint64_t index):
+        raise NotImplementedError("method must be implemented in the subclass")  # pragma: no cover
+
+    cdef uint64_t bisect_c(self, uint64_t ts_init) except *:
+        # Return the index of the first element with `ts_init` >= the given timestamp
+        cdef uint64_t lo = 0
+        cdef uint64_t hi = self.length
+        cdef uint64_t mid
+        while lo < hi:
+            mid = (lo + hi) // 2
+            if self.ts_init_c(mid) < ts_init:
+                lo = mid + 1
+            else:
+                hi = mid
+        return lo
+
+    def __len__(self) -> int:
+        return self.length
+
+    def __getitem__(self, int index) -> Data:
+        if index < 0:
+            index += self.length
+        if not 0 <= index < <int>self.length:
+            raise IndexError(f"index out of range, was {index}")
+        return self.get_c(index)
+
+    cpdef list to_list(self):
+        """
+        Return all data in the stream as a list of objects.
+
+        Returns
+        -------
+        list[Data]
+
+        """
+        cdef uint64_t i
+        return [self.get_c(i) for i in range(self.length)]
+
+
+cdef class ListDataStream(DataStream):
+    """
+    Provides a data stream over a list of `Data` objects.
+
+    Parameters
+    ----------
+    data : list[Data]
+        The data for the stream (will be sorted by `ts_init` if not already).
+    """
+
+    def __init__(self, list data not None):
+        if _is_sorted(data):
+            data = data.copy()
+        else:
+            data = sorted(data, key=lambda x: x.ts_init)
+        self._data = data
+        self.length = len(data)
+        self.data_type = _common_type(data)
+
+    cdef uint64_t ts_init_c(self, uint64_t index) except *:
+        return (<Data>self._data[index]).ts_init
+
+    cdef Data get_c(self, uint64_t index):
+        return self._data[index]
+
+    cpdef list to_list(self):
+        return self._data.copy()
+
+
+cdef class QuoteTickColumns(DataStream):
+    """
+    Provides a columnar data stream of quote ticks for a single instrument.
+
+    Each tick takes 48 bytes of raw fixed-point columns, and a `QuoteTick` is
+    only created for the element being dispatched.
+
+    Parameters
+    ----------
+    instrument : Instrument
+        The instrument for the ticks.
+    bid : array-like[int64]
+        The raw top of book bid prices (as scaled fixed precision integers).
+    ask : array-like[int64]
+        The raw top of book ask prices (as scaled fixed precision integers).
+    bid_size : array-like[uint64]
+        The raw top of book bid sizes (as scaled fixed precision integers).
+    ask_size : array-like[uint64]
+        The raw top of book ask sizes (as scaled fixed precision integers).
+    ts_event : array-like[uint64]
+        The UNIX timestamps (nanoseconds) when the tick events occurred.
+    ts_init : array-like[uint64]
+        The UNIX timestamps (nanoseconds) when the data objects were initialized.
+
+    Raises
+    ------
+    ValueError
+        If the columns are not all the same length.
+    """
+
+    def __init__(
+        self,
+        Instrument instrument not None,
+        bid,
+        ask,
+        bid_size,
+        ask_size,
+        ts_event,
+        ts_init,
+    ):
+        cdef list columns = _sorted_columns(
+            ts_init,
+            [
+                (bid, np.int64),
+                (ask, np.int64),
+                (bid_size, np.uint64),
+                (ask_size, np.uint64),
+                (ts_event, np.uint64),
+            ],
+        )
+
+        self.data_type = QuoteTick
+        self.venue = instrument.id.venue
+        self.instrument_id = instrument.id
+        self._price_prec = instrument.price_precision
+        self._size_prec = instrument.size_precision
+        self._ts_init = columns[0]
+        self._bid = columns[1]
+        self._ask = columns[2]
+        self._bid_size = columns[3]
+        self._ask_size = columns[4]
+        self._ts_event = columns[5]
+        self.length = len(columns[0])
+
+    @staticmethod
+    def from_arrow(Instrument instrument not None, data not None) -> QuoteTickColumns:
+        """
+        Return quote tick columns from the given Arrow table or record batch.
+
+        Expects the `QuoteTick` catalog schema columns ['bid', 'ask', 'bid_size',
+        'ask_size', 'ts_event', 'ts_init']. Integer price and size columns are
+        taken as raw fixed-point values, otherwise they are parsed as decimals.
+
+        Parameters
+        ----------
+        instrument : Instrument
+            The instrument for the ticks.
+        data : pa.Table or pa.RecordBatch
+            The tick data.
+
+        Returns
+        -------
+        QuoteTickColumns
+
+        """
+        table = _as_table(data)
+        return QuoteTickColumns(
+            instrument=instrument,
+            bid=_raw_column(table.column("bid"), instrument.price_precision),
+            ask=_raw_column(table.column("ask"), instrument.price_precision),
+            bid_size=_raw_column(table.column("bid_size"), instrument.size_precision),
+            ask_size=_raw_column(table.column("ask_size"), instrument.size_precision),
+            ts_event=table.column("ts_event").to_numpy(),
+            ts_init=table.column("ts_init").to_numpy(),
+        )
+
+    def to_arrow(self) -> pa.Table:
+        """
+        Return the raw columns as an Arrow table (without copying).
+
+        The integer price and size columns are taken as raw fixed-point values
+        by `from_arrow`, so the table can be loaded back for the same instrument
+        without parsing.
+
+        Returns
+        -------
+        pa.Table
+
+        """
+        return pa.table(
+            {
+                "bid": np.asarray(self._bid),
+                "ask": np.asarray(self._ask),
+                "bid_size": np.asarray(self._bid_size),
+                "ask_size": np.asarray(self._ask_size),
+                "ts_event": np.asarray(self._ts_event),
+                "ts_init": np.asarray(self._ts_init),
+            },
+        )
+
+    cdef uint64_t ts_init_c(self, uint64_t index) except *:
+        return self._ts_init[index]
+
+    cdef Data get_c(self, uint64_t index):
+        return QuoteTick.from_raw_c(
+            self.instrument_id,
+            self._bid[index],
+            self._ask[index],
+            self._price_prec,
+            self._bid_size[index],
+            self._ask_size[index],
+            self._size_prec,
+            self._ts_event[index],
+            self._ts_init[index],
+        )
+
+
+cdef class TradeTickColumns(DataStream):
+    """
+    Provides a columnar data stream of trade ticks for a single instrument.
+
+    A `TradeTick` is only created for the element being dispatched.
+
+    Parameters
+    ----------
+    instrument : Instrument
+        The instrument for the ticks.
+    price : array-like[int64]
+        The raw traded prices (as scaled fixed precision integers).
+    size : array-like[uint64]
+        The raw traded sizes (as scaled fixed precision integers).
+    aggressor_side : array-like[uint8]
+        The trade aggressor sides.
+    trade_id : array-like[str]
+        The trade match IDs.
+    ts_event : array-like[uint64]
+        The UNIX timestamps (nanoseconds) when the tick events occurred.
+    ts_init : array-like[uint64]
+        The UNIX timestamps (nanoseconds) when the data objects were initialized.
+
+    Raises
+    ------
+    ValueError
+        If the columns are not all the same length.
+    """
+
+    def __init__(
+        self,
+        Instrument instrument not None,
+        price,
+        size,
+        aggressor_side,
+        trade_id,
+        ts_event,
+        ts_init,
+    ):
+        cdef list columns = _sorted_columns(
+            ts_init,
+            [
+                (price, np.int64),
+                (size, np.uint64),
+                (aggressor_side, np.uint8),
+                (trade_id, object),
+                (ts_event, np.uint64),
+            ],
+        )
+
+        self.data_type = TradeTick
+        self.venue = instrument.id.venue
+        self.instrument_id = instrument.id
+        self._price_prec = instrument.price_precision
+        self._size_prec = instrument.size_precision
+        self._ts_init = columns[0]
+        self._price = columns[1]
+        self._size = columns[2]
+        self._aggressor_side = columns[3]
+        self._trade_id = columns[4]
+        self._ts_event = columns[5]
+        self.length = len(columns[0])
+
+    @staticmethod
+    def from_arrow(Instrument instrument not None, data not None) -> TradeTickColumns:
+        """
+        Return trade tick columns from the given Arrow table or record batch.
+
+        Expects the `TradeTick` catalog schema columns ['price', 'size',
+        'aggressor_side', 'trade_id', 'ts_event', 'ts_init']. Integer price and
+        size columns are taken as raw fixed-point values, otherwise they are
+        parsed as decimals.
+
+        Parameters
+        ----------
+        instrument : Instrument
+            The instrument for the ticks.
+        data : pa.Table or pa.RecordBatch
+            The tick data.
+
+        Returns
+        -------
+        TradeTickColumns
+
+        """
+        table = _as_table(data)
+        sides = table.column("aggressor_side")
+        if pa.types.is_integer(sides.type):
+            sides = sides.to_numpy()
+        else:
+            sides = pc.cast(sides, pa.string()).to_numpy(zero_copy_only=False)
+            sides = np.select(
+                [sides == "BUY", sides == "SELL"],
+                [AggressorSide.BUY, AggressorSide.SELL],
+                AggressorSide.UNKNOWN,
+            )
+        return TradeTickColumns(
+            instrument=instrument,
+            price=_raw_column(table.column("price"), instrument.price_precision),
+            size=_raw_column(table.column("size"), instrument.size_precision),
+            aggressor_side=sides,
+            trade_id=table.column("trade_id").to_numpy(zero_copy_only=False),
+            ts_event=table.column("ts_event").to_numpy(),
+            ts_init=table.column("ts_init").to_numpy(),
+        )
+
+    def to_arrow(self) -> pa.Table:
+        """
+        Return the raw columns as an Arrow table.
+
+        The integer price and size columns are taken as raw fixed-point values
+        by `from_arrow`, so the table can be loaded back for the same instrument
+        without parsing.
+
+        Returns
+        -------
+        pa.Table
+
+        """
+        return pa.table(
+            {
+                "price": np.asarray(self._price),
+                "size": np.asarray(self._size),
+                "aggressor_side": np.asarray(self._aggressor_side),
+                "trade_id": pa.array(self._trade_id, type=pa.string()),
+                "ts_event": np.asarray(self._ts_event),
+                "ts_init": np.asarray(self._ts_init),
+            },
+        )
+
+    cdef uint64_t ts_init_c(self, uint64_t index) except *:
+        return self._ts_init[index]
+
+    cdef Data get_c(self, uint64_t index):
+        return TradeTick.from_raw_c(
+            self.instrument_id,
+            self._price[index],
+            self._price_prec,
+            self._size[index],
+            self._size_prec,
+            <AggressorSide>self._aggressor_side[index],
+            TradeId(self._trade_id[index]),
+            self._ts_event[index],
+            self._ts_init[index],
+        )
+
+
+cdef bint _is_sorted(list data) except *:
+    cdef uint64_t last_ts = 0
+    cdef Data x
+    for x in data:
+        if x.ts_init < last_ts:
+            return False
+        last_ts = x.ts_init
+    return True
+
+
+cdef type _common_type(list data):
+    if not data:
+        return None
+    cdef type data_type = type(data[0])
+    for x in data:
+        if type(x) is not data_type:
+            return None
+    return data_type
+
+
+cdef list _sorted_columns(ts_init, list columns):
+    # Return the `ts_init` column followed by the given columns, all reordered
+    # by `ts_init` (stable) if they are not already sorted.
+    ts_init = np.ascontiguousarray(ts_init, dtype=np.uint64)
+    cdef list arrays = [np.ascontiguousarray(c, dtype=t) for c, t in columns]
+    for array in arrays:
+        Condition.equal(len(array), len(ts_init), "column length", "ts_init length")
+
+    if len(ts_init) > 1 and np.any(ts_init[1:] < ts_init[:-1]):
+        order = np.argsort(ts_init, kind="stable")
+        ts_init = ts_init[order]
+        arrays = [array[order] for array in arrays]
+
+    return [ts_init] + arrays
+
+
+def _as_table(data):
+    if isinstance(data, pa.RecordBatch):
+        return pa.Table.from_batches([data])
+    return data
+
+
+def _raw_column(column, uint8_t precision):
+    # Return the column as raw fixed-point values scaled to 9 decimal places
+    if pa.types.is_integer(column.type):
+        return column.to_numpy()
+
+    # Parse through decimal rather than float64, which loses digits once the
+    # value at the given precision exceeds 2^53
+    decimals = pc.cast(column, pa.decimal128(38, 9))
+    if isinstance(decimals, pa.ChunkedArray):
+        decimals = decimals.combine_chunks()
+    if len(decimals) == 0:
+        return np.empty(0, dtype=np.int64)
+
+    # Raw values fit in the low (little-endian) 64 bits of each decimal128
+    cdef int64_t offset = decimals.offset
+    raw = np.frombuffer(decimals.buffers()[1], dtype=np.int64).reshape(-1, 2)
+    raw = np.array(raw[offset:offset + len(decimals), 0])
+
+    # Round half up to the given precision
+    cdef int64_t step = 10 ** (9 - precision)
+    if step > 1:
+        raw = (raw + step // 2) // step * step
+    return raw
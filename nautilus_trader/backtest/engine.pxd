@@ -16,25 +16,52 @@
 from cpython.datetime cimport datetime
 from libc.stdint cimport uint64_t
 
+from nautilus_trader.backtest.data.store cimport DataStream
+from nautilus_trader.backtest.exchange cimport SimulatedExchange
+from nautilus_trader.backtest.profiler cimport BacktestProfiler
 from nautilus_trader.common.clock cimport Clock
+from nautilus_trader.common.clock cimport TimeEventScheduler
 from nautilus_trader.common.logging cimport Logger
 from nautilus_trader.common.logging cimport LoggerAdapter
 from nautilus_trader.core.data cimport Data
 from nautilus_trader.core.uuid cimport UUID4
+from nautilus_trader.model.identifiers cimport ComponentId
 from nautilus_trader.system.kernel cimport NautilusKernel
 
 
+cdef enum DataRouteKind:
+    ROUTE_DYNAMIC = 0
+    ROUTE_ORDER_BOOK = 1
+    ROUTE_QUOTE_TICK = 2
+    ROUTE_TRADE_TICK = 3
+    ROUTE_BAR = 4
+    ROUTE_DATA = 5
+
+
+cdef class DataRoute:
+    cdef DataRouteKind kind
+    cdef SimulatedExchange exchange
+
+
 cdef class BacktestEngine:
     cdef object _config
     cdef Clock _clock
+    cdef TimeEventScheduler _scheduler
 
     cdef readonly LoggerAdapter _log
     cdef Logger _logger
 
     cdef dict _exchanges
-    cdef list _data
-    cdef uint64_t _data_len
-    cdef uint64_t _index
+    cdef list _data_streams
+    cdef list _data_cursors
+    cdef list _data_heap
+    cdef list _data_routes
+    cdef DataRoute _route
+    cdef uint64_t _resume_ns
+    cdef BacktestProfiler _profiler
+    cdef dict _profiled_exchanges
+    cdef list _profiled_endpoints
+    cdef list _profiled_handlers
 
     cdef readonly NautilusKernel kernel
     """The internal kernel for the engine.\n\n:returns: `NautilusKernel`"""
@@ -53,5 +80,17 @@ cdef class BacktestEngine:
     cdef readonly datetime backtest_end
     """The last backtest run time range end (if run).\n\n:returns: `datetime` or ``None``"""
 
+    cdef list _merged_data(self)
+    cdef void _seek(self, uint64_t start_ns) except *
+    cdef DataRoute _bind_route(self, DataStream stream)
     cdef Data _next(self)
+    cdef void _process_exchanges(self, list exchanges, uint64_t now_ns) except *
+    cdef void _dispatch(self, DataRoute route, Data data) except *
+    cdef SimulatedExchange _data_exchange(self, DataRoute route, Data data)
+    cdef void _dispatch_exchange(self, DataRoute route, SimulatedExchange exchange, Data data) except *
+    cdef void _dispatch_data(self, DataRoute route, Data data) except *
     cdef void _advance_time(self, uint64_t now_ns) except *
+    cdef void _profiler_attach(self) except *
+    cdef void _profiler_detach(self) except *
+    cdef list _checkpoint_timers(self, Clock clock)
+    cdef void _restore_timers(self, ComponentId component_id, Clock clock, list timers) except *
@@ -13,7 +13,10 @@
 #  limitations under the License.
 # -------------------------------------------------------------------------------------------------
 
+import heapq
 import pickle
+import random
+import zlib
 from decimal import Decimal
 from typing import Dict, List, Optional, Union
 
@@ -29,8 +32,13 @@ from nautilus_trader.config import ExecEngineConfig
 from nautilus_trader.config import RiskEngineConfig
 
 from cpython.datetime cimport datetime
+from libc.stdint cimport UINT64_MAX
 from libc.stdint cimport uint64_t
 
+from nautilus_trader.accounting.accounts.base cimport Account
+from nautilus_trader.accounting.factory cimport AccountFactory
+from nautilus_trader.backtest.data.store cimport DataStream
+from nautilus_trader.backtest.data.store cimport ListDataStream
 from nautilus_trader.backtest.data_client cimport BacktestDataClient
 from nautilus_trader.backtest.data_client cimport BacktestMarketDataClient
 from nautilus_trader.backtest.exchange cimport SimulatedExchange
@@ -38,14 +46,19 @@ from nautilus_trader.backtest.execution_client cimport BacktestExecClient
 from nautilus_trader.backtest.models cimport FillModel
 from nautilus_trader.backtest.models cimport LatencyModel
 from nautilus_trader.backtest.modules cimport SimulationModule
+from nautilus_trader.backtest.profiler cimport BacktestProfiler
 from nautilus_trader.cache.base cimport CacheFacade
+from nautilus_trader.cache.cache cimport Cache
 from nautilus_trader.common.actor cimport Actor
+from nautilus_trader.common.clock cimport Clock
 from nautilus_trader.common.clock cimport LiveClock
+from nautilus_trader.common.clock cimport TimeEventScheduler
 from nautilus_trader.common.logging cimport Logger
 from nautilus_trader.common.logging cimport LoggerAdapter
 from nautilus_trader.common.logging cimport LogLevelParser
 from nautilus_trader.common.logging cimport log_memory
 from nautilus_trader.common.timer cimport TimeEventHandler
+from nautilus_trader.common.timer cimport Timer
 from nautilus_trader.core.correctness cimport Condition
 from nautilus_trader.core.data cimport Data
 from nautilus_trader.core.datetime cimport maybe_dt_to_unix_nanos
@@ -56,21 +69,65 @@ from nautilus_trader.model.c_enums.aggregation_source cimport AggregationSource
 from nautilus_trader.model.c_enums.book_type cimport BookType
 from nautilus_trader.model.c_enums.oms_type cimport OMSType
 from nautilus_trader.model.data.bar cimport Bar
+from nautilus_trader.model.data.bar cimport BarType
 from nautilus_trader.model.data.base cimport GenericData
 from nautilus_trader.model.data.tick cimport QuoteTick
 from nautilus_trader.model.data.tick cimport TradeTick
+from nautilus_trader.model.events.order cimport OrderFilled
 from nautilus_trader.model.identifiers cimport ClientId
+from nautilus_trader.model.identifiers cimport ComponentId
+from nautilus_trader.model.identifiers cimport InstrumentId
+from nautilus_trader.model.identifiers cimport PositionId
 from nautilus_trader.model.identifiers cimport TraderId
 from nautilus_trader.model.identifiers cimport Venue
 from nautilus_trader.model.instruments.base cimport Instrument
 from nautilus_trader.model.objects cimport Currency
 from nautilus_trader.model.orderbook.data cimport OrderBookData
+from nautilus_trader.model.orders.base cimport Order
+from nautilus_trader.model.orders.unpacker cimport OrderUnpacker
+from nautilus_trader.model.position cimport Position
 from nautilus_trader.portfolio.base cimport PortfolioFacade
+from nautilus_trader.serialization.msgpack.serializer cimport MsgPackSerializer
 from nautilus_trader.system.kernel cimport NautilusKernel
 from nautilus_trader.trading.strategy cimport Strategy
 from nautilus_trader.trading.trader cimport Trader
 
 
+cdef int _CHECKPOINT_VERSION = 1
+
+# Strategy handlers timed when profiling
+cdef tuple _PROFILED_HANDLERS = (
+    "on_instrument",
+    "on_order_book",
+    "on_order_book_delta",
+    "on_ticker",
+    "on_quote_tick",
+    "on_trade_tick",
+    "on_bar",
+    "on_data",
+    "on_event",
+)
+
+# Marks a profiled strategy handler which had no instance attribute before wrapping
+cdef object _NO_HANDLER = object()
+
+# Message bus endpoints timed when profiling, as (endpoint, component, handler)
+cdef tuple _PROFILED_ENDPOINTS = (
+    ("RiskEngine.execute", "risk_engine", "execute"),
+    ("ExecEngine.execute", "exec_engine", "execute"),
+    ("ExecEngine.process", "exec_engine", "process"),
+)
+
+
+cdef class DataRoute:
+    """
+    Provides the pre-resolved dispatch for a backtest data stream.
+
+    Bound once per stream at the start of a run, so the main loop does not
+    need to check the type (or look up the venue) of each element.
+    """
+
+
 cdef class BacktestEngine:
     """
     Provides a backtest engine to run a portfolio of strategies over historical
@@ -96,6 +153,7 @@ cdef class BacktestEngine:
 
         # Setup components
         self._clock = LiveClock()  # Real-time for the engine
+        self._scheduler = TimeEventScheduler()  # Shared by actor and strategy clocks
 
         # Run IDs
         self.run_config_id: Optional[str] = None
@@ -104,9 +162,18 @@ cdef class BacktestEngine:
 
         # Exchanges and data
         self._exchanges = {}
-        self._data = []
-        self._data_len = 0
-        self._index = 0
+        self._data_streams = []  # Each added batch is kept as an independently sorted stream
+        self._data_cursors = []
+        self._data_heap = []
+        self._data_routes = []
+        self._route = None
+        self._resume_ns = 0  # Set when restored from a checkpoint
+
+        # Profiling (optional)
+        self._profiler = BacktestProfiler() if config.profile else None
+        self._profiled_exchanges = {}  # type: dict[SimulatedExchange, tuple[str, str]]
+        self._profiled_endpoints = []  # type: list[tuple[str, Callable, ProfiledHandler]]
+        self._profiled_handlers = []  # type: list[tuple[Strategy, str, object]]
 
         # Timing
         self.run_started: Optional[datetime] = None
@@ -129,6 +196,7 @@ cdef class BacktestEngine:
             strategy_configs=config.strategies,
             log_level=LogLevelParser.from_str(config.log_level.upper()),
             bypass_logging=config.bypass_logging,
+            logging_config=config.logging,
         )
 
         # Setup engine logging
@@ -210,7 +278,7 @@ cdef class BacktestEngine:
         """
         The engines internal data stream.
         """
-        return self._data.copy()
+        return self._merged_data()
 
     @property
     def portfolio(self) -> PortfolioFacade:
@@ -255,14 +323,15 @@ cdef class BacktestEngine:
 
         self._log.info(f"Added {instrument.id} Instrument.")
 
-    def add_data(self, list data, ClientId client_id=None) -> None:
+    def add_data(self, data, ClientId client_id=None) -> None:
         """
         Add the given data to the backtest engine.
 
         Parameters
         ----------
-        data : list[Data]
-            The data to add.
+        data : list[Data] or DataStream
+            The data to add. A columnar stream such as `QuoteTickColumns` only
+            materializes each object as it is dispatched.
         client_id : ClientId, optional
             The data client ID to associate with generic data.
 
@@ -283,7 +352,14 @@ cdef class BacktestEngine:
         """
         Condition.not_empty(data, "data")
 
-        first = data[0]
+        cdef DataStream stream
+        if isinstance(data, DataStream):
+            stream = data
+        else:
+            Condition.type(data, list, "data")
+            stream = ListDataStream(data)
+
+        first = stream.get_c(0)
 
         cdef str data_prepend_str = ""
         if hasattr(first, "instrument_id"):
@@ -313,14 +389,14 @@ cdef class BacktestEngine:
             # Check client has been registered
             self._add_data_client_if_not_exists(client_id)
             if isinstance(first, GenericData):
-                data_prepend_str = f"{type(data[0].data).__name__} "
+                data_prepend_str = f"{type(first.data).__name__} "
 
-        # Add data
-        self._data = sorted(self._data + data, key=lambda x: x.ts_init)
+        # Add data as a new sorted stream (merged lazily during the run)
+        self._data_streams.append(stream)
 
         self._log.info(
-            f"Added {len(data):,} {data_prepend_str}"
-            f"{type(first).__name__} element{'' if len(data) == 1 else 's'}.",
+            f"Added {stream.length:,} {data_prepend_str}"
+            f"{type(first).__name__} element{'' if stream.length == 1 else 's'}.",
         )
 
     def dump_pickled_data(self) -> bytes:
@@ -332,7 +408,7 @@ cdef class BacktestEngine:
         bytes
 
         """
-        return pickle.dumps(self._data)
+        return pickle.dumps(self._merged_data())
 
     def load_pickled_data(self, bytes data) -> None:
         """
@@ -352,11 +428,13 @@ cdef class BacktestEngine:
         """
         Condition.not_none(data, "data")
 
-        self._data = pickle.loads(data)
+        cdef list loaded = pickle.loads(data)
+        # An empty stream has no start or end time, so holds no stream at all
+        self._data_streams = [ListDataStream(loaded)] if loaded else []
 
         self._log.info(
-            f"Loaded {len(self._data):,} data "
-            f"element{'' if len(data) == 1 else 's'} from pickle.",
+            f"Loaded {len(loaded):,} data "
+            f"element{'' if len(loaded) == 1 else 's'} from pickle.",
         )
 
     def add_venue(
@@ -516,6 +594,10 @@ cdef class BacktestEngine:
             # End current backtest run
             self._end()
 
+        if self._profiler is not None:
+            self._profiler_detach()
+            self._profiler.reset()
+
         # Change logger clock back to live clock for consistent time stamping
         self.kernel.logger.change_clock_c(self._clock)
 
@@ -551,6 +633,7 @@ cdef class BacktestEngine:
         self.run_finished = None
         self.backtest_start = None
         self.backtest_end = None
+        self._resume_ns = 0
 
         self._log.info("Reset.")
 
@@ -558,9 +641,10 @@ cdef class BacktestEngine:
         """
         Clear the engines internal data stream.
         """
-        self._data.clear()
-        self._data_len = 0
-        self._index = 0
+        self._data_streams.clear()
+        self._data_cursors.clear()
+        self._data_heap.clear()
+        self._data_routes.clear()
 
     def dispose(self) -> None:
         """
@@ -671,6 +755,255 @@ cdef class BacktestEngine:
         """
         self._end()
 
+    def checkpoint(self, str path not None) -> None:
+        """
+        Write the state of the current backtest run to the given file.
+
+        The checkpoint holds the cached accounts, orders and positions (as their
+        serialized events), recent market data, the clock and timers, the
+        simulated exchange books and open orders, the fill model random state
+        and each strategies `save()` state.
+
+        Take a checkpoint between `run_streaming` calls, then call `restore`
+        on an engine set up with the same venues, instruments, data and
+        strategies to continue the run from that point.
+
+        Parameters
+        ----------
+        path : str
+            The path for the checkpoint file.
+
+        Raises
+        ------
+        RuntimeError
+            If there is no backtest run in progress.
+        RuntimeError
+            If an exchange has commands in flight.
+
+        """
+        if not self.kernel.trader.is_running_c():
+            raise RuntimeError("cannot checkpoint: no backtest run in progress")
+
+        cdef MsgPackSerializer serializer = MsgPackSerializer()
+        cdef Cache cache = <Cache>self.kernel.cache
+
+        cdef Account account
+        cdef list accounts = []
+        for account in cache.accounts():
+            accounts.append([serializer.serialize(e) for e in account.events_c()])
+
+        cdef Order order
+        cdef PositionId position_id
+        cdef list orders = []
+        for order in cache.orders():
+            position_id = cache.position_id(order.client_order_id)
+            orders.append((
+                position_id.to_str() if position_id is not None else None,
+                [serializer.serialize(e) for e in order.events_c()],
+            ))
+
+        cdef Position position
+        cdef list positions = []
+        for position in cache.positions():
+            positions.append([serializer.serialize(e) for e in position.events_c()])
+
+        cdef InstrumentId instrument_id
+        cdef BarType bar_type
+        cdef dict quote_ticks = {}
+        cdef dict trade_ticks = {}
+        cdef dict bars = {}
+        for instrument_id in cache.instrument_ids():
+            # Cache returns the most recent first, so reverse to re-add in order
+            quote_ticks[instrument_id.to_str()] = [
+                QuoteTick.to_dict(t) for t in reversed(cache.quote_ticks(instrument_id))
+            ]
+            trade_ticks[instrument_id.to_str()] = [
+                TradeTick.to_dict(t) for t in reversed(cache.trade_ticks(instrument_id))
+            ]
+        for bar_type in self.kernel.data_engine.subscribed_bars():
+            bars[str(bar_type)] = [Bar.to_dict(b) for b in reversed(cache.bars(bar_type))]
+
+        cdef dict timers = {}
+        for actor in self.kernel.trader.actors_c():
+            timers[actor.id.to_str()] = self._checkpoint_timers(actor.clock)
+        for strategy in self.kernel.trader.strategies_c():
+            timers[strategy.id.to_str()] = self._checkpoint_timers(strategy.clock)
+
+        cdef dict state = {
+            "version": _CHECKPOINT_VERSION,
+            "trader_id": self.kernel.trader_id.to_str(),
+            "run_config_id": self.run_config_id,
+            "run_id": self.run_id.to_str(),
+            "iteration": self.iteration,
+            "run_started": maybe_dt_to_unix_nanos(self.run_started),
+            "backtest_start": maybe_dt_to_unix_nanos(self.backtest_start),
+            "ts_now": self.kernel.clock.timestamp_ns(),
+            "counts": (
+                self.kernel.data_engine.command_count,
+                self.kernel.data_engine.data_count,
+                self.kernel.data_engine.request_count,
+                self.kernel.data_engine.response_count,
+                self.kernel.exec_engine.command_count,
+                self.kernel.exec_engine.event_count,
+                self.kernel.exec_engine.report_count,
+                self.kernel.risk_engine.command_count,
+                self.kernel.risk_engine.event_count,
+            ),
+            "random_state": random.getstate(),  # Used by the fill models
+            "accounts": accounts,
+            "orders": orders,
+            "positions": positions,
+            "position_snapshots": {k.to_str(): v for k, v in cache._position_snapshots.items()},
+            "quote_ticks": quote_ticks,
+            "trade_ticks": trade_ticks,
+            "bars": bars,
+            "exchanges": {k.to_str(): v.checkpoint_state() for k, v in self._exchanges.items()},
+            "strategies": {s.id.to_str(): s.save() for s in self.kernel.trader.strategies_c()},
+            "timers": timers,
+        }
+
+        with open(path, "wb") as f:
+            f.write(zlib.compress(pickle.dumps(state, protocol=pickle.HIGHEST_PROTOCOL)))
+
+        self._log.info(f"Checkpoint written to {path}.")
+
+    def restore(self, str path not None) -> None:
+        """
+        Restore the state of a backtest run from the given checkpoint file.
+
+        The engine must be set up with the same venues, instruments, data and
+        strategies as the engine which wrote the checkpoint, and not yet run.
+        The trader is started (so strategies subscribe again in `on_start`),
+        then the next `run` or `run_streaming` without a `start` continues from
+        just after the checkpoint.
+
+        Parameters
+        ----------
+        path : str
+            The path of the checkpoint file.
+
+        Raises
+        ------
+        ValueError
+            If the engine has already been run.
+        ValueError
+            If the checkpoint is from another version or trader.
+
+        """
+        Condition.true(self.iteration == 0, "engine has already been run")
+        Condition.true(not self.kernel.trader.is_running_c(), "trader is running")
+
+        with open(path, "rb") as f:
+            state = pickle.loads(zlib.decompress(f.read()))
+
+        Condition.equal(state["version"], _CHECKPOINT_VERSION, "version", "_CHECKPOINT_VERSION")
+        Condition.equal(
+            state["trader_id"],
+            self.kernel.trader_id.to_str(),
+            "trader_id",
+            "self.trader_id",
+        )
+
+        cdef uint64_t ts_now = state["ts_now"]
+        cdef Strategy strategy
+
+        # Set clocks
+        self.kernel.clock.set_time(ts_now)
+        for actor in self.kernel.trader.actors_c():
+            self._scheduler.register_clock(actor.clock)
+        for strategy in self.kernel.trader.strategies_c():
+            self._scheduler.register_clock(strategy.clock)
+        self._scheduler.set_time(ts_now)
+
+        # Rebuild the cache by replaying events (as for a cache database)
+        cdef MsgPackSerializer serializer = MsgPackSerializer()
+        cdef Cache cache = <Cache>self.kernel.cache
+
+        cdef list events
+        cdef Account account
+        for events in state["accounts"]:
+            account = AccountFactory.create_c(serializer.deserialize(events[0]))
+            for event in events[1:]:
+                account.apply(serializer.deserialize(event))
+            cache.add_account(account)
+
+        cdef Order order
+        for value, events in state["orders"]:
+            order = OrderUnpacker.from_init_c(serializer.deserialize(events[0]))
+            for event in events[1:]:
+                order.apply(serializer.deserialize(event))
+            cache.add_order(order, PositionId(value) if value is not None else None)
+
+        cdef OrderFilled fill
+        cdef Position position
+        for events in state["positions"]:
+            fill = serializer.deserialize(events[0])
+            position = Position(cache.instrument(fill.instrument_id), fill)
+            for event in events[1:]:
+                position.apply(serializer.deserialize(event))
+            cache.add_position(position, self._exchanges[fill.instrument_id.venue].oms_type)
+
+        for key, snapshots in state["position_snapshots"].items():
+            cache._position_snapshots[PositionId(key)] = snapshots
+
+        cache.build_index()
+        cache.check_integrity()
+        self.kernel.exec_engine._set_position_id_counts()
+
+        for ticks in state["quote_ticks"].values():
+            cache.add_quote_ticks([QuoteTick.from_dict(t) for t in ticks])
+        for ticks in state["trade_ticks"].values():
+            cache.add_trade_ticks([TradeTick.from_dict(t) for t in ticks])
+        for bars in state["bars"].values():
+            cache.add_bars([Bar.from_dict(b) for b in bars])
+
+        cdef SimulatedExchange exchange
+        for exchange in self._exchanges.values():
+            exchange.restore_state(state["exchanges"][exchange.id.to_str()])
+        random.setstate(state["random_state"])
+
+        # Restore run
+        self.run_config_id = state["run_config_id"]
+        self.run_id = UUID4(state["run_id"])
+        self.iteration = state["iteration"]
+        self.run_started = unix_nanos_to_dt(state["run_started"])
+        self.backtest_start = unix_nanos_to_dt(state["backtest_start"])
+        self._resume_ns = ts_now + 1
+
+        for strategy in self.kernel.trader.strategies_c():
+            strategy.order_factory.set_count(len(cache.client_order_ids(None, None, strategy.id)))
+            strategy.load(state["strategies"].get(strategy.id.to_str(), {}))
+
+        self.kernel.portfolio.initialize_orders()
+        self.kernel.portfolio.initialize_positions()
+
+        self.kernel.data_engine.start()
+        self.kernel.exec_engine.start()
+        self.kernel.trader.start()
+        # Change logger clock for the run
+        self.kernel.logger.change_clock_c(self.kernel.clock)
+
+        # Timers set again in `on_start` are replaced with their checkpointed schedule
+        for actor in self.kernel.trader.actors_c():
+            self._restore_timers(actor.id, actor.clock, state["timers"].get(actor.id.to_str(), []))
+        for strategy in self.kernel.trader.strategies_c():
+            self._restore_timers(strategy.id, strategy.clock, state["timers"].get(strategy.id.to_str(), []))
+
+        # Counts include the commands replayed by `on_start`
+        (
+            self.kernel.data_engine.command_count,
+            self.kernel.data_engine.data_count,
+            self.kernel.data_engine.request_count,
+            self.kernel.data_engine.response_count,
+            self.kernel.exec_engine.command_count,
+            self.kernel.exec_engine.event_count,
+            self.kernel.exec_engine.report_count,
+            self.kernel.risk_engine.command_count,
+            self.kernel.risk_engine.event_count,
+        ) = state["counts"]
+
+        self._log.info(f"Restored checkpoint from {path}.")
+
     def get_result(self):
         """
         Return the backtest result from the last run.
@@ -702,40 +1035,70 @@ cdef class BacktestEngine:
             total_positions=self.kernel.cache.positions_total_count(),
             stats_pnls=stats_pnls,
             stats_returns=self.kernel.portfolio.analyzer.get_performance_stats_returns(),
+            profile=self._profile_result(),
         )
 
+    def _profile_result(self):
+        if self._profiler is None:
+            return None
+
+        cdef double wall_secs = self._profiler.wall_ns / 1e9
+        cdef int events = self.kernel.exec_engine.event_count
+        cdef dict profile = {
+            "run": {
+                "wall_secs": wall_secs,
+                "cpu_secs": self._profiler.cpu_ns / 1e9,
+                "iterations": self.iteration,
+                "iterations_per_sec": self.iteration / wall_secs if wall_secs else 0.0,
+                "events": events,
+                "events_per_sec": events / wall_secs if wall_secs else 0.0,
+            },
+        }
+        profile.update(self._profiler.breakdown())
+        return profile
+
     def _run(
         self,
         start: Union[datetime, str, int]=None,
         end: Union[datetime, str, int]=None,
         run_config_id: str=None,
     ):
+        Condition.not_empty(self._data_streams, "data")
+
+        cdef uint64_t data_start_ns = UINT64_MAX
+        cdef uint64_t data_end_ns = 0
+        cdef DataStream stream
+        for stream in self._data_streams:
+            data_start_ns = min(data_start_ns, stream.ts_init_c(0))
+            data_end_ns = max(data_end_ns, stream.ts_init_c(stream.length - 1))
+
         cdef uint64_t start_ns
         cdef uint64_t end_ns
         # Time range check and set
         if start is None:
-            # Set `start` to start of data
-            start_ns = self._data[0].ts_init
+            # Set `start` to start of data (or just after a restored checkpoint)
+            start_ns = max(data_start_ns, self._resume_ns)
             start = unix_nanos_to_dt(start_ns)
         else:
             start = pd.to_datetime(start, utc=True)
             start_ns = int(start.to_datetime64())
         if end is None:
             # Set `end` to end of data
-            end_ns = self._data[-1].ts_init
+            end_ns = data_end_ns
             end = unix_nanos_to_dt(end_ns)
         else:
             end = pd.to_datetime(end, utc=True)
             end_ns = int(end.to_datetime64())
         Condition.true(start_ns < end_ns, "start was >= end")
-        Condition.not_empty(self._data, "data")
+        self._resume_ns = 0
 
         # Set clocks
         self.kernel.clock.set_time(start_ns)
         for actor in self.kernel.trader.actors_c():
-            actor.clock.set_time(start_ns)
+            self._scheduler.register_clock(actor.clock)
         for strategy in self.kernel.trader.strategies_c():
-            strategy.clock.set_time(start_ns)
+            self._scheduler.register_clock(strategy.clock)
+        self._scheduler.set_time(start_ns)
 
         cdef SimulatedExchange exchange
         if self.iteration == 0:
@@ -755,33 +1118,24 @@ cdef class BacktestEngine:
 
         self._log_run(start, end)
 
-        # Set data stream length
-        self._data_len = len(self._data)
+        # Set starting cursors, merge heap and data routes
+        self._seek(start_ns)
 
-        # Set starting index
-        cdef uint64_t i
-        for i in range(self._data_len):
-            if start_ns <= self._data[i].ts_init:
-                self._index = i
-                break
+        if self._profiler is not None:
+            self._profiler_attach()
+            self._profiler.start()
+
+        cdef list exchanges = list(self._exchanges.values())
+        cdef Data data
 
         # -- MAIN BACKTEST LOOP -----------------------------------------------#
-        cdef Data data = self._next()
+        data = self._next()
         while data is not None:
             if data.ts_init > end_ns:
                 break
             self._advance_time(data.ts_init)
-            if isinstance(data, OrderBookData):
-                self._exchanges[data.instrument_id.venue].process_order_book(data)
-            elif isinstance(data, QuoteTick):
-                self._exchanges[data.instrument_id.venue].process_quote_tick(data)
-            elif isinstance(data, TradeTick):
-                self._exchanges[data.instrument_id.venue].process_trade_tick(data)
-            elif isinstance(data, Bar):
-                self._exchanges[data.type.instrument_id.venue].process_bar(data)
-            self.kernel.data_engine.process(data)
-            for exchange in self._exchanges.values():
-                exchange.process(data.ts_init)
+            self._dispatch(self._route, data)
+            self._process_exchanges(exchanges, data.ts_init)
             self.iteration += 1
             data = self._next()
         # ---------------------------------------------------------------------#
@@ -790,6 +1144,9 @@ cdef class BacktestEngine:
             exchange.process(self.kernel.clock.timestamp_ns())
         # ---------------------------------------------------------------------#
 
+        if self._profiler is not None:
+            self._profiler.stop()
+
     def _end(self):
         self.kernel.trader.stop()
         # Process remaining messages
@@ -801,27 +1158,255 @@ cdef class BacktestEngine:
 
         self._log_post_run()
 
+    cdef list _merged_data(self):
+        cdef list lists = [stream.to_list() for stream in self._data_streams]
+        if len(lists) == 1:
+            return lists[0]
+        return list(heapq.merge(*lists, key=lambda x: x.ts_init))
+
+    cdef void _seek(self, uint64_t start_ns) except *:
+        self._data_cursors = []
+        self._data_heap = []
+        self._data_routes = []
+
+        cdef int i
+        cdef DataStream stream
+        cdef uint64_t cursor
+        for i, stream in enumerate(self._data_streams):
+            self._data_routes.append(self._bind_route(stream))
+            cursor = stream.bisect_c(start_ns)
+            self._data_cursors.append(cursor)
+            if cursor < stream.length:
+                # Ties on `ts_init` resolve to the earlier added stream
+                self._data_heap.append((stream.ts_init_c(cursor), i))
+
+        heapq.heapify(self._data_heap)
+
+    cdef DataRoute _bind_route(self, DataStream stream):
+        cdef DataRoute route = DataRoute()
+        cdef type data_type = stream.data_type
+        if data_type is None:
+            route.kind = DataRouteKind.ROUTE_DYNAMIC
+            return route  # Mixed types are resolved per element
+        elif issubclass(data_type, OrderBookData):
+            route.kind = DataRouteKind.ROUTE_ORDER_BOOK
+        elif issubclass(data_type, QuoteTick):
+            route.kind = DataRouteKind.ROUTE_QUOTE_TICK
+        elif issubclass(data_type, TradeTick):
+            route.kind = DataRouteKind.ROUTE_TRADE_TICK
+        elif issubclass(data_type, Bar):
+            route.kind = DataRouteKind.ROUTE_BAR
+        else:
+            route.kind = DataRouteKind.ROUTE_DATA
+            return route  # Data engine only
+
+        # Streams without a known venue resolve their exchange per element
+        if stream.venue is not None:
+            route.exchange = self._exchanges[stream.venue]
+        return route
+
     cdef Data _next(self):
-        cdef uint64_t cursor = self._index
-        self._index += 1
-        if cursor < self._data_len:
-            return self._data[cursor]
+        if not self._data_heap:
+            return None
+
+        cdef int i = self._data_heap[0][1]
+        self._route = self._data_routes[i]
+        cdef DataStream stream = self._data_streams[i]
+        cdef uint64_t cursor = self._data_cursors[i]
+        cdef Data data = stream.get_c(cursor)  # Materialized only when dispatched
+
+        cursor += 1
+        self._data_cursors[i] = cursor
+        if cursor < stream.length:
+            heapq.heapreplace(self._data_heap, (stream.ts_init_c(cursor), i))
+        else:
+            heapq.heappop(self._data_heap)
+
+        return data
+
+    cdef void _process_exchanges(self, list exchanges, uint64_t now_ns) except *:
+        cdef SimulatedExchange exchange
+        for exchange in exchanges:
+            if exchange.is_idle_c(now_ns):
+                continue
+            if self._profiler is None:
+                exchange.process(now_ns)
+            else:
+                self._profiler.enter(self._profiled_exchanges[exchange][1])
+                exchange.process(now_ns)
+                self._profiler.exit()
+
+    cdef void _dispatch(self, DataRoute route, Data data) except *:
+        cdef SimulatedExchange exchange = self._data_exchange(route, data)
+        if exchange is not None:
+            self._dispatch_exchange(route, exchange, data)
+        self._dispatch_data(route, data)
+
+    cdef SimulatedExchange _data_exchange(self, DataRoute route, Data data):
+        if route.exchange is not None:
+            return route.exchange
+        elif route.kind == DataRouteKind.ROUTE_DATA:
+            return None  # Data engine only
+        elif route.kind == DataRouteKind.ROUTE_BAR:
+            return self._exchanges[data.type.instrument_id.venue]
+        elif route.kind != DataRouteKind.ROUTE_DYNAMIC:
+            return self._exchanges[data.instrument_id.venue]
+        elif isinstance(data, (OrderBookData, QuoteTick, TradeTick)):
+            return self._exchanges[data.instrument_id.venue]
+        elif isinstance(data, Bar):
+            return self._exchanges[data.type.instrument_id.venue]
+        else:
+            return None  # Data engine only
+
+    cdef void _dispatch_exchange(
+        self,
+        DataRoute route,
+        SimulatedExchange exchange,
+        Data data,
+    ) except *:
+        if self._profiler is not None:
+            self._profiler.enter(self._profiled_exchanges[exchange][0])
+
+        if route.kind == DataRouteKind.ROUTE_QUOTE_TICK:
+            exchange.process_quote_tick(data)
+        elif route.kind == DataRouteKind.ROUTE_TRADE_TICK:
+            exchange.process_trade_tick(data)
+        elif route.kind == DataRouteKind.ROUTE_ORDER_BOOK:
+            exchange.process_order_book(data)
+        elif route.kind == DataRouteKind.ROUTE_BAR:
+            exchange.process_bar(data)
+        elif isinstance(data, OrderBookData):
+            exchange.process_order_book(data)
+        elif isinstance(data, QuoteTick):
+            exchange.process_quote_tick(data)
+        elif isinstance(data, TradeTick):
+            exchange.process_trade_tick(data)
+        elif isinstance(data, Bar):
+            exchange.process_bar(data)
+
+        if self._profiler is not None:
+            self._profiler.exit()
+
+    cdef void _dispatch_data(self, DataRoute route, Data data) except *:
+        if self._profiler is not None:
+            self._profiler.enter("data_engine")
+
+        if route.kind == DataRouteKind.ROUTE_QUOTE_TICK:
+            self.kernel.data_engine.process_quote_tick_c(data)
+        elif route.kind == DataRouteKind.ROUTE_TRADE_TICK:
+            self.kernel.data_engine.process_trade_tick_c(data)
+        elif route.kind == DataRouteKind.ROUTE_ORDER_BOOK:
+            self.kernel.data_engine.process_order_book_data_c(data)
+        elif route.kind == DataRouteKind.ROUTE_BAR:
+            self.kernel.data_engine.process_bar_c(data)
+        else:
+            self.kernel.data_engine.process(data)
+
+        if self._profiler is not None:
+            self._profiler.exit()
 
     cdef void _advance_time(self, uint64_t now_ns) except *:
-        cdef list time_events = []  # type: list[TimeEventHandler]
-        cdef:
-            Actor actor
-            Strategy strategy
-            cdef TimeEventHandler event_handler
-        for actor in self.kernel.trader.actors_c():
-            time_events += actor.clock.advance_time(now_ns)
-        for strategy in self.kernel.trader.strategies_c():
-            time_events += strategy.clock.advance_time(now_ns)
-        for event_handler in sorted(time_events):
-            self.kernel.clock.set_time(event_handler.event.ts_event)
+        if self._profiler is not None:
+            self._profiler.enter("advance_time")
+
+        # Events for all actor and strategy timers are returned already sorted
+        cdef TimeEventHandler event_handler
+        for event_handler in self._scheduler.advance_time(now_ns):
+            self.kernel.clock.set_time(event_handler.ts_event)
             event_handler.handle()
         self.kernel.clock.set_time(now_ns)
 
+        if self._profiler is not None:
+            self._profiler.exit()
+
+    cdef void _profiler_attach(self) except *:
+        cdef SimulatedExchange exchange
+        for exchange in self._exchanges.values():
+            self._profiled_exchanges[exchange] = (
+                f"exchange.{exchange.id.to_str()}.data",
+                f"exchange.{exchange.id.to_str()}.process",
+            )
+
+        # Wrap only strategies not already wrapped (some may be added between runs)
+        cdef set profiled = {entry[0].id for entry in self._profiled_handlers}
+        cdef Strategy strategy
+        cdef str prefix
+        for strategy in self.kernel.trader.strategies_c():
+            if strategy.id in profiled:
+                continue
+            if not hasattr(strategy, "__dict__"):
+                continue  # Compiled without an instance dictionary so cannot be timed
+            prefix = f"strategy.{strategy.id.to_str()}"
+            for name in _PROFILED_HANDLERS:
+                self._profiled_handlers.append(
+                    (strategy, name, strategy.__dict__.get(name, _NO_HANDLER)),
+                )
+                setattr(
+                    strategy,
+                    name,
+                    self._profiler.wrap(f"{prefix}.{name}", getattr(strategy, name)),
+                )
+
+        if self._profiled_endpoints:
+            return  # Endpoints already wrapped for this run
+
+        for endpoint, component, name in _PROFILED_ENDPOINTS:
+            handler = getattr(getattr(self.kernel, component), name)
+            wrapped = self._profiler.wrap(component, handler)
+            self.kernel.msgbus.deregister(endpoint, handler)
+            self.kernel.msgbus.register(endpoint, wrapped)
+            self._profiled_endpoints.append((endpoint, handler, wrapped))
+
+    cdef void _profiler_detach(self) except *:
+        # Restore only the handlers which were wrapped, as they were before
+        cdef Strategy strategy
+        for strategy, name, original in self._profiled_handlers:
+            if original is _NO_HANDLER:
+                strategy.__dict__.pop(name, None)
+            else:
+                strategy.__dict__[name] = original
+
+        for endpoint, handler, wrapped in self._profiled_endpoints:
+            self.kernel.msgbus.deregister(endpoint, wrapped)
+            self.kernel.msgbus.register(endpoint, handler)
+
+        self._profiled_exchanges.clear()
+        self._profiled_endpoints.clear()
+        self._profiled_handlers.clear()
+
+    cdef list _checkpoint_timers(self, Clock clock):
+        cdef list timers = []
+        cdef Timer timer
+        for name in clock.timer_names():
+            timer = clock.timer(name)
+            timers.append((name, timer.interval_ns, timer.next_time_ns, timer.stop_time_ns))
+        return timers
+
+    cdef void _restore_timers(self, ComponentId component_id, Clock clock, list timers) except *:
+        # Keep the callbacks of timers set again on start, otherwise the
+        # clocks default handler receives the events
+        cdef dict callbacks = {}
+        for name in clock.timer_names():
+            callbacks[name] = clock.timer(name).callback
+            clock.cancel_timer(name)
+
+        cdef uint64_t interval_ns
+        cdef uint64_t next_time_ns
+        cdef uint64_t stop_time_ns
+        for name, interval_ns, next_time_ns, stop_time_ns in timers:
+            if name not in callbacks:
+                self._log.warning(
+                    f"Timer '{name}' for {component_id} was not set again on start, "
+                    f"its events will be sent to the default handler.",
+                )
+            clock.set_timer(
+                name=name,
+                interval=pd.Timedelta(interval_ns, unit="ns"),
+                start_time=unix_nanos_to_dt(next_time_ns - interval_ns),
+                stop_time=unix_nanos_to_dt(stop_time_ns) if stop_time_ns else None,
+                callback=callbacks.get(name),
+            )
+
     def _log_pre_run(self):
         log_memory(self._log)
 
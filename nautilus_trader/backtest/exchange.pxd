@@ -17,6 +17,7 @@ from libc.stdint cimport uint64_t
 
 from nautilus_trader.accounting.accounts.base cimport Account
 from nautilus_trader.backtest.execution_client cimport BacktestExecClient
+from nautilus_trader.backtest.matching_core cimport OrderMatchingCore
 from nautilus_trader.backtest.models cimport FillModel
 from nautilus_trader.backtest.models cimport LatencyModel
 from nautilus_trader.cache.cache cimport Cache
@@ -46,6 +47,7 @@ from nautilus_trader.model.objects cimport Price
 from nautilus_trader.model.objects cimport Quantity
 from nautilus_trader.model.orderbook.book cimport OrderBook
 from nautilus_trader.model.orderbook.data cimport OrderBookData
+from nautilus_trader.model.orderbook.simulated cimport SimulatedL1OrderBook
 from nautilus_trader.model.orders.base cimport Order
 from nautilus_trader.model.orders.limit cimport LimitOrder
 from nautilus_trader.model.orders.market cimport MarketOrder
@@ -99,8 +101,7 @@ cdef class SimulatedExchange:
     cdef dict _last_bid_bars
     cdef dict _last_ask_bars
     cdef dict _order_index
-    cdef dict _orders_bid
-    cdef dict _orders_ask
+    cdef dict _matching_cores
     cdef dict _oto_orders
     cdef bint _bar_execution
 
@@ -109,7 +110,7 @@ cdef class SimulatedExchange:
     cdef int _executions_count
     cdef Queue _message_queue
     cdef list _inflight_queue
-    cdef dict _inflight_counter
+    cdef uint64_t _inflight_seq
 
     cpdef Price best_bid_price(self, InstrumentId instrument_id)
     cpdef Price best_ask_price(self, InstrumentId instrument_id)
@@ -131,10 +132,16 @@ cdef class SimulatedExchange:
     cpdef void process_quote_tick(self, QuoteTick tick) except *
     cpdef void process_trade_tick(self, TradeTick tick) except *
     cpdef void process_bar(self, Bar bar) except *
-    cdef void _process_trade_ticks_from_bar(self, OrderBook book, Bar bar) except *
-    cdef void _process_quote_ticks_from_bar(self, OrderBook book) except *
+    cdef void _process_trade_ticks_from_bar(self, SimulatedL1OrderBook book, Bar bar) except *
+    cdef void _process_trade_from_bar(self, SimulatedL1OrderBook book, Price price, double size, uint64_t timestamp_ns) except *
+    cdef void _process_quote_ticks_from_bar(self, SimulatedL1OrderBook book) except *
+    cdef double _bar_tick_size(self, Bar bar) except *
+    cdef bint is_idle_c(self, uint64_t now_ns) except *
     cpdef void process(self, uint64_t now_ns) except *
     cpdef void reset(self) except *
+    cpdef dict checkpoint_state(self)
+    cpdef void restore_state(self, dict state) except *
+    cdef void _restore_orders(self, dict client_order_ids) except *
 
 # -- COMMAND HANDLING -----------------------------------------------------------------------------
 
@@ -160,6 +167,7 @@ cdef class SimulatedExchange:
 
     cdef void _add_order(self, Order order) except *
     cdef void _delete_order(self, Order order) except *
+    cdef void _reindex_order(self, Order order) except *
     cdef void _iterate_matching_engine(self, InstrumentId instrument_id, uint64_t timestamp_ns) except *
     cdef void _iterate_side(self, list orders, uint64_t timestamp_ns) except *
     cdef void _match_order(self, Order order) except *
@@ -14,24 +14,29 @@
 # -------------------------------------------------------------------------------------------------
 
 from decimal import Decimal
+from heapq import heappop
 from heapq import heappush
 from typing import Dict
 
 from libc.limits cimport INT_MAX
 from libc.limits cimport INT_MIN
-from libc.stdint cimport int64_t
 from libc.stdint cimport uint64_t
 
 from nautilus_trader.accounting.accounts.base cimport Account
 from nautilus_trader.backtest.execution_client cimport BacktestExecClient
+from nautilus_trader.backtest.matching_core cimport OrderMatchingCore
 from nautilus_trader.backtest.models cimport FillModel
 from nautilus_trader.backtest.models cimport LatencyModel
 from nautilus_trader.backtest.modules cimport SimulationModule
 from nautilus_trader.cache.base cimport CacheFacade
 from nautilus_trader.common.clock cimport TestClock
+from nautilus_trader.common.logging cimport LogLevel
 from nautilus_trader.common.logging cimport Logger
 from nautilus_trader.common.queue cimport Queue
 from nautilus_trader.core.correctness cimport Condition
+from nautilus_trader.core.rust.model cimport FIXED_SCALAR
+from nautilus_trader.core.rust.model cimport Quantity_t
+from nautilus_trader.core.rust.model cimport quantity_new
 from nautilus_trader.execution.messages cimport CancelAllOrders
 from nautilus_trader.execution.messages cimport CancelOrder
 from nautilus_trader.execution.messages cimport ModifyOrder
@@ -40,7 +45,6 @@ from nautilus_trader.execution.messages cimport SubmitOrderList
 from nautilus_trader.execution.messages cimport TradingCommand
 from nautilus_trader.model.c_enums.account_type cimport AccountType
 from nautilus_trader.model.c_enums.account_type cimport AccountTypeParser
-from nautilus_trader.model.c_enums.aggressor_side cimport AggressorSide
 from nautilus_trader.model.c_enums.book_type cimport BookType
 from nautilus_trader.model.c_enums.contingency_type cimport ContingencyType
 from nautilus_trader.model.c_enums.depth_type cimport DepthType
@@ -69,6 +73,9 @@ from nautilus_trader.model.objects cimport Price
 from nautilus_trader.model.objects cimport Quantity
 from nautilus_trader.model.orderbook.book cimport OrderBook
 from nautilus_trader.model.orderbook.data cimport Order as OrderBookOrder
+from nautilus_trader.model.orderbook.data cimport OrderBookSnapshot
+from nautilus_trader.model.orderbook.level cimport Level
+from nautilus_trader.model.orderbook.simulated cimport SimulatedL1OrderBook
 from nautilus_trader.model.orders.base cimport Order
 from nautilus_trader.model.orders.limit cimport LimitOrder
 from nautilus_trader.model.orders.market cimport MarketOrder
@@ -215,16 +222,15 @@ cdef class SimulatedExchange:
         self._last_bid_bars = {}  # type: dict[InstrumentId, Bar]
         self._last_ask_bars = {}  # type: dict[InstrumentId, Bar]
         self._order_index = {}    # type: dict[ClientOrderId, Order]
-        self._orders_bid = {}     # type: dict[InstrumentId, list[Order]]
-        self._orders_ask = {}     # type: dict[InstrumentId, list[Order]]
+        self._matching_cores = {}  # type: dict[InstrumentId, OrderMatchingCore]
         self._oto_orders = {}     # type: dict[ClientOrderId]
 
         self._symbol_pos_count = {}  # type: dict[InstrumentId, int]
         self._symbol_ord_count = {}  # type: dict[InstrumentId, int]
         self._executions_count = 0
         self._message_queue = Queue()
-        self._inflight_queue = []
-        self._inflight_counter = {}
+        self._inflight_queue = []  # Heap of (ts_arrival, seq, command)
+        self._inflight_seq = 0
 
     def __repr__(self) -> str:
         return (
@@ -362,13 +368,14 @@ cdef class SimulatedExchange:
 
         """
         cdef list bids = []
+        cdef OrderMatchingCore core
         if instrument_id is None:
-            for orders in self._orders_bid.values():
-                for o in orders:
-                    bids.append(o)
+            for core in self._matching_cores.values():
+                bids += core.orders_bid()
             return bids
         else:
-            return [o for o in self._orders_bid.get(instrument_id, [])]
+            core = self._matching_cores.get(instrument_id)
+            return core.orders_bid() if core is not None else bids
 
     cpdef list get_open_ask_orders(self, InstrumentId instrument_id=None):
         """
@@ -385,13 +392,14 @@ cdef class SimulatedExchange:
 
         """
         cdef list asks = []
+        cdef OrderMatchingCore core
         if instrument_id is None:
-            for orders in self._orders_ask.values():
-                for o in orders:
-                    asks.append(o)
+            for core in self._matching_cores.values():
+                asks += core.orders_ask()
             return asks
         else:
-            return [o for o in self._orders_ask.get(instrument_id, [])]
+            core = self._matching_cores.get(instrument_id)
+            return core.orders_ask() if core is not None else asks
 
     cpdef Account get_account(self):
         """
@@ -523,20 +531,9 @@ cdef class SimulatedExchange:
             heappush(self._inflight_queue, self.generate_inflight_command(command))
 
     cdef tuple generate_inflight_command(self, TradingCommand command):
-        cdef int64_t ts
-        if isinstance(command, (SubmitOrder, SubmitOrderList)):
-            ts = command.ts_init + self.latency_model.insert_latency_nanos
-        elif isinstance(command, ModifyOrder):
-            ts = command.ts_init + self.latency_model.update_latency_nanos
-        elif isinstance(command, (CancelOrder, CancelAllOrders)):
-            ts = command.ts_init + self.latency_model.cancel_latency_nanos
-        else:  # pragma: no cover (design-time error)
-            raise ValueError(f"invalid command, was {command}")
-        if ts not in self._inflight_counter:
-            self._inflight_counter[ts] = 0
-        self._inflight_counter[ts] += 1
-        cdef (int64_t, int64_t) key = (ts, self._inflight_counter[ts])
-        return key, command
+        cdef uint64_t ts = command.ts_init + self.latency_model.latency_nanos(command)
+        self._inflight_seq += 1  # Commands arriving together are processed in send order
+        return ts, self._inflight_seq, command
 
     cpdef void process_order_book(self, OrderBookData data) except *:
         """
@@ -558,7 +555,7 @@ cdef class SimulatedExchange:
             data.ts_init,
         )
 
-        if not self._log.is_bypassed:
+        if self._log.is_enabled(LogLevel.DEBUG):
             self._log.debug(f"Processed {data}")
 
     cpdef void process_quote_tick(self, QuoteTick tick) except *:
@@ -586,7 +583,7 @@ cdef class SimulatedExchange:
             tick.ts_init,
         )
 
-        if not self._log.is_bypassed:
+        if self._log.is_enabled(LogLevel.DEBUG):
             self._log.debug(f"Processed {tick}")
 
     cpdef void process_trade_tick(self, TradeTick tick) except *:
@@ -614,7 +611,7 @@ cdef class SimulatedExchange:
             tick.ts_init,
         )
 
-        if not self._log.is_bypassed:
+        if self._log.is_enabled(LogLevel.DEBUG):
             self._log.debug(f"Processed {tick}")
 
     cpdef void process_bar(self, Bar bar) except *:
@@ -640,84 +637,72 @@ cdef class SimulatedExchange:
         # Turn ON bar execution mode (temporary until unify execution)
         self._bar_execution = True
 
+        cdef SimulatedL1OrderBook l1_book = <SimulatedL1OrderBook?>book
         cdef PriceType price_type = bar.type.spec.price_type
         if price_type == PriceType.LAST or price_type == PriceType.MID:
-            self._process_trade_ticks_from_bar(book, bar)
+            self._process_trade_ticks_from_bar(l1_book, bar)
         elif price_type == PriceType.BID:
             self._last_bid_bars[bar.type.instrument_id] = bar
-            self._process_quote_ticks_from_bar(book)
+            self._process_quote_ticks_from_bar(l1_book)
         elif price_type == PriceType.ASK:
             self._last_ask_bars[bar.type.instrument_id] = bar
-            self._process_quote_ticks_from_bar(book)
+            self._process_quote_ticks_from_bar(l1_book)
         else:  # pragma: no cover (design-time error)
             raise RuntimeError("invalid price type")
 
-        if not self._log.is_bypassed:
+        if self._log.is_enabled(LogLevel.DEBUG):
             self._log.debug(f"Processed {bar}")
 
-    cdef void _process_trade_ticks_from_bar(self, OrderBook book, Bar bar) except *:
-        cdef Quantity size = Quantity(bar.volume.as_f64_c() / 4.0, bar.volume._mem.precision)
+    cdef void _process_trade_ticks_from_bar(self, SimulatedL1OrderBook book, Bar bar) except *:
+        # Simulates the OHLC path of the bar as trades, updating the book
+        # directly from the bars raw values so no ticks are allocated
+        cdef double size = self._bar_tick_size(bar)
         cdef Price last = self._last.get(book.instrument_id)
 
-        # Create reusable tick
-        cdef TradeTick tick = TradeTick(
-            bar.type.instrument_id,
-            bar.open,
-            size,
-            <OrderSide>AggressorSide.BUY if last is None or bar.open._mem.raw > last._mem.raw else <OrderSide>AggressorSide.SELL,
-            self._generate_trade_id(),
-            bar.ts_event,
-            bar.ts_event,
-        )
+        # Synthetic trade IDs are counted (to keep execution IDs stable) but not
+        # built. A trade ID is always counted for the open, even when the open
+        # trade is skipped.
+        self._executions_count += 1
 
         # Open
         if last is None or bar.open._mem.raw != last._mem.raw:  # Direct memory comparison
-            book.update_trade_tick(tick)
-            self._iterate_matching_engine(
-                tick.instrument_id,
-                tick.ts_init,
-            )
+            self._process_trade_from_bar(book, bar.open, size, bar.ts_event)
             last = bar.open
 
         # High
         if bar.high._mem.raw > last._mem.raw:  # Direct memory comparison
-            tick._mem.price = bar.high._mem  # Direct memory assignment
-            tick._mem.aggressor_side = <OrderSide>AggressorSide.BUY  # Direct memory assignment
-            tick._mem.trade_id = self._generate_trade_id()._mem
-            book.update_trade_tick(tick)
-            self._iterate_matching_engine(
-                tick.instrument_id,
-                tick.ts_init,
-            )
+            self._executions_count += 1
+            self._process_trade_from_bar(book, bar.high, size, bar.ts_event)
             last = bar.high
 
         # Low
         if bar.low._mem.raw < last._mem.raw:  # Direct memory comparison
-            tick._mem.price = bar.low._mem  # Direct memory assignment
-            tick._mem.aggressor_side = <OrderSide>AggressorSide.SELL
-            tick._mem.trade_id = self._generate_trade_id()._mem
-            book.update_trade_tick(tick)
-            self._iterate_matching_engine(
-                tick.instrument_id,
-                tick.ts_init,
-            )
+            self._executions_count += 1
+            self._process_trade_from_bar(book, bar.low, size, bar.ts_event)
             last = bar.low
 
         # Close
         if bar.close._mem.raw != last._mem.raw:  # Direct memory comparison
-            tick._mem.price = bar.close._mem  # Direct memory assignment
-            tick._mem.aggressor_side = <OrderSide>AggressorSide.BUY if bar.close._mem.raw > last._mem.raw else <OrderSide>AggressorSide.SELL
-            tick._mem.trade_id = self._generate_trade_id()._mem
-            book.update_trade_tick(tick)
-            self._iterate_matching_engine(
-                tick.instrument_id,
-                tick.ts_init,
-            )
+            self._executions_count += 1
+            self._process_trade_from_bar(book, bar.close, size, bar.ts_event)
             last = bar.close
 
         self._last[book.instrument_id] = last
 
-    cdef void _process_quote_ticks_from_bar(self, OrderBook book) except *:
+    cdef void _process_trade_from_bar(
+        self,
+        SimulatedL1OrderBook book,
+        Price price,
+        double size,
+        uint64_t timestamp_ns,
+    ) except *:
+        book._update_bid(price.as_f64_c(), size)
+        book._update_ask(price.as_f64_c(), size)
+        self._iterate_matching_engine(book.instrument_id, timestamp_ns)
+
+    cdef void _process_quote_ticks_from_bar(self, SimulatedL1OrderBook book) except *:
+        # Simulates the OHLC path of the bid and ask bars as quotes, updating the
+        # book directly from the bars raw values so no ticks are allocated
         cdef Bar last_bid_bar = self._last_bid_bars.get(book.instrument_id)
         cdef Bar last_ask_bar = self._last_ask_bars.get(book.instrument_id)
 
@@ -727,52 +712,43 @@ cdef class SimulatedExchange:
         if last_bid_bar.ts_event != last_ask_bar.ts_event:
             return  # Wait for next bar
 
-        cdef Quantity bid_size = Quantity(last_bid_bar.volume.as_f64_c() / 4.0, last_bid_bar.volume._mem.precision)
-        cdef Quantity ask_size = Quantity(last_ask_bar.volume.as_f64_c() / 4.0, last_ask_bar.volume._mem.precision)
-
-        # Create reusable tick
-        cdef QuoteTick tick = QuoteTick(
-            book.instrument_id,
-            last_bid_bar.open,
-            last_ask_bar.open,
-            bid_size,
-            ask_size,
-            last_bid_bar.ts_event,
-            last_ask_bar.ts_init,
-        )
+        cdef double bid_size = self._bar_tick_size(last_bid_bar)
+        cdef double ask_size = self._bar_tick_size(last_ask_bar)
+        cdef uint64_t ts_init = last_ask_bar.ts_init
 
         # Open
-        book.update_quote_tick(tick)
-        self._iterate_matching_engine(
-            tick.instrument_id,
-            tick.ts_init,
-        )
+        book._update_bid(last_bid_bar.open.as_f64_c(), bid_size)
+        book._update_ask(last_ask_bar.open.as_f64_c(), ask_size)
+        self._iterate_matching_engine(book.instrument_id, ts_init)
 
         # High
-        tick._mem.bid = last_bid_bar.high._mem  # Direct memory assignment
-        tick._mem.ask = last_ask_bar.high._mem  # Direct memory assignment
-        book.update_quote_tick(tick)
-        self._iterate_matching_engine(
-            tick.instrument_id,
-            tick.ts_init,
-        )
+        book._update_bid(last_bid_bar.high.as_f64_c(), bid_size)
+        book._update_ask(last_ask_bar.high.as_f64_c(), ask_size)
+        self._iterate_matching_engine(book.instrument_id, ts_init)
 
         # Low
-        tick._mem.bid = last_bid_bar.low._mem  # Assigning memory directly
-        tick._mem.ask = last_ask_bar.low._mem  # Assigning memory directly
-        book.update_quote_tick(tick)
-        self._iterate_matching_engine(
-            tick.instrument_id,
-            tick.ts_init,
-        )
+        book._update_bid(last_bid_bar.low.as_f64_c(), bid_size)
+        book._update_ask(last_ask_bar.low.as_f64_c(), ask_size)
+        self._iterate_matching_engine(book.instrument_id, ts_init)
 
         # Close
-        tick._mem.bid = last_bid_bar.close._mem  # Assigning memory directly
-        tick._mem.ask = last_ask_bar.close._mem  # Assigning memory directly
-        book.update_quote_tick(tick)
-        self._iterate_matching_engine(
-            tick.instrument_id,
-            tick.ts_init,
+        book._update_bid(last_bid_bar.close.as_f64_c(), bid_size)
+        book._update_ask(last_ask_bar.close.as_f64_c(), ask_size)
+        self._iterate_matching_engine(book.instrument_id, ts_init)
+
+    cdef double _bar_tick_size(self, Bar bar) except *:
+        # A quarter of the bars volume at the volume precision (as a stack value)
+        cdef Quantity_t size = quantity_new(bar.volume.as_f64_c() / 4.0, bar.volume._mem.precision)
+        return size.raw / FIXED_SCALAR
+
+    cdef bint is_idle_c(self, uint64_t now_ns) except *:
+        # If `process` would have no due commands, modules or bar state to handle
+        return (
+            (not self._inflight_queue or self._inflight_queue[0][0] > now_ns)
+            and self._message_queue.count == 0
+            and not self.modules
+            and not self._last_bids
+            and not self._last_asks
         )
 
     cpdef void process(self, uint64_t now_ns) except *:
@@ -789,17 +765,10 @@ cdef class SimulatedExchange:
         """
         self._clock.set_time(now_ns)
 
-        cdef:
-            uint64_t ts
-        while self._inflight_queue:
-            # Peek at timestamp of next inflight message
-            ts = self._inflight_queue[0][0][0]
-            if ts <= now_ns:
-                # Place message on queue to be processed
-                self._message_queue.put_nowait(self._inflight_queue.pop(0)[1])
-                self._inflight_counter.pop(ts, None)
-            else:
-                break
+        # Pop only the inflight messages which have arrived (earliest first)
+        while self._inflight_queue and self._inflight_queue[0][0] <= now_ns:
+            # Place message on queue to be processed
+            self._message_queue.put_nowait(heappop(self._inflight_queue)[2])
 
         cdef:
             TradingCommand command
@@ -845,10 +814,7 @@ cdef class SimulatedExchange:
                     self._generate_order_pending_cancel(order)
                     self._cancel_order(order)
             elif isinstance(command, CancelAllOrders):
-                orders = (
-                    self._orders_bid.get(command.instrument_id, [])
-                    + self._orders_ask.get(command.instrument_id, [])
-                )
+                orders = self.get_open_orders(command.instrument_id)
                 for order in orders:
                     if order.is_inflight_c() or order.is_open_c():
                         self._generate_order_pending_cancel(order)
@@ -882,18 +848,138 @@ cdef class SimulatedExchange:
         self._last_bid_bars.clear()
         self._last_ask_bars.clear()
         self._order_index.clear()
-        self._orders_bid.clear()
-        self._orders_ask.clear()
+        self._matching_cores.clear()
 
         self._symbol_pos_count.clear()
         self._symbol_ord_count.clear()
         self._executions_count = 0
         self._message_queue = Queue()
         self._inflight_queue.clear()
-        self._inflight_counter.clear()
+        self._inflight_seq = 0
 
         self._log.info("Reset.")
 
+    cpdef dict checkpoint_state(self):
+        """
+        Return the matching state of the exchange as a dictionary of primitives.
+
+        Open orders are referenced by client order ID, so the cache must hold
+        the same orders when the state is restored.
+
+        Returns
+        -------
+        dict[str, object]
+
+        Raises
+        ------
+        RuntimeError
+            If the exchange has commands in flight.
+
+        """
+        if self._inflight_queue or self._message_queue.count > 0:
+            raise RuntimeError(f"cannot checkpoint {self.id}: commands still in flight")
+
+        cdef dict books = {}
+        cdef InstrumentId instrument_id
+        cdef OrderBook book
+        cdef Level level
+        for instrument_id, book in self._books.items():
+            books[instrument_id.to_str()] = (
+                [(level.price, level.volume()) for level in book.bids.levels],
+                [(level.price, level.volume()) for level in book.asks.levels],
+                book.ts_last,
+            )
+
+        cdef Order order
+        return {
+            "books": books,
+            "last": {k.to_str(): str(v) for k, v in self._last.items()},
+            "last_bid_bars": {k.to_str(): Bar.to_dict(v) for k, v in self._last_bid_bars.items()},
+            "last_ask_bars": {k.to_str(): Bar.to_dict(v) for k, v in self._last_ask_bars.items()},
+            "orders_bid": {
+                k.to_str(): [order.client_order_id.to_str() for order in v.orders_bid()]
+                for k, v in self._matching_cores.items()
+            },
+            "orders_ask": {
+                k.to_str(): [order.client_order_id.to_str() for order in v.orders_ask()]
+                for k, v in self._matching_cores.items()
+            },
+            "oto_orders": {k.to_str(): v.to_str() for k, v in self._oto_orders.items()},
+            "bar_execution": self._bar_execution,
+            "symbol_pos_count": {k.to_str(): v for k, v in self._symbol_pos_count.items()},
+            "symbol_ord_count": {k.to_str(): v for k, v in self._symbol_ord_count.items()},
+            "executions_count": self._executions_count,
+        }
+
+    cpdef void restore_state(self, dict state) except *:
+        """
+        Restore the matching state of the exchange from the given dictionary.
+
+        Parameters
+        ----------
+        state : dict[str, object]
+            The state from a prior call to `checkpoint_state`.
+
+        Raises
+        ------
+        ValueError
+            If an open order in `state` is not found in the cache.
+
+        """
+        Condition.not_none(state, "state")
+
+        self._books.clear()
+        cdef InstrumentId instrument_id
+        cdef OrderBook book
+        for key, (bids, asks, ts_last) in state["books"].items():
+            instrument_id = InstrumentId.from_str_c(key)
+            book = self.get_book(instrument_id)
+            book.apply_snapshot(
+                OrderBookSnapshot(
+                    instrument_id=instrument_id,
+                    book_type=book.type,
+                    bids=[list(level) for level in bids],
+                    asks=[list(level) for level in asks],
+                    ts_event=ts_last,
+                    ts_init=ts_last,
+                ),
+            )
+
+        self._last = {
+            InstrumentId.from_str_c(k): Price.from_str_c(v) for k, v in state["last"].items()
+        }
+        self._last_bid_bars = {
+            InstrumentId.from_str_c(k): Bar.from_dict(v) for k, v in state["last_bid_bars"].items()
+        }
+        self._last_ask_bars = {
+            InstrumentId.from_str_c(k): Bar.from_dict(v) for k, v in state["last_ask_bars"].items()
+        }
+
+        self._order_index.clear()
+        self._matching_cores.clear()
+        self._restore_orders(state["orders_bid"])
+        self._restore_orders(state["orders_ask"])
+        self._oto_orders = {
+            ClientOrderId(k): ClientOrderId(v) for k, v in state["oto_orders"].items()
+        }
+
+        self._bar_execution = state["bar_execution"]
+        self._symbol_pos_count = {
+            InstrumentId.from_str_c(k): v for k, v in state["symbol_pos_count"].items()
+        }
+        self._symbol_ord_count = {
+            InstrumentId.from_str_c(k): v for k, v in state["symbol_ord_count"].items()
+        }
+        self._executions_count = state["executions_count"]
+
+    cdef void _restore_orders(self, dict client_order_ids) except *:
+        cdef Order order
+        for ids in client_order_ids.values():
+            for value in ids:  # Priority order as checkpointed
+                order = self.cache.order(ClientOrderId(value))
+                Condition.not_none(order, value)
+                self._add_order(order)
+
 # -- COMMAND HANDLING -----------------------------------------------------------------------------
 
     cdef void _process_order(self, Order order) except *:
@@ -1163,18 +1249,7 @@ cdef class SimulatedExchange:
         if order.venue_order_id is None:
             order.venue_order_id = self._generate_venue_order_id(order.instrument_id)
 
-        cdef:
-            list orders_bid
-            list orders_ask
-        if order.is_buy_c():
-            orders_bid = self._orders_bid.get(order.instrument_id)
-            if orders_bid and order in orders_bid:
-                orders_bid.remove(order)
-        elif order.is_sell_c():
-            orders_ask = self._orders_ask.get(order.instrument_id)
-            if orders_ask and order in orders_ask:
-                orders_ask.remove(order)
-
+        self._delete_order(order)
         self._generate_order_canceled(order)
 
         if order.contingency_type == ContingencyType.OCO and cancel_ocos:
@@ -1203,46 +1278,46 @@ cdef class SimulatedExchange:
         # Index order
         self._order_index[order.client_order_id] = order
 
-        if order.is_buy_c():
-            orders_bid = self._orders_bid.get(order.instrument_id)
-            if orders_bid is None:
-                orders_bid = []
-                self._orders_bid[order.instrument_id] = orders_bid
-            orders_bid.append(order)
-            orders_bid.sort(key=lambda o: o.price if o.type == OrderType.LIMIT or (o.type == OrderType.STOP_LIMIT and o.is_triggered) else o.trigger_price, reverse=True)  # noqa  TODO(cs): Will refactor!
-        elif order.is_sell_c():
-            orders_ask = self._orders_ask.get(order.instrument_id)
-            if orders_ask is None:
-                orders_ask = []
-                self._orders_ask[order.instrument_id] = orders_ask
-            orders_ask.append(order)
-            orders_ask.sort(key=lambda o: o.price if o.type == OrderType.LIMIT or (o.type == OrderType.STOP_LIMIT and o.is_triggered) else o.trigger_price)  # noqa  TODO(cs): Will refactor!
+        cdef OrderMatchingCore core = self._matching_cores.get(order.instrument_id)
+        if core is None:
+            core = OrderMatchingCore(order.instrument_id)
+            self._matching_cores[order.instrument_id] = core
+        core.add_order(order)
 
     cdef void _delete_order(self, Order order) except *:
         self._order_index.pop(order.client_order_id, None)
 
-        if order.is_buy_c():
-            orders_bid = self._orders_bid.get(order.instrument_id)
-            if orders_bid is not None:
-                orders_bid.remove(order)
-        elif order.is_sell_c():
-            orders_ask = self._orders_ask.get(order.instrument_id)
-            if orders_ask is not None:
-                orders_ask.remove(order)
+        cdef OrderMatchingCore core = self._matching_cores.get(order.instrument_id)
+        if core is not None:
+            core.delete_order(order)
+
+    cdef void _reindex_order(self, Order order) except *:
+        # Called after an orders price, trigger price or triggered state changed
+        if order.client_order_id not in self._order_index:
+            return  # Not resting
+        cdef OrderMatchingCore core = self._matching_cores[order.instrument_id]
+        if order.is_open_c():
+            core.update_order(order)  # Keeps its time priority
+        else:
+            core.delete_order(order)
 
     cdef void _iterate_matching_engine(
         self, InstrumentId instrument_id,
         uint64_t timestamp_ns,
     ) except *:
-        # Iterate bids
-        cdef list orders_bid = self._orders_bid.get(instrument_id)
-        if orders_bid is not None:
-            self._iterate_side(orders_bid.copy(), timestamp_ns)  # Copy list for safe loop
-
-        # Iterate asks
-        cdef list orders_ask = self._orders_ask.get(instrument_id)
-        if orders_ask is not None:
-            self._iterate_side(orders_ask.copy(), timestamp_ns)  # Copy list for safe loop
+        cdef OrderMatchingCore core = self._matching_cores.get(instrument_id)
+        if core is None or core.is_empty():
+            return  # No resting orders
+
+        # Only the orders which can fill, trigger or expire are visited
+        self._iterate_side(
+            core.iterate(
+                self.best_bid_price(instrument_id),
+                self.best_ask_price(instrument_id),
+                timestamp_ns,
+            ),
+            timestamp_ns,
+        )
 
     cdef void _iterate_side(self, list orders, uint64_t timestamp_ns) except *:
         cdef Order order
@@ -1821,6 +1896,9 @@ cdef class SimulatedExchange:
             venue_order_id_modified=venue_order_id_modified,
         )
 
+        if price is not None or trigger_price is not None:
+            self._reindex_order(order)
+
     cdef void _generate_order_canceled(self, Order order) except *:
         self.exec_client.generate_order_canceled(
             strategy_id=order.strategy_id,
@@ -1839,6 +1917,8 @@ cdef class SimulatedExchange:
             ts_event=self._clock.timestamp_ns(),
         )
 
+        self._reindex_order(order)  # Now matches on its limit price
+
     cdef void _generate_order_expired(self, Order order) except *:
         self.exec_client.generate_order_expired(
             strategy_id=order.strategy_id,
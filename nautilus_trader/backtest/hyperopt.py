@@ -13,10 +13,12 @@
 #  limitations under the License.
 # -------------------------------------------------------------------------------------------------
 
+import os
 from decimal import Decimal
 from typing import Any, Dict, Optional
 
 from nautilus_trader.backtest.node import BacktestNode
+from nautilus_trader.backtest.warmstart import WarmStartBacktest
 
 
 try:
@@ -32,6 +34,7 @@ from nautilus_trader.common.logging import LogLevel
 from nautilus_trader.config import BacktestRunConfig
 from nautilus_trader.config import ImportableStrategyConfig
 from nautilus_trader.config import StrategyConfig
+from nautilus_trader.config import StrategyFactory
 from nautilus_trader.model.data.bar import BarType
 from nautilus_trader.model.identifiers import InstrumentId
 
@@ -117,6 +120,15 @@ class HyperoptBacktestNode(BacktestNode):
         logger = Logger(clock=LiveClock(), level_stdout=LogLevel.INFO)
         logger_adapter = LoggerAdapter(component_name="HYPEROPT_LOGGER", logger=logger)
 
+        # Where possible build and load the engine once, then fork it for each trial
+        warm: Optional[WarmStartBacktest] = None
+        if hasattr(os, "fork") and self.config.batch_size_bytes is None:
+            warm = WarmStartBacktest(
+                config=self.config.replace(
+                    engine=self.config.engine.copy(update={"strategies": []}),
+                ),
+            )
+
         def objective(args):
             logger_adapter.info(f"Searching with {args}")
 
@@ -132,13 +144,18 @@ class HyperoptBacktestNode(BacktestNode):
             local_config.check()
 
             try:
-                result = self._run(
-                    run_config_id=local_config.id,
-                    engine_config=local_config.engine,
-                    venue_configs=local_config.venues,
-                    data_configs=local_config.data,
-                    batch_size_bytes=local_config.batch_size_bytes,
-                )
+                if warm is not None:
+                    result = warm.run_trial(
+                        lambda engine: engine.add_strategy(StrategyFactory.create(config)),
+                    )
+                else:
+                    result = self._run(
+                        run_config_id=local_config.id,
+                        engine_config=local_config.engine,
+                        venue_configs=local_config.venues,
+                        data_configs=local_config.data,
+                        batch_size_bytes=local_config.batch_size_bytes,
+                    )
 
                 base_currency = self.config.venues[0].base_currency
                 # logger_adapter.info(f"{result.stats_pnls[base_currency]}")
@@ -163,10 +180,14 @@ class HyperoptBacktestNode(BacktestNode):
 
         trials = hyperopt.Trials()
 
-        return hyperopt.fmin(
-            fn=objective,
-            space=params,
-            algo=hyperopt.tpe.suggest,
-            trials=trials,
-            max_evals=max_evals,
-        )
+        try:
+            return hyperopt.fmin(
+                fn=objective,
+                space=params,
+                algo=hyperopt.tpe.suggest,
+                trials=trials,
+                max_evals=max_evals,
+            )
+        finally:
+            if warm is not None:
+                warm.dispose()
@@ -0,0 +1,46 @@
+# -------------------------------------------------------------------------------------------------
+#  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+#  https://nautechsystems.io
+#
+#  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+#  You may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+# -------------------------------------------------------------------------------------------------
+
+from libc.stdint cimport uint64_t
+
+from nautilus_trader.model.identifiers cimport InstrumentId
+from nautilus_trader.model.objects cimport Price
+from nautilus_trader.model.orders.base cimport Order
+
+
+cdef class OrderMatchingCore:
+    cdef list _bids
+    cdef list _asks
+    cdef list _bid_stops
+    cdef list _ask_stops
+    cdef list _expiries
+    cdef dict _entries
+    cdef uint64_t _seq
+
+    cdef readonly InstrumentId instrument_id
+    """The instrument ID for the matching core.\n\n:returns: `InstrumentId`"""
+
+    cpdef list orders_bid(self)
+    cpdef list orders_ask(self)
+    cpdef bint is_empty(self) except *
+    cpdef void add_order(self, Order order) except *
+    cpdef void update_order(self, Order order) except *
+    cpdef void delete_order(self, Order order) except *
+    cpdef list iterate(self, Price bid, Price ask, uint64_t timestamp_ns)
+
+    cdef void _insert(self, Order order, uint64_t seq) except *
+    cdef bint _is_live(self, tuple item) except *
+    cdef list _sorted_side(self, list resting, list stops)
+    cdef list _candidates(self, list resting, list stops, object limit_key, object stop_key, list expired)
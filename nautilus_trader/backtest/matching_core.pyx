@@ -0,0 +1,295 @@
+# -------------------------------------------------------------------------------------------------
+#  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+#  https://nautechsystems.io
+#
+#  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+#  You may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+# -------------------------------------------------------------------------------------------------
+
+from bisect import bisect_left
+from bisect import insort
+from heapq import heapify
+from heapq import heappop
+from heapq import heappush
+
+from libc.stdint cimport uint64_t
+
+from nautilus_trader.core.correctness cimport Condition
+from nautilus_trader.model.c_enums.order_type cimport OrderType
+from nautilus_trader.model.identifiers cimport InstrumentId
+from nautilus_trader.model.objects cimport Price
+from nautilus_trader.model.orders.base cimport Order
+
+
+cdef class OrderMatchingCore:
+    """
+    Provides the resting orders of a simulated exchange for a single instrument.
+
+    Orders which match on their limit price are held sorted by price then time
+    for each side, and untriggered stop orders are held sorted by trigger price
+    for each side, so that each market update only visits the orders which can
+    fill, trigger or expire.
+
+    An order keeps its time priority (the sequence it was first added with)
+    when it is updated, including when its price is modified or it triggers.
+
+    Parameters
+    ----------
+    instrument_id : InstrumentId
+        The instrument ID for the matching core.
+    """
+
+    def __init__(self, InstrumentId instrument_id not None):
+        self.instrument_id = instrument_id
+
+        # Entries are (key, seq, order) sorted ascending by key, where the key
+        # is negated where required so that matchable orders are a prefix
+        self._bids = []       # Key -price (fills when price >= ask)
+        self._asks = []       # Key price (fills when price <= bid)
+        self._bid_stops = []  # Key trigger_price (triggers when ask >= trigger_price)
+        self._ask_stops = []  # Key -trigger_price (triggers when bid <= trigger_price)
+        self._expiries = []   # Heap of (expire_time_ns, seq, order)
+        self._entries = {}    # type: dict[ClientOrderId, tuple[list, tuple]]
+        self._seq = 0
+
+    def __repr__(self) -> str:
+        return f"{type(self).__name__}({self.instrument_id.to_str()}, orders={len(self._entries)})"
+
+    cpdef list orders_bid(self):
+        """
+        Return the resting bid orders in the exchanges priority order.
+
+        Returns
+        -------
+        list[Order]
+
+        """
+        return self._sorted_side(self._bids, self._bid_stops)
+
+    cpdef list orders_ask(self):
+        """
+        Return the resting ask orders in the exchanges priority order.
+
+        Returns
+        -------
+        list[Order]
+
+        """
+        return self._sorted_side(self._asks, self._ask_stops)
+
+    cpdef bint is_empty(self) except *:
+        """
+        Return whether the matching core has no resting orders.
+
+        Returns
+        -------
+        bool
+
+        """
+        return not self._entries
+
+    cpdef void add_order(self, Order order) except *:
+        """
+        Add the given order to the resting orders.
+
+        An order is keyed on its limit price if it is a ``LIMIT`` order or a
+        triggered ``STOP_LIMIT`` or ``LIMIT_IF_TOUCHED`` order, otherwise on
+        its trigger price.
+
+        Parameters
+        ----------
+        order : Order
+            The order to add.
+
+        Raises
+        ------
+        ValueError
+            If `order.client_order_id` is already resting.
+
+        """
+        Condition.not_none(order, "order")
+        Condition.not_in(order.client_order_id, self._entries, "order.client_order_id", "_entries")
+
+        self._seq += 1
+        self._insert(order, self._seq)
+
+        if order.expire_time_ns > 0:
+            heappush(self._expiries, (order.expire_time_ns, self._seq, order))
+
+    cpdef void update_order(self, Order order) except *:
+        """
+        Update the key of the given resting order (if found), keeping its time
+        priority.
+
+        Call after the orders price, trigger price or triggered state changed.
+
+        Parameters
+        ----------
+        order : Order
+            The order to update.
+
+        """
+        Condition.not_none(order, "order")
+
+        cdef tuple value = self._entries.get(order.client_order_id)
+        if value is None:
+            return  # Not resting
+
+        cdef list entries = value[0]
+        cdef tuple entry = value[1]
+        del entries[bisect_left(entries, entry[:2])]
+        self._insert(order, entry[1])  # Expiry heap entry is still valid for the sequence
+
+    cpdef void delete_order(self, Order order) except *:
+        """
+        Delete the given order from the resting orders (if found).
+
+        Parameters
+        ----------
+        order : Order
+            The order to delete.
+
+        """
+        Condition.not_none(order, "order")
+
+        cdef tuple value = self._entries.pop(order.client_order_id, None)
+        if value is None:
+            return  # Not resting
+
+        cdef list entries = value[0]
+        cdef tuple entry = value[1]
+        del entries[bisect_left(entries, entry[:2])]
+
+        # Expiry heap entries are discarded when popped, unless stale entries
+        # dominate (canceled far-future orders never reach the top), then
+        # rebuild the heap from the live entries only.
+        if len(self._expiries) > 2 * len(self._entries):
+            self._expiries = [item for item in self._expiries if self._is_live(item)]
+            heapify(self._expiries)
+
+    cpdef list iterate(self, Price bid, Price ask, uint64_t timestamp_ns):
+        """
+        Return the resting orders which can fill, trigger or expire at the given
+        market, bids first then asks in the exchanges priority order.
+
+        Orders exactly at the market are included, as the fill model decides if
+        they are filled.
+
+        Parameters
+        ----------
+        bid : Price, optional
+            The best bid price (``None`` if no market).
+        ask : Price, optional
+            The best ask price (``None`` if no market).
+        timestamp_ns : uint64_t
+            The UNIX timestamp (nanoseconds) for order expiry.
+
+        Returns
+        -------
+        list[Order]
+
+        """
+        cdef list expired = []
+        cdef tuple item
+        while self._expiries and self._expiries[0][0] <= timestamp_ns:
+            item = heappop(self._expiries)
+            if self._is_live(item):
+                expired.append(self._entries[item[2].client_order_id])
+
+        return (
+            self._candidates(
+                self._bids,
+                self._bid_stops,
+                -ask._mem.raw if ask is not None else None,
+                ask._mem.raw if ask is not None else None,
+                expired,
+            )
+            + self._candidates(
+                self._asks,
+                self._ask_stops,
+                bid._mem.raw if bid is not None else None,
+                -bid._mem.raw if bid is not None else None,
+                expired,
+            )
+        )
+
+    cdef void _insert(self, Order order, uint64_t seq) except *:
+        # Entries are keyed so that matchable orders are a prefix of each list
+        cdef list entries
+        cdef object key
+        if order.type == OrderType.LIMIT or (
+            (order.type == OrderType.STOP_LIMIT or order.type == OrderType.LIMIT_IF_TOUCHED)
+            and order.is_triggered
+        ):
+            if order.is_buy_c():
+                entries = self._bids
+                key = -order.price._mem.raw
+            else:
+                entries = self._asks
+                key = order.price._mem.raw
+        else:
+            if order.is_buy_c():
+                entries = self._bid_stops
+                key = order.trigger_price._mem.raw
+            else:
+                entries = self._ask_stops
+                key = -order.trigger_price._mem.raw
+
+        cdef tuple entry = (key, seq, order)
+        insort(entries, entry)
+        self._entries[order.client_order_id] = (entries, entry)
+
+    cdef bint _is_live(self, tuple item) except *:
+        # Whether the expiry heap item is for an order still resting with its sequence
+        cdef tuple value = self._entries.get(item[2].client_order_id)
+        return value is not None and value[1][1] == item[1]
+
+    cdef list _sorted_side(self, list resting, list stops):
+        # Priority is by limit price for resting orders and trigger price for
+        # stops, in a single ordering for the side (best first)
+        cdef list entries = resting + [(-e[0], e[1], e[2]) for e in stops]
+        entries.sort()
+        return [e[2] for e in entries]
+
+    cdef list _candidates(
+        self,
+        list resting,
+        list stops,
+        object limit_key,
+        object stop_key,
+        list expired,
+    ):
+        cdef dict found = {}  # type: dict[int, tuple]
+        cdef tuple entry
+        if limit_key is not None:
+            for entry in resting:
+                if entry[0] > limit_key:
+                    break
+                found[entry[1]] = entry
+        if stop_key is not None:
+            for entry in stops:
+                if entry[0] > stop_key:
+                    break
+                found[entry[1]] = (-entry[0], entry[1], entry[2])
+
+        cdef tuple value
+        for value in expired:
+            entry = value[1]
+            if value[0] is resting:
+                found[entry[1]] = entry
+            elif value[0] is stops:
+                found[entry[1]] = (-entry[0], entry[1], entry[2])
+
+        if not found:
+            return []
+
+        cdef list entries = list(found.values())
+        entries.sort()
+        return [e[2] for e in entries]
@@ -13,6 +13,10 @@
 #  limitations under the License.
 # -------------------------------------------------------------------------------------------------
 
+from libc.stdint cimport uint64_t
+
+from nautilus_trader.execution.messages cimport TradingCommand
+
 
 cdef class FillModel:
     cdef readonly double prob_fill_on_limit
@@ -38,3 +42,5 @@ cdef class LatencyModel:
     """The latency (nanoseconds) for order update messages to reach the exchange.\n\n:returns: `int`"""
     cdef readonly int cancel_latency_nanos
     """The latency (nanoseconds) for order cancel messages to reach the exchange.\n\n:returns: `int`"""
+
+    cpdef uint64_t latency_nanos(self, TradingCommand command) except *
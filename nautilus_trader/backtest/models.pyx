@@ -18,6 +18,12 @@ import random
 from libc.stdint cimport uint64_t
 
 from nautilus_trader.core.correctness cimport Condition
+from nautilus_trader.execution.messages cimport CancelAllOrders
+from nautilus_trader.execution.messages cimport CancelOrder
+from nautilus_trader.execution.messages cimport ModifyOrder
+from nautilus_trader.execution.messages cimport SubmitOrder
+from nautilus_trader.execution.messages cimport SubmitOrderList
+from nautilus_trader.execution.messages cimport TradingCommand
 
 
 cdef uint64_t NANOSECONDS_IN_MILLISECOND = 1_000_000
@@ -154,3 +160,34 @@ cdef class LatencyModel:
         self.insert_latency_nanos = base_latency_nanos + insert_latency_nanos
         self.update_latency_nanos = base_latency_nanos + update_latency_nanos
         self.cancel_latency_nanos = base_latency_nanos + cancel_latency_nanos
+
+    cpdef uint64_t latency_nanos(self, TradingCommand command) except *:
+        """
+        Return the latency (nanoseconds) for the given command to reach the exchange.
+
+        Override to model a latency distribution per command type. In flight
+        commands are delivered to the exchange in order of arrival time.
+
+        Parameters
+        ----------
+        command : TradingCommand
+            The command sent to the exchange.
+
+        Returns
+        -------
+        uint64_t
+
+        Raises
+        ------
+        ValueError
+            If `command` is not a known trading command type.
+
+        """
+        if isinstance(command, (SubmitOrder, SubmitOrderList)):
+            return self.insert_latency_nanos
+        elif isinstance(command, ModifyOrder):
+            return self.update_latency_nanos
+        elif isinstance(command, (CancelOrder, CancelAllOrders)):
+            return self.cancel_latency_nanos
+        else:  # pragma: no cover (design-time error)
+            raise ValueError(f"invalid command, was {command}")
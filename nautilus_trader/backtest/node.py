@@ -13,10 +13,18 @@
 #  limitations under the License.
 # -------------------------------------------------------------------------------------------------
 
+import multiprocessing
+import os
+import tempfile
+from concurrent.futures import ProcessPoolExecutor
+from itertools import repeat
 from typing import Dict, List, Optional
 
 import pandas as pd
+import pyarrow as pa
 
+from nautilus_trader.backtest.data.store import QuoteTickColumns
+from nautilus_trader.backtest.data.store import TradeTickColumns
 from nautilus_trader.backtest.engine import BacktestEngine
 from nautilus_trader.backtest.engine import BacktestEngineConfig
 from nautilus_trader.backtest.results import BacktestResult
@@ -28,6 +36,8 @@ from nautilus_trader.core.inspect import is_nautilus_class
 from nautilus_trader.model.currency import Currency
 from nautilus_trader.model.data.base import DataType
 from nautilus_trader.model.data.base import GenericData
+from nautilus_trader.model.data.tick import QuoteTick
+from nautilus_trader.model.data.tick import TradeTick
 from nautilus_trader.model.enums import AccountType
 from nautilus_trader.model.enums import BookTypeParser
 from nautilus_trader.model.enums import OMSType
@@ -39,6 +49,14 @@ from nautilus_trader.persistence.batching import batch_files
 from nautilus_trader.persistence.batching import extract_generic_data_client_ids
 from nautilus_trader.persistence.batching import groupby_datatype
 from nautilus_trader.persistence.catalog.parquet import ParquetDataCatalog
+from nautilus_trader.persistence.funcs import tokenize
+
+
+# The columnar streams for data which worker processes can share decoded
+_COLUMNS = {
+    QuoteTick: QuoteTickColumns,
+    TradeTick: TradeTickColumns,
+}
 
 
 class BacktestNode:
@@ -68,6 +86,7 @@ class BacktestNode:
         # Configuration
         self._configs: List[BacktestRunConfig] = configs
         self._engines: Dict[str, BacktestEngine] = {}
+        self._shared_tables: Dict[str, str] = {}  # Data config token -> Arrow IPC file path
 
     @property
     def configs(self) -> List[BacktestRunConfig]:
@@ -109,16 +128,34 @@ class BacktestNode:
         """
         return list(self._engines.values())
 
-    def run(self) -> List[BacktestResult]:  # noqa (kwargs for extensibility)
+    def run(self, workers: int = 1) -> List[BacktestResult]:  # noqa (kwargs for extensibility)
         """
-        Execute a group of backtest run configs synchronously.
+        Execute a group of backtest run configs.
+
+        Parameters
+        ----------
+        workers : int, default 1
+            The number of worker processes to run the configs across. If 1 then
+            the configs are run synchronously in this process.
 
         Returns
         -------
         list[BacktestResult]
-            The results of the backtest runs.
+            The results of the backtest runs (in the same order as the configs).
+
+        Warnings
+        --------
+        When running with more than one worker each engine only exists within its
+        worker process, so `get_engine` and `get_engines` will not return them.
+        Workers are spawned (not forked), so each data catalog must be readable
+        from a new process (not an in-memory filesystem).
 
         """
+        PyCondition.positive_int(workers, "workers")
+
+        if workers > 1:
+            return self._run_parallel(workers)
+
         results: List[BacktestResult] = []
         for config in self._configs:
             config.check()  # Check all values set
@@ -133,6 +170,50 @@ class BacktestNode:
 
         return results
 
+    def _run_parallel(self, workers: int) -> List[BacktestResult]:
+        for config in self._configs:
+            config.check()  # Check all values set
+
+        with tempfile.TemporaryDirectory(prefix="nautilus-backtest-") as directory:
+            shared_tables: Dict[str, str] = self._write_shared_tables(directory)
+            # Spawn rather than fork, a forked worker could inherit a lock held by
+            # the async logger writer or `TimerWheel` thread
+            with ProcessPoolExecutor(
+                max_workers=min(workers, len(self._configs)),
+                mp_context=multiprocessing.get_context("spawn"),
+            ) as executor:
+                return list(executor.map(_run_config, self._configs, repeat(shared_tables)))
+
+    def _write_shared_tables(self, directory: str) -> Dict[str, str]:
+        # Decode each tick dataset once into raw fixed-point columns, written as an
+        # uncompressed Arrow IPC file which every worker memory-maps without copying
+        shared_tables: Dict[str, str] = {}
+        for run_config in self._configs:
+            if run_config.batch_size_bytes is not None:
+                continue  # Streamed in batches by each worker
+            for config in run_config.data:
+                if config.data_type not in _COLUMNS or config.instrument_id is None:
+                    continue  # Loaded as objects by each worker
+                key: str = tokenize(config)
+                if key in shared_tables:
+                    continue  # Already decoded for another run
+                instruments = config.catalog().instruments(
+                    instrument_ids=config.instrument_id,
+                    as_nautilus=True,
+                )
+                table: Optional[pa.Table] = config.load_table()
+                if not instruments or table is None or table.num_rows == 0:
+                    continue  # Reported as not found by each worker
+                columns = _COLUMNS[config.data_type].from_arrow(instruments[0], table)
+                raw: pa.Table = columns.to_arrow()
+                path: str = os.path.join(directory, f"{key}.arrow")
+                with pa.OSFile(path, "wb") as sink:
+                    with pa.ipc.new_file(sink, raw.schema) as writer:
+                        writer.write_table(raw)
+                shared_tables[key] = path
+
+        return shared_tables
+
     def _validate_configs(self, configs: List[BacktestRunConfig]):
         venue_ids: List[Venue] = []
         for config in configs:
@@ -264,8 +345,21 @@ class BacktestNode:
         engine: BacktestEngine,
         data_configs: List[BacktestDataConfig],
     ) -> None:
-        # Load data
+        self._load_data(engine=engine, data_configs=data_configs)
+        engine.run(run_config_id=run_config_id)
+
+    def _load_data(
+        self,
+        engine: BacktestEngine,
+        data_configs: List[BacktestDataConfig],
+    ) -> None:
         for config in data_configs:
+            if self._shared_tables:
+                path: Optional[str] = self._shared_tables.get(tokenize(config))
+                if path is not None:
+                    self._load_shared_table(engine=engine, config=config, path=path)
+                    continue
+
             t0 = pd.Timestamp.now()
             engine._log.info(
                 f"Reading {config.data_type} data for instrument={config.instrument_id}."
@@ -288,8 +382,36 @@ class BacktestNode:
             t2 = pd.Timestamp.now()
             engine._log.info(f"Engine load took {pd.Timedelta(t2 - t1)}s")
 
-        engine.run(run_config_id=run_config_id)
+    def _load_shared_table(
+        self,
+        engine: BacktestEngine,
+        config: BacktestDataConfig,
+        path: str,
+    ) -> None:
+        instrument_id = InstrumentId.from_str(config.instrument_id)
+        with pa.memory_map(path) as source:
+            # The table buffers stay valid (and mapped) after the file is closed
+            table: pa.Table = pa.ipc.open_file(source).read_all()
+        engine._log.info(
+            f"Mapped {table.num_rows:,} shared {config.data_type.__name__} "
+            f"rows for instrument={instrument_id}."
+        )
+        columns = _COLUMNS[config.data_type].from_arrow(
+            engine.kernel.cache.instrument(instrument_id),
+            table,
+        )
+        engine.add_data(data=columns)
 
     def dispose(self):
         for engine in self.get_engines():
             engine.dispose()
+
+
+def _run_config(config: BacktestRunConfig, shared_tables: Dict[str, str]) -> BacktestResult:
+    # Run a single config within a worker process, returning only the summary result
+    node = BacktestNode(configs=[config])
+    node._shared_tables = shared_tables
+    try:
+        return node.run()[0]
+    finally:
+        node.dispose()
@@ -0,0 +1,42 @@
+# -------------------------------------------------------------------------------------------------
+#  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+#  https://nautechsystems.io
+#
+#  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+#  You may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+# -------------------------------------------------------------------------------------------------
+
+
+cdef class BacktestProfiler:
+    cdef dict _stages
+    cdef list _stack
+    cdef object _wall_start_ns
+    cdef object _cpu_start_ns
+
+    cdef readonly object wall_ns
+    """The total wall time (nanoseconds) profiled.\n\n:returns: `int`"""
+    cdef readonly object cpu_ns
+    """The total CPU time (nanoseconds) profiled.\n\n:returns: `int`"""
+
+    cpdef void start(self) except *
+    cpdef void stop(self) except *
+    cpdef void enter(self, str stage) except *
+    cpdef void exit(self) except *
+    cpdef ProfiledHandler wrap(self, str stage, handler)
+    cpdef dict breakdown(self)
+    cpdef void reset(self) except *
+
+
+cdef class ProfiledHandler:
+    cdef BacktestProfiler _profiler
+    cdef str _stage
+
+    cdef readonly object handler
+    """The wrapped handler.\n\n:returns: `Callable`"""
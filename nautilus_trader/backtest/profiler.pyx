@@ -0,0 +1,189 @@
+# -------------------------------------------------------------------------------------------------
+#  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+#  https://nautechsystems.io
+#
+#  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+#  You may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+# -------------------------------------------------------------------------------------------------
+
+from time import perf_counter_ns
+from time import process_time_ns
+
+from nautilus_trader.core.correctness cimport Condition
+
+
+cdef class BacktestProfiler:
+    """
+    Provides wall and CPU time accounting per stage of a backtest run.
+
+    Stages are entered and exited as a stack, and the time of a nested stage is
+    only accounted to that stage (not to the stage it was entered from).
+    Time outside of any stage is reported as ``other``.
+    """
+
+    def __init__(self):
+        self._stages = {}  # type: dict[str, list[int]] (wall_ns, cpu_ns, calls)
+        self._stack = []   # type: list[list] (stage, wall_ns, cpu_ns, child_wall_ns, child_cpu_ns)
+        self._wall_start_ns = 0
+        self._cpu_start_ns = 0
+
+        self.wall_ns = 0
+        self.cpu_ns = 0
+
+    def __repr__(self) -> str:
+        return f"{type(self).__name__}(stages={len(self._stages)}, wall_ns={self.wall_ns})"
+
+    cpdef void start(self) except *:
+        """
+        Start profiling time (accumulates over each start and stop).
+        """
+        self._stack.clear()  # Any stages left open by an aborted run
+        self._wall_start_ns = perf_counter_ns()
+        self._cpu_start_ns = process_time_ns()
+
+    cpdef void stop(self) except *:
+        """
+        Stop profiling time.
+        """
+        self.wall_ns += perf_counter_ns() - self._wall_start_ns
+        self.cpu_ns += process_time_ns() - self._cpu_start_ns
+
+    cpdef void enter(self, str stage) except *:
+        """
+        Enter the given stage.
+
+        Parameters
+        ----------
+        stage : str
+            The stage name.
+
+        """
+        self._stack.append([stage, perf_counter_ns(), process_time_ns(), 0, 0])
+
+    cpdef void exit(self) except *:
+        """
+        Exit the current stage.
+
+        Raises
+        ------
+        IndexError
+            If no stage has been entered.
+
+        """
+        cdef object wall_ns = perf_counter_ns()
+        cdef object cpu_ns = process_time_ns()
+        cdef list frame = self._stack.pop()
+        wall_ns -= frame[1]
+        cpu_ns -= frame[2]
+
+        cdef list stats = self._stages.get(frame[0])
+        if stats is None:
+            stats = [0, 0, 0]
+            self._stages[frame[0]] = stats
+        stats[0] += wall_ns - frame[3]
+        stats[1] += cpu_ns - frame[4]
+        stats[2] += 1
+
+        cdef list parent
+        if self._stack:
+            parent = self._stack[-1]
+            parent[3] += wall_ns
+            parent[4] += cpu_ns
+
+    cpdef ProfiledHandler wrap(self, str stage, handler):
+        """
+        Return the given handler wrapped to be profiled as the given stage.
+
+        Parameters
+        ----------
+        stage : str
+            The stage name.
+        handler : Callable
+            The handler to wrap.
+
+        Returns
+        -------
+        ProfiledHandler
+
+        """
+        Condition.callable(handler, "handler")
+
+        return ProfiledHandler(self, stage, handler)
+
+    cpdef dict breakdown(self):
+        """
+        Return the profiled time per stage, ordered by wall time (descending).
+
+        Returns
+        -------
+        dict[str, dict[str, float]]
+
+        """
+        cdef dict breakdown = {}
+        cdef object other_wall_ns = self.wall_ns
+        cdef object other_cpu_ns = self.cpu_ns
+        cdef list stats
+        for _, stage in sorted([(v[0], k) for k, v in self._stages.items()], reverse=True):
+            stats = self._stages[stage]
+            breakdown[stage] = self._stage_stats(stats[0], stats[1], stats[2])
+            other_wall_ns -= stats[0]
+            other_cpu_ns -= stats[1]
+
+        breakdown["other"] = self._stage_stats(max(other_wall_ns, 0), max(other_cpu_ns, 0), 0)
+        return breakdown
+
+    def _stage_stats(self, wall_ns, cpu_ns, calls) -> dict:
+        return {
+            "wall_secs": wall_ns / 1e9,
+            "cpu_secs": cpu_ns / 1e9,
+            "wall_pct": 100.0 * wall_ns / self.wall_ns if self.wall_ns else 0.0,
+            "calls": calls,
+        }
+
+    cpdef void reset(self) except *:
+        """
+        Reset the profiler.
+
+        All stateful fields are reset to their initial value.
+        """
+        self._stages.clear()
+        self._stack.clear()
+        self._wall_start_ns = 0
+        self._cpu_start_ns = 0
+
+        self.wall_ns = 0
+        self.cpu_ns = 0
+
+
+cdef class ProfiledHandler:
+    """
+    Provides a handler which is profiled as a stage of a `BacktestProfiler`.
+
+    Parameters
+    ----------
+    profiler : BacktestProfiler
+        The profiler for the handler.
+    stage : str
+        The stage name.
+    handler : Callable
+        The handler to wrap.
+    """
+
+    def __init__(self, BacktestProfiler profiler not None, str stage not None, handler not None):
+        self._profiler = profiler
+        self._stage = stage
+        self.handler = handler
+
+    def __call__(self, *args):
+        self._profiler.enter(self._stage)
+        try:
+            return self.handler(*args)
+        finally:
+            self._profiler.exit()
@@ -39,6 +39,7 @@ class BacktestResult:
     total_positions: int
     stats_pnls: Dict[str, Dict[str, float]]
     stats_returns: Dict[str, float]
+    profile: Optional[Dict[str, Dict[str, float]]] = None  # If profiled
 
     # account_balances: pd.DataFrame
     # fills_report: pd.DataFrame
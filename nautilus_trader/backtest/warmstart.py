@@ -0,0 +1,205 @@
+# -------------------------------------------------------------------------------------------------
+#  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+#  https://nautechsystems.io
+#
+#  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+#  You may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+# -------------------------------------------------------------------------------------------------
+
+import os
+import pickle
+import sys
+import threading
+from datetime import datetime
+from typing import Callable, Optional, Union
+
+import pandas as pd
+
+from nautilus_trader.backtest.engine import BacktestEngine
+from nautilus_trader.backtest.node import BacktestNode
+from nautilus_trader.backtest.results import BacktestResult
+from nautilus_trader.config import BacktestRunConfig
+from nautilus_trader.core.correctness import PyCondition
+
+
+class WarmStartBacktest:
+    """
+    Provides a backtest which is built once, then forked for each trial.
+
+    The engine is created, its instruments and data loaded and (optionally) run up
+    to a warm-start time in this process. Each call to `run_trial()` then forks a
+    child process which inherits the warm engine as copy-on-write memory, applies
+    the trial setup and runs the remainder of the backtest.
+
+    Parameters
+    ----------
+    config : BacktestRunConfig
+        The backtest run config to build the warm engine from.
+    warmup_end : Union[datetime, str, int], optional
+        The time to run the engine up to before forking. If ``None`` the engine is
+        built and loaded but not run, so trials may add strategies.
+
+    Raises
+    ------
+    ValueError
+        If `config.batch_size_bytes` is not ``None`` (streaming is not supported).
+    RuntimeError
+        If the platform does not support `os.fork()`.
+
+    Warnings
+    --------
+    Strategies can only be added by a trial setup when `warmup_end` is ``None``, as
+    the trader is already running once the engine is warm.
+
+    Only the forking thread is copied into a child, so a lock held by any other
+    thread at the time of the fork is never released in the child. Trials are
+    therefore refused while the async logger writer or the `TimerWheel` thread is
+    running in this process.
+    """
+
+    def __init__(
+        self,
+        config: BacktestRunConfig,
+        warmup_end: Optional[Union[datetime, str, int]] = None,
+    ):
+        PyCondition.not_none(config, "config")
+        PyCondition.true(
+            config.batch_size_bytes is None,
+            "streaming configs are not supported for warm-start backtests",
+        )
+        if not hasattr(os, "fork"):
+            raise RuntimeError("warm-start backtests require `os.fork()`")
+
+        config.check()  # Check all values set
+
+        self._config = config
+        self._node = BacktestNode(configs=[config])
+        self._engine: Optional[BacktestEngine] = None
+        self._warmup_end = warmup_end
+
+    @property
+    def engine(self) -> BacktestEngine:
+        """
+        Return the warm backtest engine (built on first access).
+
+        Returns
+        -------
+        BacktestEngine
+
+        """
+        if self._engine is None:
+            self._warm_up()
+        return self._engine
+
+    def run_trial(
+        self,
+        setup: Optional[Callable[[BacktestEngine], None]] = None,
+    ) -> BacktestResult:
+        """
+        Run a trial from the warm engine in a forked child process.
+
+        Parameters
+        ----------
+        setup : Callable[[BacktestEngine], None], optional
+            The callable to apply trial specific setup to the engine (such as adding
+            a strategy) before running. Called within the child process.
+
+        Returns
+        -------
+        BacktestResult
+
+        Raises
+        ------
+        RuntimeError
+            If a background thread which may hold a lock is running.
+        RuntimeError
+            If the trial raised an exception in the child process.
+
+        """
+        engine: BacktestEngine = self.engine
+        self._check_fork_safe(engine)
+
+        read_fd, write_fd = os.pipe()
+        pid = os.fork()
+        if pid == 0:  # Child
+            # The child must never return into the callers code, whatever is raised
+            exit_code = 1
+            try:
+                os.close(read_fd)
+                try:
+                    if setup is not None:
+                        setup(engine)
+                    payload = (True, self._run_engine(engine))
+                except BaseException as ex:  # Also report interrupts and exits
+                    payload = (False, repr(ex))
+                try:
+                    data = pickle.dumps(payload)
+                except BaseException as ex:
+                    data = pickle.dumps((False, f"Cannot pickle trial result: {ex!r}"))
+                with os.fdopen(write_fd, "wb") as f:
+                    f.write(data)
+                sys.stdout.flush()
+                exit_code = 0
+            finally:
+                os._exit(exit_code)  # Skip parent cleanup handlers
+
+        os.close(write_fd)
+        with os.fdopen(read_fd, "rb") as f:
+            data = f.read()
+        os.waitpid(pid, 0)
+
+        if not data:
+            raise RuntimeError(f"Trial process {pid} exited without a result")
+        ok, value = pickle.loads(data)
+        if not ok:
+            raise RuntimeError(f"Trial failed: {value}")
+        return value
+
+    def dispose(self) -> None:
+        """
+        Dispose of the warm engine.
+        """
+        self._node.dispose()
+
+    def _check_fork_safe(self, engine: BacktestEngine) -> None:
+        if engine.kernel.logger.is_async:
+            raise RuntimeError(
+                "cannot fork a trial while the async logger writer thread is running",
+            )
+        for thread in threading.enumerate():
+            if thread.name == "timer-wheel" and thread.is_alive():
+                raise RuntimeError(
+                    "cannot fork a trial while the `TimerWheel` thread is running",
+                )
+
+    def _warm_up(self) -> None:
+        config: BacktestRunConfig = self._config
+        engine: BacktestEngine = self._node._create_engine(
+            run_config_id=config.id,
+            config=config.engine,
+            venue_configs=config.venues,
+            data_configs=config.data,
+        )
+        self._node._load_data(engine=engine, data_configs=config.data)
+
+        if self._warmup_end is not None:
+            engine.run_streaming(end=self._warmup_end, run_config_id=config.id)
+
+        self._engine = engine
+
+    def _run_engine(self, engine: BacktestEngine) -> BacktestResult:
+        if self._warmup_end is None:
+            engine.run(run_config_id=self._config.id)
+        else:
+            # Continue from the first data after the warm-start time
+            start_ns: int = pd.to_datetime(self._warmup_end, utc=True).value + 1
+            engine.run_streaming(start=start_ns, run_config_id=self._config.id)
+            engine.end_streaming()
+        return engine.get_result()
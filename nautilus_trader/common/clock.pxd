@@ -21,8 +21,14 @@ from cpython.datetime cimport tzinfo
 from libc.stdint cimport uint64_t
 
 from nautilus_trader.common.timer cimport LiveTimer
+from nautilus_trader.common.timer cimport TestTimer
 from nautilus_trader.common.timer cimport TimeEvent
 from nautilus_trader.common.timer cimport Timer
+from nautilus_trader.common.timer cimport TimerWheel
+from nautilus_trader.core.rust.common cimport CTimeEventScheduler
+
+
+cdef class TimeEventScheduler
 
 
 cdef class Clock:
@@ -39,8 +45,7 @@ cdef class Clock:
     """The number of timers active in the clock.\n\n:returns: `int`"""
     cdef readonly datetime next_event_time
     """The timestamp of the next time event.\n\n:returns: `datetime`"""
-    cdef readonly uint64_t next_event_time_ns
-    """The UNIX timestamp (nanoseconds) of the next time event.\n\n:returns: `uint64_t`"""
+    cdef uint64_t _next_event_time_ns
     cdef readonly str next_event_name
     """The name of the next time event.\n\n:returns: `str`"""
 
@@ -96,18 +101,42 @@ cdef class Clock:
     cdef void _remove_timer(self, Timer timer) except *
     cdef void _update_stack(self) except *
     cdef void _update_timing(self) except *
+    cdef uint64_t _next_event_time_ns_c(self) except *
 
 
 cdef class TestClock(Clock):
     cdef uint64_t _time_ns
     cdef dict _pending_events
+    cdef list _schedule
+    cdef uint64_t _schedule_seq
+    cdef TimeEventScheduler _scheduler
+    cdef dict _timer_ids
+    cdef bint _is_timing_stale
+
+    cpdef void set_time(self, uint64_t to_time_ns) except *
+    cpdef list advance_time(self, uint64_t to_time_ns)
 
+
+cdef class TimeEventScheduler:
+    cdef CTimeEventScheduler _mem
+    cdef list _clocks
+    cdef dict _timers
+    cdef uint64_t _next_timer_id
+
+    cdef readonly uint64_t time_ns
+    """The UNIX time (nanoseconds) of the scheduler.\n\n:returns: `uint64_t`"""
+
+    cpdef void register_clock(self, TestClock clock) except *
     cpdef void set_time(self, uint64_t to_time_ns) except *
     cpdef list advance_time(self, uint64_t to_time_ns)
 
+    cdef void _add_timer(self, TestClock clock, TestTimer timer) except *
+    cdef void _cancel_timer(self, TestClock clock, TestTimer timer) except *
+
 
 cdef class LiveClock(Clock):
     cdef object _loop
+    cdef TimerWheel _wheel
     cdef tzinfo _utc
 
     cpdef void _raise_time_event(self, LiveTimer timer) except *
@@ -13,6 +13,9 @@
 #  limitations under the License.
 # -------------------------------------------------------------------------------------------------
 
+from heapq import heapify
+from heapq import heappop
+from heapq import heappush
 from typing import Callable
 
 import cython
@@ -25,13 +28,22 @@ from cpython.datetime cimport timedelta
 from cpython.datetime cimport tzinfo
 from libc.stdint cimport uint64_t
 
-from nautilus_trader.common.timer cimport LoopTimer
 from nautilus_trader.common.timer cimport TestTimer
-from nautilus_trader.common.timer cimport ThreadTimer
 from nautilus_trader.common.timer cimport TimeEventHandler
+from nautilus_trader.common.timer cimport TimerWheel
+from nautilus_trader.common.timer cimport WheelTimer
+from nautilus_trader.common.timer cimport get_timer_wheel
 from nautilus_trader.core.correctness cimport Condition
 from nautilus_trader.core.datetime cimport nanos_to_millis
 from nautilus_trader.core.datetime cimport nanos_to_secs
+from nautilus_trader.core.rust.common cimport TimeEventRecord_t
+from nautilus_trader.core.rust.common cimport time_event_scheduler_add_timer
+from nautilus_trader.core.rust.common cimport time_event_scheduler_advance_time
+from nautilus_trader.core.rust.common cimport time_event_scheduler_cancel_timer
+from nautilus_trader.core.rust.common cimport time_event_scheduler_events
+from nautilus_trader.core.rust.common cimport time_event_scheduler_free
+from nautilus_trader.core.rust.common cimport time_event_scheduler_new
+from nautilus_trader.core.rust.common cimport time_event_scheduler_set_time
 from nautilus_trader.core.rust.core cimport unix_timestamp
 from nautilus_trader.core.rust.core cimport unix_timestamp_ms
 from nautilus_trader.core.rust.core cimport unix_timestamp_ns
@@ -58,7 +70,22 @@ cdef class Clock:
         self.timer_count = 0
         self.next_event_name = None
         self.next_event_time = None
-        self.next_event_time_ns = 0
+        self._next_event_time_ns = 0
+
+    @property
+    def next_event_time_ns(self) -> int:
+        """
+        The UNIX timestamp (nanoseconds) of the next time event.
+
+        Returns
+        -------
+        uint64_t
+
+        """
+        return self._next_event_time_ns_c()
+
+    cdef uint64_t _next_event_time_ns_c(self) except *:
+        return self._next_event_time_ns
 
     cpdef double timestamp(self) except *:
         """
@@ -523,10 +550,10 @@ cdef class Clock:
     @cython.wraparound(False)
     cdef void _update_timing(self) except *:
         if self.timer_count == 0:
-            self.next_event_time_ns = 0
+            self._next_event_time_ns = 0
             return
         elif self.timer_count == 1:
-            self.next_event_time_ns = self._stack[0].next_time_ns
+            self._next_event_time_ns = self._stack[0].next_time_ns
             return
 
         cdef uint64_t next_time_ns = self._stack[0].next_time_ns
@@ -537,7 +564,7 @@ cdef class Clock:
             if observed_ns < next_time_ns:
                 next_time_ns = observed_ns
 
-        self.next_event_time_ns = next_time_ns
+        self._next_event_time_ns = next_time_ns
 
 
 cdef class TestClock(Clock):
@@ -555,6 +582,11 @@ cdef class TestClock(Clock):
         super().__init__()
 
         self._time_ns = initial_ns
+        self._schedule = []  # type: list[tuple[int, int, TestTimer]]
+        self._schedule_seq = 0
+        self._scheduler = None
+        self._timer_ids = {}  # type: dict[str, int]
+        self._is_timing_stale = False
         self.is_test_clock = True
 
     cpdef datetime utc_now(self):
@@ -567,6 +599,8 @@ cdef class TestClock(Clock):
             The current tz-aware UTC time of the clock.
 
         """
+        if self._scheduler is not None:
+            return pd.Timestamp(self._scheduler.time_ns, tz=pytz.utc)
         return pd.Timestamp(self._time_ns, tz=pytz.utc)
 
     cpdef double timestamp(self) except *:
@@ -582,6 +616,8 @@ cdef class TestClock(Clock):
         https://en.wikipedia.org/wiki/Unix_time
 
         """
+        if self._scheduler is not None:
+            return nanos_to_secs(self._scheduler.time_ns)
         return nanos_to_secs(self._time_ns)
 
     cpdef uint64_t timestamp_ms(self) except *:
@@ -597,6 +633,8 @@ cdef class TestClock(Clock):
         https://en.wikipedia.org/wiki/Unix_time
 
         """
+        if self._scheduler is not None:
+            return nanos_to_millis(self._scheduler.time_ns)
         return nanos_to_millis(self._time_ns)
 
     cpdef uint64_t timestamp_ns(self) except *:
@@ -612,6 +650,8 @@ cdef class TestClock(Clock):
         https://en.wikipedia.org/wiki/Unix_time
 
         """
+        if self._scheduler is not None:
+            return self._scheduler.time_ns
         return self._time_ns
 
     cpdef void set_time(self, uint64_t to_time_ns) except *:
@@ -623,7 +663,15 @@ cdef class TestClock(Clock):
         to_time_ns : uint64_t
             The UNIX time (nanoseconds) to set.
 
+        Notes
+        -----
+        If the clock is registered with a `TimeEventScheduler` then the time is
+        set for all clocks registered with the scheduler.
+
         """
+        if self._scheduler is not None:
+            self._scheduler.set_time(to_time_ns)
+            return
         self._time_ns = to_time_ns
 
     cpdef list advance_time(self, uint64_t to_time_ns):
@@ -637,39 +685,117 @@ cdef class TestClock(Clock):
 
         Returns
         -------
-        list[TimeEvent]
+        list[TimeEventHandler]
             Sorted chronologically.
 
+        Notes
+        -----
+        Timers are kept in a min-heap keyed by next event time, so advancing
+        when no timer is due is O(1) and generating k events is O(k log T).
+
+        If the clock is registered with a `TimeEventScheduler` then all clocks
+        registered with the scheduler are advanced, and the events for all of
+        their timers are returned.
+
         Raises
         ------
         ValueError
             If `to_time` is < the clocks current time.
 
         """
+        if self._scheduler is not None:
+            return self._scheduler.advance_time(to_time_ns)
+
         # Ensure monotonic
         Condition.true(to_time_ns >= self._time_ns, "to_time_ns was < self._time_ns")
 
         cdef list event_handlers = []
 
-        if self.timer_count == 0 or to_time_ns < self.next_event_time_ns:
+        if self.timer_count == 0 or to_time_ns < self._next_event_time_ns:
             self._time_ns = to_time_ns
             return event_handlers  # No timer events to iterate
 
-        # Iterate timer events
+        # Pop timer events in chronological order from the schedule
+        cdef tuple entry
         cdef TestTimer timer
-        cdef TimeEvent event
-        for timer in self._stack:
-            for event in timer.advance(to_time_ns=to_time_ns):
-                event_handlers.append(TimeEventHandler(event, timer.callback))
-
-        # Remove expired timers
-        for timer in self._stack:
+        while self._schedule and self._schedule[0][0] <= to_time_ns:
+            entry = heappop(self._schedule)
+            timer = entry[2]
+            if timer.is_expired or self._timers.get(timer.name) is not timer:
+                continue  # Timer was canceled or replaced
+            event_handlers.append(
+                TimeEventHandler.create_c(timer.name, timer.next_time_ns, timer.callback),
+            )
+            timer.iterate_next_time(timer.next_time_ns)
             if timer.is_expired:
                 self._remove_timer(timer)
+            else:
+                heappush(self._schedule, (timer.next_time_ns, entry[1], timer))
 
         self._update_timing()
         self._time_ns = to_time_ns
-        return sorted(event_handlers)
+        return event_handlers
+
+    cdef void _add_timer(self, Timer timer, handler: Callable[[TimeEvent], None]) except *:
+        self._timers[timer.name] = timer
+        self._handlers[timer.name] = handler
+        self.timer_count = len(self._timers)
+        if self._scheduler is not None:
+            self._scheduler._add_timer(self, timer)
+            self._update_timing()
+            return
+        # The sequence number breaks ties between timers in insertion order
+        heappush(self._schedule, (timer.next_time_ns, self._schedule_seq, timer))
+        self._schedule_seq += 1
+        self._update_timing()
+
+    cdef void _remove_timer(self, Timer timer) except *:
+        # The timers schedule entry is discarded lazily
+        self._timers.pop(timer.name, None)
+        self._handlers.pop(timer.name, None)
+        self.timer_count = len(self._timers)
+        if self._scheduler is not None:
+            self._scheduler._cancel_timer(self, timer)
+        elif len(self._schedule) > 2 * self.timer_count:
+            # Stale entries dominate (canceled far-future timers never reach
+            # the top), so rebuild the schedule from the live entries only.
+            self._schedule = [
+                entry for entry in self._schedule
+                if not entry[2].is_expired and self._timers.get(entry[2].name) is entry[2]
+            ]
+            heapify(self._schedule)
+        self._update_timing()
+
+    cdef void _update_stack(self) except *:
+        # Timers are scheduled from a min-heap rather than a stack
+        self.timer_count = len(self._timers)
+
+    cdef void _update_timing(self) except *:
+        cdef Timer timer
+        if self._scheduler is not None:
+            # Timers are scheduled by the shared scheduler, so the next event
+            # time is only needed when read (see `_next_event_time_ns_c`).
+            self._is_timing_stale = True
+            return
+
+        # Discard entries at the top of the schedule for canceled or replaced timers
+        while self._schedule:
+            timer = self._schedule[0][2]
+            if not timer.is_expired and self._timers.get(timer.name) is timer:
+                break
+            heappop(self._schedule)
+
+        self._next_event_time_ns = self._schedule[0][0] if self._schedule else 0
+
+    cdef uint64_t _next_event_time_ns_c(self) except *:
+        cdef Timer timer
+        if self._is_timing_stale:
+            self._next_event_time_ns = 0
+            for timer in self._timers.values():
+                if self._next_event_time_ns == 0 or timer.next_time_ns < self._next_event_time_ns:
+                    self._next_event_time_ns = timer.next_time_ns
+            self._is_timing_stale = False
+        return self._next_event_time_ns
 
     cdef Timer _create_timer(
         self,
@@ -688,6 +814,155 @@ cdef class TestClock(Clock):
         )
 
 
+cdef class TimeEventScheduler:
+    """
+    Provides a time event scheduler shared by the test clocks of a backtest.
+
+    All timers for the registered clocks are scheduled from a single min-heap
+    in Rust, so advancing when no timer is due is O(1) regardless of the number
+    of clocks, and events across all clocks are returned already in order.
+
+    Parameters
+    ----------
+    initial_ns : uint64_t
+        The initial UNIX time (nanoseconds) for the scheduler.
+    """
+
+    def __init__(self, uint64_t initial_ns=0):
+        self._mem = time_event_scheduler_new(initial_ns)
+        self._clocks = []  # type: list[TestClock]
+        self._timers = {}  # type: dict[int, tuple[TestClock, TestTimer]]
+        self._next_timer_id = 1
+        self.time_ns = initial_ns
+
+    def __del__(self):
+        time_event_scheduler_free(self._mem)
+
+    cpdef void register_clock(self, TestClock clock) except *:
+        """
+        Register the given clock with the scheduler.
+
+        The clocks time is then read from the scheduler, and any existing
+        timers for the clock are scheduled by the scheduler.
+
+        Parameters
+        ----------
+        clock : TestClock
+            The clock to register.
+
+        Raises
+        ------
+        ValueError
+            If `clock` is already registered with another scheduler.
+
+        """
+        Condition.not_none(clock, "clock")
+        if clock._scheduler is self:
+            return  # Already registered
+        Condition.true(clock._scheduler is None, "clock was registered with another scheduler")
+
+        clock._scheduler = self
+        clock._schedule = []
+        self._clocks.append(clock)
+
+        cdef TestTimer timer
+        for timer in clock._timers.values():
+            self._add_timer(clock, timer)
+
+        clock._update_timing()
+
+    cpdef void set_time(self, uint64_t to_time_ns) except *:
+        """
+        Set the time for all registered clocks to the given time (UTC).
+
+        Parameters
+        ----------
+        to_time_ns : uint64_t
+            The UNIX time (nanoseconds) to set.
+
+        """
+        time_event_scheduler_set_time(&self._mem, to_time_ns)
+        self.time_ns = to_time_ns
+
+    @cython.boundscheck(False)
+    @cython.wraparound(False)
+    cpdef list advance_time(self, uint64_t to_time_ns):
+        """
+        Advance all registered clocks to the given time.
+
+        Parameters
+        ----------
+        to_time_ns : uint64_t
+            The UNIX time (nanoseconds) advance the clocks to.
+
+        Returns
+        -------
+        list[TimeEventHandler]
+            Sorted chronologically. Events at the same time for timers with an
+            identical schedule are in the order their timers were set, ahead of
+            the events for timers whose earliest set timer was set later.
+
+        Raises
+        ------
+        ValueError
+            If `to_time_ns` is < the schedulers current time.
+
+        """
+        # Ensure monotonic
+        Condition.true(to_time_ns >= self.time_ns, "to_time_ns was < self.time_ns")
+
+        cdef uint64_t count = time_event_scheduler_advance_time(&self._mem, to_time_ns)
+        self.time_ns = to_time_ns
+
+        cdef list event_handlers = []
+        if count == 0:
+            return event_handlers  # No timer events to iterate
+
+        cdef const TimeEventRecord_t *records = time_event_scheduler_events(&self._mem)
+        cdef TestClock clock
+        cdef TestTimer timer
+        cdef uint64_t i
+        for i in range(count):
+            clock, timer = self._timers[records[i].timer_id]
+            event_handlers.append(
+                TimeEventHandler.create_c(timer.name, records[i].ts_event, timer.callback),
+            )
+            timer.iterate_next_time(records[i].ts_event)
+            if records[i].is_expired:
+                clock._remove_timer(timer)
+            else:
+                clock._is_timing_stale = True  # Next event time recomputed when read
+
+        return event_handlers
+
+    cdef void _add_timer(self, TestClock clock, TestTimer timer) except *:
+        cdef uint64_t timer_id = clock._timer_ids.get(timer.name, 0)
+        if timer_id != 0:
+            # Replaces the clocks existing timer with the same name
+            self._timers.pop(timer_id, None)
+            time_event_scheduler_cancel_timer(&self._mem, timer_id)
+
+        timer_id = self._next_timer_id
+        self._next_timer_id += 1
+        clock._timer_ids[timer.name] = timer_id
+        self._timers[timer_id] = (clock, timer)
+        time_event_scheduler_add_timer(
+            &self._mem,
+            timer_id,
+            timer.interval_ns,
+            timer.next_time_ns,
+            timer.stop_time_ns,
+        )
+
+    cdef void _cancel_timer(self, TestClock clock, TestTimer timer) except *:
+        cdef uint64_t timer_id = clock._timer_ids.get(timer.name, 0)
+        if timer_id == 0 or self._timers[timer_id][1] is not timer:
+            return  # Timer was already canceled or replaced
+        clock._timer_ids.pop(timer.name)
+        self._timers.pop(timer_id)
+        time_event_scheduler_cancel_timer(&self._mem, timer_id)
+
+
 cdef class LiveClock(Clock):
     """
     Provides a clock for live trading. All times are timezone aware UTC.
@@ -696,12 +971,21 @@ cdef class LiveClock(Clock):
     ----------
     loop : asyncio.AbstractEventLoop
         The event loop for the clocks timers.
+    wheel : TimerWheel, optional
+        The timing wheel to drive the clocks timers (if None then the wheel
+        shared by all live clocks is used).
+
+    Notes
+    -----
+    Timer events are handled on the event loop, or on the wheel thread if no
+    loop is given.
     """
 
-    def __init__(self, loop=None):
+    def __init__(self, loop=None, TimerWheel wheel=None):
         super().__init__()
 
         self._loop = loop
+        self._wheel = wheel
 
     cpdef double timestamp(self) except *:
         """
@@ -768,25 +1052,18 @@ cdef class LiveClock(Clock):
         uint64_t start_time_ns,
         uint64_t stop_time_ns,
     ):
-        if self._loop is not None:
-            return LoopTimer(
-                loop=self._loop,
-                name=name,
-                callback=self._raise_time_event,
-                interval_ns=interval_ns,
-                now_ns=self.timestamp_ns(),  # Timestamp now here for accuracy
-                start_time_ns=start_time_ns,
-                stop_time_ns=stop_time_ns,
-            )
-        else:
-            return ThreadTimer(
-                name=name,
-                callback=self._raise_time_event,
-                interval_ns=interval_ns,
-                now_ns=self.timestamp_ns(),  # Timestamp now here for accuracy
-                start_time_ns=start_time_ns,
-                stop_time_ns=stop_time_ns,
-            )
+        if self._wheel is None:
+            self._wheel = get_timer_wheel()  # Started on first use
+        return WheelTimer(
+            wheel=self._wheel,
+            loop=self._loop,
+            name=name,
+            callback=self._raise_time_event,
+            interval_ns=interval_ns,
+            now_ns=self.timestamp_ns(),  # Timestamp now here for accuracy
+            start_time_ns=start_time_ns,
+            stop_time_ns=stop_time_ns,
+        )
 
     cpdef void _raise_time_event(self, LiveTimer timer) except *:
         cdef TimeEvent event = timer.pop_event(
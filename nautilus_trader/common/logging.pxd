@@ -53,6 +53,11 @@ cpdef enum LogColor:
     RED = 6
 
 
+cpdef enum LogFileFormat:
+    BINARY = 0
+    JSON = 1
+
+
 cdef class LogLevelParser:
 
     @staticmethod
@@ -68,6 +73,18 @@ cdef class Logger:
     cdef list _sinks
 
     cpdef void register_sink(self, handler: Callable[[Dict], None]) except *
+    cpdef void flush(self) except *
+    cpdef void set_component_level(self, str component, LogLevel level) except *
+    cpdef void add_file_sink(
+        self,
+        str directory,
+        str basename=*,
+        LogLevel level=*,
+        LogFileFormat fmt=*,
+        uint64_t max_size_bytes=*,
+        uint64_t rotation_interval_ns=*,
+    ) except *
+    cpdef bint is_enabled(self, LogLevel level, str component) except *
     cdef void change_clock_c(self, Clock clock) except *
     cdef dict create_record(self, LogLevel level, str component, str msg, dict annotations=*)
     cdef void log(
@@ -96,6 +113,7 @@ cdef class LoggerAdapter:
     cdef bint _is_bypassed
 
     cpdef Logger get_logger(self)
+    cpdef bint is_enabled(self, LogLevel level) except *
     cpdef void debug(self, str msg, LogColor color=*, dict annotations=*) except *
     cpdef void info(self, str msg, LogColor color=*, dict annotations=*) except *
     cpdef void warning(self, str msg, LogColor color=*, dict annotations=*) except *
@@ -46,14 +46,20 @@ from nautilus_trader.common.logging cimport LogLevel
 from nautilus_trader.common.queue cimport Queue
 from nautilus_trader.core.correctness cimport Condition
 from nautilus_trader.core.rust.common cimport LogColor as RustLogColor
+from nautilus_trader.core.rust.common cimport LogFileFormat as RustLogFileFormat
 from nautilus_trader.core.rust.common cimport LogLevel as RustLogLevel
+from nautilus_trader.core.rust.common cimport flush as logger_flush
+from nautilus_trader.core.rust.common cimport logger_add_file_sink
 from nautilus_trader.core.rust.common cimport logger_free
 from nautilus_trader.core.rust.common cimport logger_get_instance_id
 from nautilus_trader.core.rust.common cimport logger_get_machine_id
 from nautilus_trader.core.rust.common cimport logger_get_trader_id
+from nautilus_trader.core.rust.common cimport logger_is_async
 from nautilus_trader.core.rust.common cimport logger_is_bypassed
+from nautilus_trader.core.rust.common cimport logger_is_enabled
 from nautilus_trader.core.rust.common cimport logger_log
 from nautilus_trader.core.rust.common cimport logger_new
+from nautilus_trader.core.rust.common cimport logger_set_component_level
 from nautilus_trader.core.rust.core cimport unix_timestamp_ns
 from nautilus_trader.core.uuid cimport UUID4
 from nautilus_trader.model.identifiers cimport TraderId
@@ -136,6 +142,10 @@ cdef class Logger:
         The minimum log level for logging messages to stdout.
     bypass : bool
         If the logger should be bypassed.
+    is_async : bool
+        If log lines should be formatted and written on a background thread.
+        Lines are then only copied into a ring buffer on the calling thread,
+        with ERROR and above flushed as soon as they are written.
     """
 
     def __init__(
@@ -146,6 +156,7 @@ cdef class Logger:
         UUID4 instance_id=None,
         LogLevel level_stdout=LogLevel.INFO,
         bint bypass=False,
+        bint is_async=False,
     ):
         if trader_id is None:
             trader_id = TraderId("TRADER-000")
@@ -164,6 +175,7 @@ cdef class Logger:
             <PyObject *>instance_id_str,
             <RustLogLevel>level_stdout,
             <bint>bypass,
+            <bint>is_async,
         )
         self._sinks = []
 
@@ -218,6 +230,28 @@ cdef class Logger:
         """
         return <bint>logger_is_bypassed(&self._logger)
 
+    @property
+    def is_async(self) -> bool:
+        """
+        If the logger writes from a background thread.
+
+        Returns
+        -------
+        bool
+
+        """
+        return <bint>logger_is_async(&self._logger)
+
+    cpdef void flush(self) except *:
+        """
+        Flush all buffered log lines.
+
+        For an async logger this blocks until the background thread has
+        written every line logged before the call.
+
+        """
+        logger_flush(&self._logger)
+
     cpdef void register_sink(self, handler: Callable[[Dict], None]) except *:
         """
         Register the given sink handler with the logger.
@@ -238,6 +272,102 @@ cdef class Logger:
 
         self._sinks.append(handler)
 
+    cpdef void set_component_level(self, str component, LogLevel level) except *:
+        """
+        Set the minimum log level for logging messages from the given component
+        to stdout, overriding `level_stdout` for that component.
+
+        Parameters
+        ----------
+        component : str
+            The component name.
+        level : LogLevel
+            The minimum log level for the component.
+
+        """
+        Condition.valid_string(component, "component")
+
+        logger_set_component_level(&self._logger, <PyObject *>component, <RustLogLevel>level)
+
+    cpdef void add_file_sink(
+        self,
+        str directory,
+        str basename="nautilus",
+        LogLevel level=LogLevel.DEBUG,
+        LogFileFormat fmt=LogFileFormat.BINARY,
+        uint64_t max_size_bytes=0,
+        uint64_t rotation_interval_ns=0,
+    ) except *:
+        """
+        Add a file sink which writes log records at or above the given level
+        (independent of `level_stdout`) as structured records, replacing any
+        existing file sink.
+
+        Files are written through a large buffer as `{basename}_{seq}.bin` or
+        `{basename}_{seq}.jsonl`, rotating to the next sequence number when
+        either the size or time limit is reached. Binary files can be decoded
+        with the `nautilus_log_decode` tool.
+
+        Parameters
+        ----------
+        directory : str
+            The directory for the log files (created if it does not exist).
+        basename : str, default "nautilus"
+            The base name for the log files.
+        level : LogLevel, default ``DEBUG``
+            The minimum log level for writing records to the file.
+        fmt : LogFileFormat, default ``BINARY``
+            The record format for the file.
+        max_size_bytes : uint64_t, default 0
+            The file size at which to rotate (zero to disable).
+        rotation_interval_ns : uint64_t, default 0
+            The interval of log timestamps after which to rotate (zero to disable).
+
+        Raises
+        ------
+        OSError
+            If the log file cannot be opened.
+
+        """
+        Condition.valid_string(directory, "directory")
+        Condition.valid_string(basename, "basename")
+
+        if not logger_add_file_sink(
+            &self._logger,
+            <PyObject *>directory,
+            <PyObject *>basename,
+            <RustLogLevel>level,
+            <RustLogFileFormat>fmt,
+            max_size_bytes,
+            rotation_interval_ns,
+        ):
+            raise OSError(f"Cannot open log file in '{directory}'")
+
+    cpdef bint is_enabled(self, LogLevel level, str component) except *:
+        """
+        Return whether a message at the given level from the given component
+        would be logged.
+
+        Messages at ERROR and above are always enabled, as are all messages
+        while any sink handlers are registered.
+
+        Parameters
+        ----------
+        level : LogLevel
+            The log level.
+        component : str
+            The component name.
+
+        Returns
+        -------
+        bool
+
+        """
+        if self._sinks:
+            return True
+
+        return <bint>logger_is_enabled(&self._logger, <RustLogLevel>level, <PyObject *>component)
+
     cdef void change_clock_c(self, Clock clock) except *:
         """
         Change the loggers internal clock to the given clock.
@@ -417,6 +547,25 @@ cdef class LoggerAdapter:
         """
         return self._logger
 
+    cpdef bint is_enabled(self, LogLevel level) except *:
+        """
+        Return whether a message at the given level would be logged for the
+        component.
+
+        Can be used to guard the construction of expensive messages.
+
+        Parameters
+        ----------
+        level : LogLevel
+            The log level.
+
+        Returns
+        -------
+        bool
+
+        """
+        return not self._is_bypassed and self._logger.is_enabled(level, self._component)
+
     cpdef void debug(
         self,
         str msg,
@@ -438,7 +587,7 @@ cdef class LoggerAdapter:
         """
         Condition.not_none(msg, "message")
 
-        if self.is_bypassed:
+        if self._is_bypassed or not self._logger.is_enabled(LogLevel.DEBUG, self._component):
             return
 
         self._logger.log(
@@ -470,7 +619,7 @@ cdef class LoggerAdapter:
         """
         Condition.not_none(msg, "msg")
 
-        if self.is_bypassed:
+        if self._is_bypassed or not self._logger.is_enabled(LogLevel.INFO, self._component):
             return
 
         self._logger.log(
@@ -503,7 +652,7 @@ cdef class LoggerAdapter:
         """
         Condition.not_none(msg, "msg")
 
-        if self.is_bypassed:
+        if self._is_bypassed or not self._logger.is_enabled(LogLevel.WARNING, self._component):
             return
 
         self._logger.log(
@@ -724,6 +873,8 @@ cdef class LiveLogger(Logger):
         If the logger should be bypassed.
     maxsize : int, optional
         The maximum capacity for the log queue.
+    is_async : bool
+        If log lines should be formatted and written on a background thread.
     """
     _sentinel = None
 
@@ -737,6 +888,7 @@ cdef class LiveLogger(Logger):
         LogLevel level_stdout=LogLevel.INFO,
         bint bypass=False,
         int maxsize=10000,
+        bint is_async=False,
     ):
         super().__init__(
             clock=clock,
@@ -745,6 +897,7 @@ cdef class LiveLogger(Logger):
             instance_id=instance_id,
             level_stdout=level_stdout,
             bypass=bypass,
+            is_async=is_async,
         )
 
         self._loop = loop
@@ -16,21 +16,35 @@
 from libc.stdint cimport uint64_t
 
 from nautilus_trader.core.message cimport Event
+from nautilus_trader.core.rust.common cimport CTimerWheel
+from nautilus_trader.core.rust.common cimport TimeEventRecord_t
 from nautilus_trader.core.uuid cimport UUID4
 
 
+ctypedef uint64_t (* timer_wheel_wait_func)(const CTimerWheel *wheel, TimeEventRecord_t *buffer, uint64_t capacity) nogil  # noqa E211 whitespace before '('
+
+
 cdef class TimeEvent(Event):
     cdef readonly str name
     """The time events unique name.\n\n:returns: `str`"""
 
+    @staticmethod
+    cdef TimeEvent create_c(str name, uint64_t ts_event, uint64_t ts_init)
+
 
 cdef class TimeEventHandler:
     cdef object _handler
-    cdef readonly TimeEvent event
-    """The handlers event.\n\n:returns: `TimeEvent`"""
+    cdef str _name
+    cdef TimeEvent _event
+    cdef readonly uint64_t ts_event
+    """The UNIX timestamp (nanoseconds) when the time event occurred.\n\n:returns: `uint64_t`"""
 
+    cdef TimeEvent event_c(self)
     cpdef void handle(self) except *
 
+    @staticmethod
+    cdef TimeEventHandler create_c(str name, uint64_t ts_event, handler)
+
 
 cdef class Timer:
     cdef readonly str name
@@ -72,3 +86,29 @@ cdef class ThreadTimer(LiveTimer):
 
 cdef class LoopTimer(LiveTimer):
     cdef object _loop
+
+
+cdef class WheelTimer
+
+
+cdef class TimerWheel:
+    cdef CTimerWheel _mem
+    cdef dict _timers
+    cdef uint64_t _next_timer_id
+    cdef object _thread
+
+    cpdef void shutdown(self) except *
+
+    cdef void _add_timer(self, WheelTimer timer) except *
+    cdef void _cancel_timer(self, WheelTimer timer) except *
+    cdef void _dispatch(self, TimeEventRecord_t *records, uint64_t count) except *
+
+
+cdef class WheelTimer(LiveTimer):
+    cdef TimerWheel _wheel
+    cdef object _loop
+    cdef uint64_t _timer_id
+    cdef bint _is_canceled
+
+
+cpdef TimerWheel get_timer_wheel()
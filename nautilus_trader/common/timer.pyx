@@ -13,6 +13,8 @@
 #  limitations under the License.
 # -------------------------------------------------------------------------------------------------
 
+import sys
+import threading
 from typing import Callable
 
 from libc.stdint cimport uint64_t
@@ -23,9 +25,20 @@ from nautilus_trader.common.timer cimport TimeEvent
 from nautilus_trader.core.correctness cimport Condition
 from nautilus_trader.core.datetime cimport nanos_to_secs
 from nautilus_trader.core.message cimport Event
+from nautilus_trader.core.message cimport MessageCategory
+from nautilus_trader.core.rust.common cimport TimeEventRecord_t
+from nautilus_trader.core.rust.common cimport timer_wheel_add_timer
+from nautilus_trader.core.rust.common cimport timer_wheel_cancel_timer
+from nautilus_trader.core.rust.common cimport timer_wheel_free
+from nautilus_trader.core.rust.common cimport timer_wheel_new
+from nautilus_trader.core.rust.common cimport timer_wheel_shutdown
+from nautilus_trader.core.rust.common cimport timer_wheel_wait
 from nautilus_trader.core.uuid cimport UUID4
 
 
+cdef uint64_t _WHEEL_BATCH_CAPACITY = 256
+
+
 cdef class TimeEvent(Event):
     """
     Represents a time event occurring at the event timestamp.
@@ -64,6 +77,16 @@ cdef class TimeEvent(Event):
             f"id={self.id})"
         )
 
+    @staticmethod
+    cdef TimeEvent create_c(str name, uint64_t ts_event, uint64_t ts_init):
+        cdef TimeEvent event = TimeEvent.__new__(TimeEvent)
+        event.category = MessageCategory.EVENT
+        event.id = UUID4.deferred_c()  # Generated only if the ID is read
+        event.ts_event = ts_event
+        event.ts_init = ts_init
+        event.name = name
+        return event
+
 
 cdef class TimeEventHandler:
     """
@@ -75,8 +98,28 @@ cdef class TimeEventHandler:
         TimeEvent event not None,
         handler not None: Callable[[TimeEvent], None],
     ):
-        self.event = event
         self._handler = handler
+        self._name = event.name
+        self._event = event
+        self.ts_event = event.ts_event
+
+    @property
+    def event(self) -> TimeEvent:
+        """
+        The handlers event.
+
+        Returns
+        -------
+        TimeEvent
+
+        """
+        return self.event_c()
+
+    cdef TimeEvent event_c(self):
+        # The event for handlers generated by clocks is created on first access
+        if self._event is None:
+            self._event = TimeEvent.create_c(self._name, self.ts_event, self.ts_event)
+        return self._event
 
     def handle_py(self) -> None:
         """
@@ -85,29 +128,37 @@ cdef class TimeEventHandler:
         self.handle()
 
     cpdef void handle(self) except *:
-        self._handler(self.event)
+        self._handler(self.event_c())
 
     def __eq__(self, TimeEventHandler other) -> bool:
-        return self.event.ts_event == other.event.ts_event
+        return self.ts_event == other.ts_event
 
     def __lt__(self, TimeEventHandler other) -> bool:
-        return self.event.ts_event < other.event.ts_event
+        return self.ts_event < other.ts_event
 
     def __le__(self, TimeEventHandler other) -> bool:
-        return self.event.ts_event <= other.event.ts_event
+        return self.ts_event <= other.ts_event
 
     def __gt__(self, TimeEventHandler other) -> bool:
-        return self.event.ts_event > other.event.ts_event
+        return self.ts_event > other.ts_event
 
     def __ge__(self, TimeEventHandler other) -> bool:
-        return self.event.ts_event >= other.event.ts_event
+        return self.ts_event >= other.ts_event
 
     def __repr__(self) -> str:
         return (
             f"{type(self).__name__}("
-            f"event={self.event})"
+            f"event={self.event_c()})"
         )
 
+    @staticmethod
+    cdef TimeEventHandler create_c(str name, uint64_t ts_event, handler):
+        cdef TimeEventHandler event_handler = TimeEventHandler.__new__(TimeEventHandler)
+        event_handler._handler = handler
+        event_handler._name = name
+        event_handler.ts_event = ts_event
+        return event_handler
+
 
 cdef class Timer:
     """
@@ -275,10 +326,7 @@ cdef class TestTimer(Timer):
         """
         cdef list events = []  # type: list[TimeEvent]
         while not self.is_expired and to_time_ns >= self.next_time_ns:
-            events.append(self.pop_event(
-                event_id=UUID4(),
-                ts_init=self.next_time_ns,
-            ))
+            events.append(TimeEvent.create_c(self.name, self.next_time_ns, self.next_time_ns))
             self.iterate_next_time(to_time_ns=self.next_time_ns)
 
         return events
@@ -292,10 +340,7 @@ cdef class TestTimer(Timer):
         TimeEvent
 
         """
-        cdef TimeEvent event = self.pop_event(
-            event_id=UUID4(),
-            ts_init=self.next_time_ns,
-        )
+        cdef TimeEvent event = TimeEvent.create_c(self.name, self.next_time_ns, self.next_time_ns)
         self.iterate_next_time(to_time_ns=self.next_time_ns)
 
         return event
@@ -489,3 +534,249 @@ cdef class LoopTimer(LiveTimer):
             self.callback,
             self,
         )
+
+
+cdef class TimerWheel:
+    """
+    Provides a timing wheel which drives many live timers from a single thread.
+
+    The wheel thread blocks in Rust (without the GIL) until timers are due,
+    then calls the callbacks of timers without an event loop directly, and
+    posts the timers for each event loop to that loop as a single batch.
+
+    Parameters
+    ----------
+    tick_ns : uint64_t, default 1_000_000
+        The resolution of the wheel (timers fire on the first tick at or after
+        their next time).
+    num_slots : uint64_t, default 1024
+        The number of slots in the wheel.
+
+    Raises
+    ------
+    ValueError
+        If `tick_ns` is not positive (> 0).
+    ValueError
+        If `num_slots` is not positive (> 0).
+    """
+
+    def __init__(self, uint64_t tick_ns=1_000_000, uint64_t num_slots=1024):
+        Condition.positive_int(tick_ns, "tick_ns")
+        Condition.positive_int(num_slots, "num_slots")
+
+        self._mem = timer_wheel_new(tick_ns, num_slots)
+        self._timers = {}  # type: dict[int, WheelTimer]
+        self._next_timer_id = 1
+        self._thread = threading.Thread(target=self._run, name="timer-wheel", daemon=True)
+        self._thread.start()
+
+    def __del__(self):
+        timer_wheel_free(self._mem)
+
+    @property
+    def timer_count(self) -> int:
+        """
+        The number of timers active in the wheel.
+
+        Returns
+        -------
+        int
+
+        """
+        return len(self._timers)
+
+    cpdef void shutdown(self) except *:
+        """
+        Stop the wheel thread (no further timer events will be generated).
+        """
+        timer_wheel_shutdown(&self._mem)
+        if self._thread is not threading.current_thread():
+            self._thread.join()
+
+    def _run(self) -> None:
+        cdef timer_wheel_wait_func wait = <timer_wheel_wait_func>timer_wheel_wait
+        cdef TimeEventRecord_t records[256]
+        cdef uint64_t count
+        while True:
+            with nogil:
+                count = wait(&self._mem, records, _WHEEL_BATCH_CAPACITY)
+            if count == 0:
+                return  # Shutdown
+            self._dispatch(records, count)
+
+    cdef void _add_timer(self, WheelTimer timer) except *:
+        timer._timer_id = self._next_timer_id
+        self._next_timer_id += 1
+        self._timers[timer._timer_id] = timer
+        timer_wheel_add_timer(
+            &self._mem,
+            timer._timer_id,
+            timer.interval_ns,
+            timer.next_time_ns,
+            timer.stop_time_ns,
+        )
+
+    cdef void _cancel_timer(self, WheelTimer timer) except *:
+        self._timers.pop(timer._timer_id, None)
+        timer_wheel_cancel_timer(&self._mem, timer._timer_id)
+
+    cdef void _dispatch(self, TimeEventRecord_t *records, uint64_t count) except *:
+        cdef dict batches = {}  # type: dict[asyncio.AbstractEventLoop, list[WheelTimer]]
+        cdef list batch
+        cdef WheelTimer timer
+        cdef uint64_t i
+        for i in range(count):
+            timer = self._timers.get(records[i].timer_id)
+            if timer is None:
+                continue  # Canceled
+            if records[i].is_expired:
+                self._timers.pop(records[i].timer_id, None)
+            if timer._loop is None:
+                _fire(timer)  # On the wheel thread
+                continue
+            batch = batches.get(timer._loop)
+            if batch is None:
+                batch = []
+                batches[timer._loop] = batch
+            batch.append(timer)
+
+        for loop, batch in batches.items():
+            loop.call_soon_threadsafe(_fire_batch, batch)
+
+
+cdef void _fire(WheelTimer timer) except *:
+    if timer._is_canceled:
+        return
+    try:
+        timer.callback(timer)
+    except Exception:
+        if timer._loop is None:
+            sys.excepthook(*sys.exc_info())
+        else:
+            raise
+
+
+def _fire_batch(list batch) -> None:
+    cdef WheelTimer timer
+    for timer in batch:
+        try:
+            _fire(timer)
+        except Exception as e:
+            timer._loop.call_exception_handler({
+                "message": f"Exception in callback for timer {timer.name}",
+                "exception": e,
+            })
+
+
+cdef TimerWheel _TIMER_WHEEL = None
+
+
+cpdef TimerWheel get_timer_wheel():
+    """
+    Return the timing wheel shared by live clocks (started on first use).
+
+    Returns
+    -------
+    TimerWheel
+
+    """
+    global _TIMER_WHEEL
+    if _TIMER_WHEEL is None:
+        _TIMER_WHEEL = TimerWheel()
+    return _TIMER_WHEEL
+
+
+cdef class WheelTimer(LiveTimer):
+    """
+    Provides a live timer driven by a shared `TimerWheel`.
+
+    Parameters
+    ----------
+    wheel : TimerWheel
+        The timing wheel to drive the timer.
+    loop : asyncio.AbstractEventLoop, optional
+        The event loop to call the callback on (if None then the callback is
+        called on the wheel thread).
+    name : str
+        The name for the timer.
+    callback : Callable[[TimeEvent], None]
+        The delegate to call at the next time.
+    interval_ns : uint64_t
+        The time interval for the timer.
+    now_ns : uint64_t
+        The datetime now (UTC).
+    start_time_ns : uint64_t
+        The start datetime for the timer (UTC).
+    stop_time_ns : uint64_t, optional
+        The stop datetime for the timer (UTC) (if None then timer repeats).
+
+    Raises
+    ------
+    TypeError
+        If `callback` is not of type `Callable`.
+    """
+
+    def __init__(
+        self,
+        TimerWheel wheel not None,
+        loop,
+        str name not None,
+        callback not None: Callable[[TimeEvent], None],
+        uint64_t interval_ns,
+        uint64_t now_ns,
+        uint64_t start_time_ns,
+        uint64_t stop_time_ns=0,
+    ):
+        Condition.valid_string(name, "name")
+
+        # Assign here as `super().__init__` will call `_start_timer`
+        self._wheel = wheel
+        self._loop = loop
+        self._timer_id = 0
+        self._is_canceled = False
+        super().__init__(
+            name=name,
+            callback=callback,
+            interval_ns=interval_ns,
+            now_ns=now_ns,
+            start_time_ns=start_time_ns,
+            stop_time_ns=stop_time_ns,
+        )
+
+    cpdef void iterate_next_time(self, uint64_t now_ns) except *:
+        """
+        Iterates the timers next time and checks if the timer is now expired.
+
+        Parameters
+        ----------
+        now_ns : uint64_t
+            The UNIX time now (nanoseconds).
+
+        """
+        Timer.iterate_next_time(self, now_ns)
+        if self.is_expired:
+            self._wheel._cancel_timer(self)
+
+    cpdef void repeat(self, uint64_t now_ns) except *:
+        """
+        Continue the timer.
+
+        The wheel schedules the timers next time itself, so this does nothing.
+
+        Parameters
+        ----------
+        now_ns : uint64_t
+            The current time to continue timing from.
+
+        """
+        pass
+
+    cpdef void cancel(self) except *:
+        """
+        Cancels the timer (the timer will not generate an event).
+        """
+        self._is_canceled = True
+        self._wheel._cancel_timer(self)
+
+    cdef object _start_timer(self, uint64_t now_ns):
+        self._wheel._add_timer(self)
@@ -33,6 +33,7 @@ from nautilus_trader.config.common import ExecEngineConfig
 from nautilus_trader.config.common import ImportableActorConfig
 from nautilus_trader.config.common import ImportableStrategyConfig
 from nautilus_trader.config.common import InstrumentProviderConfig
+from nautilus_trader.config.common import LoggingConfig
 from nautilus_trader.config.common import NautilusKernelConfig
 from nautilus_trader.config.common import RiskEngineConfig
 from nautilus_trader.config.common import StrategyConfig
@@ -63,6 +64,7 @@ __all__ = [
     "ImportableActorConfig",
     "ImportableStrategyConfig",
     "InstrumentProviderConfig",
+    "LoggingConfig",
     "NautilusKernelConfig",
     "RiskEngineConfig",
     "StrategyConfig",
@@ -182,6 +182,17 @@ class BacktestDataConfig(Partialable):
             fs_storage_options=self.catalog_fs_storage_options,
         )
 
+    def load_table(self):
+        catalog = self.catalog()
+        return catalog._load_table(
+            cls=self.data_type,
+            instrument_ids=[self.instrument_id] if self.instrument_id else None,
+            start=self.start_time,
+            end=self.end_time,
+            filter_expr=parse_filters_expr(self.filter_expr),
+            raise_on_empty=False,
+        )
+
     def load(self, start_time=None, end_time=None):
         query = self.query
         query.update(
@@ -241,8 +252,13 @@ class BacktestEngineConfig(NautilusKernelConfig):
         If trading strategy state should be saved to the database on stop.
     bypass_logging : bool, default False
         If logging should be bypassed.
+    logging : LoggingConfig, optional
+        The logging configuration for the engine.
     run_analysis : bool, default True
         If post backtest performance analysis should be run.
+    profile : bool, default False
+        If the wall and CPU time of each stage of a run should be accounted,
+        and returned as the `profile` of the backtest result.
 
     """
 
@@ -252,6 +268,7 @@ class BacktestEngineConfig(NautilusKernelConfig):
     risk_engine: RiskEngineConfig = RiskEngineConfig()
     exec_engine: ExecEngineConfig = ExecEngineConfig()
     run_analysis: bool = True
+    profile: bool = False
 
     def __tokenize__(self):
         return tuple(self.dict().items())
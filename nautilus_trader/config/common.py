@@ -22,6 +22,7 @@ import pydantic
 from frozendict import frozendict
 from pydantic import ConstrainedStr
 from pydantic import Field
+from pydantic import NonNegativeInt
 from pydantic import PositiveInt
 from pydantic import validator
 
@@ -190,6 +191,42 @@ class ExecEngineConfig(NautilusConfig):
     debug: bool = False
 
 
+class LoggingConfig(NautilusConfig):
+    """
+    Configuration for the kernels ``Logger``.
+
+    Parameters
+    ----------
+    is_async : bool, default False
+        If log lines should be formatted and written on a background thread.
+    component_levels : dict[str, str], optional
+        The minimum stdout log level per component name, overriding the kernels
+        log level for those components.
+    file_directory : str, optional
+        The directory for the structured log file sink. If ``None`` then no file
+        sink is added.
+    file_basename : str, default "nautilus"
+        The base name for the log files.
+    file_level : str, default "DEBUG"
+        The minimum log level for writing records to the file.
+    file_format : str {'BINARY', 'JSON'}, default 'BINARY'
+        The record format for the file.
+    file_max_size_bytes : int, default 0
+        The file size at which to rotate (zero to disable).
+    file_rotation_interval_ns : int, default 0
+        The interval of log timestamps after which to rotate (zero to disable).
+    """
+
+    is_async: bool = False
+    component_levels: Optional[Dict[str, str]] = None
+    file_directory: Optional[str] = None
+    file_basename: str = "nautilus"
+    file_level: str = "DEBUG"
+    file_format: str = "BINARY"
+    file_max_size_bytes: NonNegativeInt = 0
+    file_rotation_interval_ns: NonNegativeInt = 0
+
+
 class StreamingConfig(NautilusConfig):
     """
     Configuration for streaming live or backtest runs to the catalog in feather format.
@@ -408,6 +445,8 @@ class NautilusKernelConfig(NautilusConfig):
         The stdout log level for the node.
     bypass_logging : bool, default False
         If logging to stdout should be bypassed.
+    logging : LoggingConfig, optional
+        The logging configuration for the kernel.
     """
 
     environment: Environment
@@ -425,3 +464,4 @@ class NautilusKernelConfig(NautilusConfig):
     loop_debug: bool = False
     log_level: str = "INFO"
     bypass_logging: bool = False
+    logging: Optional[LoggingConfig] = None
@@ -170,6 +170,8 @@ class TradingNodeConfig(NautilusKernelConfig):
         If trading strategy state should be saved to the database on stop.
     log_level : str, default "INFO"
         The stdout log level for the node.
+    logging : LoggingConfig, optional
+        The logging configuration for the node.
     loop_debug : bool, default False
         If the asyncio event loop should be in debug mode.
     timeout_connection : PositiveFloat (seconds)
@@ -15,6 +15,11 @@ typedef enum LogColor {
     RED = 6,
 } LogColor;
 
+typedef enum LogFileFormat {
+    BINARY = 0,
+    JSON = 1,
+} LogFileFormat;
+
 typedef enum LogLevel {
     DEBUG = 10,
     INFO = 20,
@@ -25,6 +30,10 @@ typedef enum LogLevel {
 
 typedef struct Logger_t Logger_t;
 
+typedef struct TimeEventScheduler_t TimeEventScheduler_t;
+
+typedef struct TimerWheel_t TimerWheel_t;
+
 /**
  * Logger is not C FFI safe, so we box and pass it as an opaque pointer.
  * This works because Logger fields don't need to be accessed, only functions
@@ -34,9 +43,38 @@ typedef struct CLogger {
     struct Logger_t *_0;
 } CLogger;
 
+/**
+ * Represents a time event which occurred for a scheduled timer.
+ */
+typedef struct TimeEventRecord_t {
+    uint64_t timer_id;
+    uint64_t ts_event;
+    uint8_t is_expired;
+} TimeEventRecord_t;
+
+/**
+ * TimeEventScheduler is not C FFI safe, so we box and pass it as an opaque
+ * pointer.
+ */
+typedef struct CTimeEventScheduler {
+    struct TimeEventScheduler_t *_0;
+} CTimeEventScheduler;
+
+/**
+ * TimerWheel is not C FFI safe, so we box and pass it as an opaque pointer.
+ *
+ * All functions other than `timer_wheel_free` may be called concurrently.
+ */
+typedef struct CTimerWheel {
+    struct TimerWheel_t *_0;
+} CTimerWheel;
+
 /**
  * Creates a logger from a valid Python object pointer and a defined logging level.
  *
+ * If `is_async` is set then lines are passed through a ring buffer to a
+ * background thread for formatting and writing.
+ *
  * # Safety
  * - `trader_id_ptr` must be borrowed from a valid Python UTF-8 `str`.
  * - `machine_id_ptr` must be borrowed from a valid Python UTF-8 `str`.
@@ -46,7 +84,8 @@ struct CLogger logger_new(PyObject *trader_id_ptr,
                           PyObject *machine_id_ptr,
                           PyObject *instance_id_ptr,
                           enum LogLevel level_stdout,
-                          uint8_t is_bypassed);
+                          uint8_t is_bypassed,
+                          uint8_t is_async);
 
 void logger_free(struct CLogger logger);
 
@@ -76,6 +115,46 @@ UUID4_t logger_get_instance_id(const struct CLogger *logger);
 
 uint8_t logger_is_bypassed(const struct CLogger *logger);
 
+uint8_t logger_is_async(const struct CLogger *logger);
+
+/**
+ * Sets the minimum level for logging messages from the given component to stdout.
+ *
+ * # Safety
+ * - `component_ptr` must be borrowed from a valid Python UTF-8 `str`.
+ */
+void logger_set_component_level(struct CLogger *logger,
+                                PyObject *component_ptr,
+                                enum LogLevel level);
+
+/**
+ * Adds a file sink to the logger which writes records at or above the given
+ * level to files in the given directory, rotating by size and/or time.
+ *
+ * Returns 1 if the sink was added, or 0 if the first file could not be opened.
+ *
+ * # Safety
+ * - `directory_ptr` must be borrowed from a valid Python UTF-8 `str`.
+ * - `basename_ptr` must be borrowed from a valid Python UTF-8 `str`.
+ */
+uint8_t logger_add_file_sink(struct CLogger *logger,
+                             PyObject *directory_ptr,
+                             PyObject *basename_ptr,
+                             enum LogLevel level,
+                             enum LogFileFormat format,
+                             uint64_t max_size_bytes,
+                             uint64_t rotation_interval_ns);
+
+/**
+ * Return whether a message at the given level from the given component would be logged.
+ *
+ * # Safety
+ * - `component_ptr` must be borrowed from a valid Python UTF-8 `str`.
+ */
+uint8_t logger_is_enabled(const struct CLogger *logger,
+                          enum LogLevel level,
+                          PyObject *component_ptr);
+
 /**
  * Log a message from valid Python object pointers.
  *
@@ -89,3 +168,63 @@ void logger_log(struct CLogger *logger,
                 enum LogColor color,
                 PyObject *component_ptr,
                 PyObject *msg_ptr);
+
+struct CTimeEventScheduler time_event_scheduler_new(uint64_t initial_ns);
+
+void time_event_scheduler_free(struct CTimeEventScheduler scheduler);
+
+void time_event_scheduler_set_time(struct CTimeEventScheduler *scheduler, uint64_t to_time_ns);
+
+uint64_t time_event_scheduler_timer_count(const struct CTimeEventScheduler *scheduler);
+
+void time_event_scheduler_add_timer(struct CTimeEventScheduler *scheduler,
+                                    uint64_t timer_id,
+                                    uint64_t interval_ns,
+                                    uint64_t next_time_ns,
+                                    uint64_t stop_time_ns);
+
+void time_event_scheduler_cancel_timer(struct CTimeEventScheduler *scheduler, uint64_t timer_id);
+
+uint64_t time_event_scheduler_next_time_ns(struct CTimeEventScheduler *scheduler);
+
+/**
+ * Advances the scheduler to the given time, returning the number of events
+ * which can then be read with `time_event_scheduler_events`.
+ */
+uint64_t time_event_scheduler_advance_time(struct CTimeEventScheduler *scheduler,
+                                           uint64_t to_time_ns);
+
+/**
+ * Returns a pointer to the events generated by the last advance.
+ *
+ * The pointer is valid until the scheduler is next mutated.
+ */
+const struct TimeEventRecord_t *time_event_scheduler_events(const struct CTimeEventScheduler *scheduler);
+
+struct CTimerWheel timer_wheel_new(uint64_t tick_ns, uint64_t num_slots);
+
+void timer_wheel_free(struct CTimerWheel wheel);
+
+uint64_t timer_wheel_timer_count(const struct CTimerWheel *wheel);
+
+void timer_wheel_add_timer(const struct CTimerWheel *wheel,
+                           uint64_t timer_id,
+                           uint64_t interval_ns,
+                           uint64_t next_time_ns,
+                           uint64_t stop_time_ns);
+
+void timer_wheel_cancel_timer(const struct CTimerWheel *wheel, uint64_t timer_id);
+
+void timer_wheel_shutdown(const struct CTimerWheel *wheel);
+
+/**
+ * Blocks until timers are due, writing up to `capacity` events to `buffer`.
+ *
+ * Returns the number of events written, which is zero only on shutdown.
+ *
+ * # Safety
+ * - `buffer` must point to at least `capacity` writable `TimeEventRecord_t`.
+ */
+uint64_t timer_wheel_wait(const struct CTimerWheel *wheel,
+                          struct TimeEventRecord_t *buffer,
+                          uint64_t capacity);
@@ -0,0 +1,174 @@
+/* Generated with cbindgen:0.20.0 */
+
+/* Warning, this file is autogenerated by cbindgen. Don't modify this manually. */
+
+#include <stdint.h>
+
+/**
+ * Represents the type of moving average.
+ *
+ * The discriminants match the Python `MovingAverageType` enum.
+ */
+typedef enum MovingAverageType {
+    Simple = 0,
+    Exponential = 1,
+    Wilder = 5,
+} MovingAverageType;
+
+typedef struct AverageTrueRange_t AverageTrueRange_t;
+
+typedef struct ExponentialMovingAverage_t ExponentialMovingAverage_t;
+
+typedef struct SimpleMovingAverage_t SimpleMovingAverage_t;
+
+typedef struct BollingerBands_t BollingerBands_t;
+
+typedef struct RelativeStrengthIndex_t RelativeStrengthIndex_t;
+
+/**
+ * AverageTrueRange is not C FFI safe, so we box and pass it as an opaque pointer.
+ */
+typedef struct CAverageTrueRange {
+    struct AverageTrueRange_t *_0;
+} CAverageTrueRange;
+
+/**
+ * ExponentialMovingAverage is not C FFI safe, so we box and pass it as an
+ * opaque pointer.
+ */
+typedef struct CExponentialMovingAverage {
+    struct ExponentialMovingAverage_t *_0;
+} CExponentialMovingAverage;
+
+/**
+ * SimpleMovingAverage is not C FFI safe, so we box and pass it as an opaque
+ * pointer.
+ */
+typedef struct CSimpleMovingAverage {
+    struct SimpleMovingAverage_t *_0;
+} CSimpleMovingAverage;
+
+/**
+ * BollingerBands is not C FFI safe, so we box and pass it as an opaque pointer.
+ */
+typedef struct CBollingerBands {
+    struct BollingerBands_t *_0;
+} CBollingerBands;
+
+/**
+ * RelativeStrengthIndex is not C FFI safe, so we box and pass it as an opaque pointer.
+ */
+typedef struct CRelativeStrengthIndex {
+    struct RelativeStrengthIndex_t *_0;
+} CRelativeStrengthIndex;
+
+struct CAverageTrueRange atr_new(uintptr_t period,
+                                 enum MovingAverageType ma_type,
+                                 uint8_t use_previous,
+                                 double value_floor);
+
+void atr_free(struct CAverageTrueRange atr);
+
+double atr_update_raw(struct CAverageTrueRange *atr, double high, double low, double close);
+
+/**
+ * Update the indicator with `len` raw values and return the latest value.
+ *
+ * # Safety
+ * - `high`, `low` and `close` must each point to `len` contiguous values.
+ */
+double atr_update_many(struct CAverageTrueRange *atr,
+                       const double *high,
+                       const double *low,
+                       const double *close,
+                       uintptr_t len);
+
+void atr_reset(struct CAverageTrueRange *atr);
+
+uint8_t atr_initialized(const struct CAverageTrueRange *atr);
+
+struct CExponentialMovingAverage ema_new(uintptr_t period, double alpha);
+
+void ema_free(struct CExponentialMovingAverage ema);
+
+double ema_update_raw(struct CExponentialMovingAverage *ema, double value);
+
+/**
+ * Update the indicator with `len` raw values and return the latest value.
+ *
+ * # Safety
+ * - `values` must point to `len` contiguous values.
+ */
+double ema_update_many(struct CExponentialMovingAverage *ema, const double *values, uintptr_t len);
+
+void ema_reset(struct CExponentialMovingAverage *ema);
+
+uintptr_t ema_count(const struct CExponentialMovingAverage *ema);
+
+uint8_t ema_initialized(const struct CExponentialMovingAverage *ema);
+
+struct CSimpleMovingAverage sma_new(uintptr_t period);
+
+void sma_free(struct CSimpleMovingAverage sma);
+
+double sma_update_raw(struct CSimpleMovingAverage *sma, double value);
+
+/**
+ * Update the indicator with `len` raw values and return the latest value.
+ *
+ * # Safety
+ * - `values` must point to `len` contiguous values.
+ */
+double sma_update_many(struct CSimpleMovingAverage *sma, const double *values, uintptr_t len);
+
+void sma_reset(struct CSimpleMovingAverage *sma);
+
+uintptr_t sma_count(const struct CSimpleMovingAverage *sma);
+
+uint8_t sma_initialized(const struct CSimpleMovingAverage *sma);
+
+struct CBollingerBands bb_new(uintptr_t period, double k, enum MovingAverageType ma_type);
+
+void bb_free(struct CBollingerBands bb);
+
+void bb_update_raw(struct CBollingerBands *bb, double high, double low, double close);
+
+/**
+ * Update the indicator with `len` prices.
+ *
+ * # Safety
+ * - `high`, `low` and `close` must each point to `len` contiguous values.
+ */
+void bb_update_many(struct CBollingerBands *bb,
+                    const double *high,
+                    const double *low,
+                    const double *close,
+                    uintptr_t len);
+
+void bb_reset(struct CBollingerBands *bb);
+
+double bb_upper(const struct CBollingerBands *bb);
+
+double bb_middle(const struct CBollingerBands *bb);
+
+double bb_lower(const struct CBollingerBands *bb);
+
+uint8_t bb_initialized(const struct CBollingerBands *bb);
+
+struct CRelativeStrengthIndex rsi_new(uintptr_t period, enum MovingAverageType ma_type);
+
+void rsi_free(struct CRelativeStrengthIndex rsi);
+
+double rsi_update_raw(struct CRelativeStrengthIndex *rsi, double value);
+
+/**
+ * Update the indicator with `len` values and return the latest value.
+ *
+ * # Safety
+ * - `values` must point to `len` contiguous values.
+ */
+double rsi_update_many(struct CRelativeStrengthIndex *rsi, const double *values, uintptr_t len);
+
+void rsi_reset(struct CRelativeStrengthIndex *rsi);
+
+uint8_t rsi_initialized(const struct CRelativeStrengthIndex *rsi);
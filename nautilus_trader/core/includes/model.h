@@ -5,10 +5,39 @@
 #include <stdint.h>
 #include <Python.h>
 
+/**
+ * The number of bytes which can be held without a heap allocation.
+ */
+#define INLINE_CAPACITY 36
+
 #define FIXED_PRECISION 9
 
 #define FIXED_SCALAR 1000000000.0
 
+typedef enum AggregationSource {
+    External = 1,
+    Internal = 2,
+} AggregationSource;
+
+typedef enum BarAggregation {
+    Tick = 1,
+    TickImbalance = 2,
+    TickRuns = 3,
+    Volume = 4,
+    VolumeImbalance = 5,
+    VolumeRuns = 6,
+    Value = 7,
+    ValueImbalance = 8,
+    ValueRuns = 9,
+    Millisecond = 10,
+    Second = 11,
+    Minute = 12,
+    Hour = 13,
+    Day = 14,
+    Week = 15,
+    Month = 16,
+} BarAggregation;
+
 typedef enum BookLevel {
     L1_TBBO = 1,
     L2_MBP = 2,
@@ -25,8 +54,35 @@ typedef enum OrderSide {
     Sell = 2,
 } OrderSide;
 
+typedef enum PriceType {
+    Bid = 1,
+    Ask = 2,
+    Mid = 3,
+    Last = 4,
+} PriceType;
+
 typedef struct BTreeMap_BookPrice__Level BTreeMap_BookPrice__Level;
 
+typedef struct BTreeMap_BookPrice__Quantity BTreeMap_BookPrice__Quantity;
+
+/**
+ * Provides a means of aggregating raw tick values into bars.
+ *
+ * Tick, volume and value bars are built as the step threshold of the bar
+ * specification is reached. Time bars are only built on request, as the
+ * build is driven by a clock timer external to the aggregator.
+ *
+ * Completed bars are queued until popped by the caller.
+ */
+typedef struct BarAggregator_t BarAggregator_t;
+
+/**
+ * Provides a generic bar builder for aggregation.
+ *
+ * All OHLCV arithmetic is performed on the raw fixed-point values.
+ */
+typedef struct BarBuilder_t BarBuilder_t;
+
 typedef struct HashMap_u64__BookPrice HashMap_u64__BookPrice;
 
 typedef struct String String;
@@ -44,6 +100,33 @@ typedef struct InstrumentId_t {
     struct Venue_t venue;
 } InstrumentId_t;
 
+/**
+ * Represents a bar aggregation specification including a step, aggregation
+ * method/rule and price type.
+ */
+typedef struct BarSpecification_t {
+    uint64_t step;
+    enum BarAggregation aggregation;
+    enum PriceType price_type;
+} BarSpecification_t;
+
+/**
+ * Represents a bar type including the instrument ID, bar specification and
+ * aggregation source.
+ */
+typedef struct BarType_t {
+    struct InstrumentId_t instrument_id;
+    struct BarSpecification_t spec;
+    enum AggregationSource aggregation_source;
+} BarType_t;
+
+/**
+ * BarBuilder is not C FFI safe, so we box and pass it as an opaque pointer.
+ */
+typedef struct CBarBuilder {
+    struct BarBuilder_t *_0;
+} CBarBuilder;
+
 typedef struct Price_t {
     int64_t raw;
     uint8_t precision;
@@ -54,6 +137,27 @@ typedef struct Quantity_t {
     uint8_t precision;
 } Quantity_t;
 
+/**
+ * Represents an aggregated bar.
+ */
+typedef struct Bar_t {
+    struct BarType_t bar_type;
+    struct Price_t open;
+    struct Price_t high;
+    struct Price_t low;
+    struct Price_t close;
+    struct Quantity_t volume;
+    uint64_t ts_event;
+    uint64_t ts_init;
+} Bar_t;
+
+/**
+ * BarAggregator is not C FFI safe, so we box and pass it as an opaque pointer.
+ */
+typedef struct CBarAggregator {
+    struct BarAggregator_t *_0;
+} CBarAggregator;
+
 /**
  * Represents a single quote tick in a financial market.
  */
@@ -67,8 +171,21 @@ typedef struct QuoteTick_t {
     uint64_t ts_init;
 } QuoteTick_t;
 
+/**
+ * Represents an immutable string which is stored inline when it fits within
+ * 36 bytes (a hyphenated UUID), otherwise it spills onto the heap.
+ *
+ * Most venue assigned identifiers fit inline, so passing them by value across
+ * the C ABI avoids a heap allocation per identifier.
+ */
+typedef struct InlineString {
+    uint8_t len;
+    uint8_t buf[INLINE_CAPACITY];
+    struct String *spill;
+} InlineString;
+
 typedef struct TradeId_t {
-    struct String *value;
+    struct InlineString value;
 } TradeId_t;
 
 /**
@@ -117,9 +234,25 @@ typedef struct TraderId_t {
 } TraderId_t;
 
 typedef struct VenueOrderId_t {
-    struct String *value;
+    struct InlineString value;
 } VenueOrderId_t;
 
+/**
+ * Represents the specification of an instrument needed to quantize prices and
+ * sizes, with all values held as raw fixed-point integers.
+ */
+typedef struct InstrumentSpec_t {
+    uint8_t price_precision;
+    uint8_t size_precision;
+    int64_t price_increment;
+    uint64_t size_increment;
+    uint64_t multiplier;
+    uint64_t min_quantity;
+    uint64_t max_quantity;
+    int64_t min_price;
+    int64_t max_price;
+} InstrumentSpec_t;
+
 typedef struct Ladder {
     enum OrderSide side;
     struct BTreeMap_BookPrice__Level *levels;
@@ -135,6 +268,41 @@ typedef struct OrderBook {
     uint64_t ts_last;
 } OrderBook;
 
+typedef struct Order {
+    struct Price_t price;
+    struct Quantity_t size;
+    enum OrderSide side;
+    uint64_t id;
+} Order;
+
+/**
+ * Provides a L1 TBBO (top of book best bid/offer) order book.
+ *
+ * Only the top level of each side is held, inline and without any heap
+ * allocation. A side with a zero size order is empty.
+ */
+typedef struct L1OrderBook {
+    struct Order bid;
+    struct Order ask;
+    struct InstrumentId_t instrument_id;
+    enum OrderSide last_side;
+    uint64_t ts_last;
+} L1OrderBook;
+
+/**
+ * Provides a L2 MBP (market by price) order book.
+ *
+ * Each price level holds only its aggregated size, so there are no per order
+ * queues or order ID caches to maintain.
+ */
+typedef struct L2OrderBook {
+    struct BTreeMap_BookPrice__Quantity *bids;
+    struct BTreeMap_BookPrice__Quantity *asks;
+    struct InstrumentId_t instrument_id;
+    enum OrderSide last_side;
+    uint64_t ts_last;
+} L2OrderBook;
+
 typedef struct Currency_t {
     struct String *code;
     uint8_t precision;
@@ -148,6 +316,127 @@ typedef struct Money_t {
     struct Currency_t currency;
 } Money_t;
 
+struct CBarBuilder bar_builder_new(struct BarType_t bar_type,
+                                   uint8_t price_precision,
+                                   uint8_t size_precision);
+
+void bar_builder_free(struct CBarBuilder builder);
+
+void bar_builder_set_partial(struct CBarBuilder *builder, const struct Bar_t *partial_bar);
+
+void bar_builder_update(struct CBarBuilder *builder,
+                        struct Price_t price,
+                        struct Quantity_t size,
+                        uint64_t ts_event);
+
+void bar_builder_reset(struct CBarBuilder *builder);
+
+struct Bar_t bar_builder_build(struct CBarBuilder *builder, uint64_t ts_event);
+
+uint8_t bar_builder_initialized(const struct CBarBuilder *builder);
+
+uint64_t bar_builder_ts_last(const struct CBarBuilder *builder);
+
+uint64_t bar_builder_count(const struct CBarBuilder *builder);
+
+/**
+ * Returns a pointer to a valid Python UTF-8 string.
+ *
+ * # Safety
+ * - Assumes that since the data is originating from Rust, the GIL does not need
+ * to be acquired.
+ * - Assumes you are immediately returning this pointer to Python.
+ */
+PyObject *bar_builder_to_pystr(const struct CBarBuilder *builder);
+
+struct CBarAggregator bar_aggregator_new(struct BarType_t bar_type,
+                                         uint8_t price_precision,
+                                         uint8_t size_precision);
+
+void bar_aggregator_free(struct CBarAggregator aggregator);
+
+/**
+ * Update the aggregator from the quote tick and return the number of completed
+ * bars pending.
+ */
+uint64_t bar_aggregator_handle_quote_tick(struct CBarAggregator *aggregator,
+                                          const struct QuoteTick_t *tick);
+
+/**
+ * Update the aggregator from the trade tick and return the number of completed
+ * bars pending.
+ */
+uint64_t bar_aggregator_handle_trade_tick(struct CBarAggregator *aggregator,
+                                          const struct TradeTick_t *tick);
+
+/**
+ * Update the aggregator from `len` raw tick values and return the number of
+ * completed bars pending.
+ *
+ * # Safety
+ * - `prices`, `sizes` and `ts_events` must each point to `len` contiguous values.
+ */
+uint64_t bar_aggregator_update_batch(struct CBarAggregator *aggregator,
+                                     const int64_t *prices,
+                                     uint8_t price_prec,
+                                     const uint64_t *sizes,
+                                     uint8_t size_prec,
+                                     const uint64_t *ts_events,
+                                     uintptr_t len);
+
+void bar_aggregator_set_partial(struct CBarAggregator *aggregator, const struct Bar_t *partial_bar);
+
+/**
+ * Build a bar with the given closing timestamp and return the number of
+ * completed bars pending.
+ */
+uint64_t bar_aggregator_build(struct CBarAggregator *aggregator, uint64_t ts_event);
+
+uint64_t bar_aggregator_pending(const struct CBarAggregator *aggregator);
+
+/**
+ * Pops the oldest completed bar.
+ *
+ * # Panics
+ * - If there are no completed bars pending.
+ */
+struct Bar_t bar_aggregator_pop(struct CBarAggregator *aggregator);
+
+uint8_t bar_aggregator_initialized(const struct CBarAggregator *aggregator);
+
+uint64_t bar_aggregator_cum_value(const struct CBarAggregator *aggregator);
+
+struct BarType_t bar_type_new(struct InstrumentId_t instrument_id,
+                              uint64_t step,
+                              enum BarAggregation aggregation,
+                              enum PriceType price_type,
+                              enum AggregationSource aggregation_source);
+
+void bar_type_free(struct BarType_t bar_type);
+
+void bar_free(struct Bar_t bar);
+
+struct Bar_t bar_from_raw(struct BarType_t bar_type,
+                          int64_t open,
+                          int64_t high,
+                          int64_t low,
+                          int64_t close,
+                          uint8_t price_prec,
+                          uint64_t volume,
+                          uint8_t size_prec,
+                          uint64_t ts_event,
+                          uint64_t ts_init);
+
+/**
+ * Returns a pointer to a valid Python UTF-8 string.
+ *
+ * # Safety
+ * - Assumes that since the data is originating from Rust, the GIL does not need
+ * to be acquired.
+ * - Assumes you are immediately returning this pointer to Python.
+ */
+PyObject *bar_to_pystr(const struct Bar_t *bar);
+
 void quote_tick_free(struct QuoteTick_t tick);
 
 struct QuoteTick_t quote_tick_new(struct InstrumentId_t instrument_id,
@@ -494,8 +783,60 @@ uint8_t venue_order_id_eq(const struct VenueOrderId_t *lhs, const struct VenueOr
 
 uint64_t venue_order_id_hash(const struct VenueOrderId_t *venue_order_id);
 
+struct InstrumentSpec_t instrument_spec_new(uint8_t price_precision,
+                                            uint8_t size_precision,
+                                            int64_t price_increment,
+                                            uint64_t size_increment,
+                                            uint64_t multiplier,
+                                            uint64_t min_quantity,
+                                            uint64_t max_quantity,
+                                            int64_t min_price,
+                                            int64_t max_price);
+
+int64_t instrument_spec_make_price_raw(const struct InstrumentSpec_t *spec, double value);
+
+uint64_t instrument_spec_make_qty_raw(const struct InstrumentSpec_t *spec, double value);
+
+int64_t instrument_spec_quantize_price(const struct InstrumentSpec_t *spec, double value);
+
+uint64_t instrument_spec_quantize_qty(const struct InstrumentSpec_t *spec, double value);
+
+/**
+ * Quantizes `len` price values into `out`.
+ *
+ * # Safety
+ * - `values` must point to `len` contiguous values.
+ * - `out` must point to `len` contiguous writable values.
+ */
+void instrument_spec_quantize_prices(const struct InstrumentSpec_t *spec,
+                                     const double *values,
+                                     int64_t *out,
+                                     uintptr_t len);
+
+/**
+ * Quantizes `len` quantity values into `out`.
+ *
+ * # Safety
+ * - `values` must point to `len` contiguous values.
+ * - `out` must point to `len` contiguous writable values.
+ */
+void instrument_spec_quantize_qtys(const struct InstrumentSpec_t *spec,
+                                   const double *values,
+                                   uint64_t *out,
+                                   uintptr_t len);
+
 struct OrderBook order_book_new(struct InstrumentId_t instrument_id, enum BookLevel book_level);
 
+void order_book_free(struct OrderBook book);
+
+struct L1OrderBook l1_order_book_new(struct InstrumentId_t instrument_id);
+
+void l1_order_book_free(struct L1OrderBook book);
+
+struct L2OrderBook l2_order_book_new(struct InstrumentId_t instrument_id);
+
+void l2_order_book_free(struct L2OrderBook book);
+
 /**
  * Returns a `Currency` from valid Python object pointers and primitives.
  *
@@ -15,6 +15,10 @@ cdef extern from "../includes/common.h":
         YELLOW # = 5,
         RED # = 6,
 
+    cdef enum LogFileFormat:
+        BINARY # = 0,
+        JSON # = 1,
+
     cdef enum LogLevel:
         DEBUG # = 10,
         INFO # = 20,
@@ -25,14 +29,40 @@ cdef extern from "../includes/common.h":
     cdef struct Logger_t:
         pass
 
+    cdef struct TimeEventScheduler_t:
+        pass
+
+    cdef struct TimerWheel_t:
+        pass
+
     # Logger is not C FFI safe, so we box and pass it as an opaque pointer.
     # This works because Logger fields don't need to be accessed, only functions
     # are called.
     cdef struct CLogger:
         Logger_t *_0;
 
+    # Represents a time event which occurred for a scheduled timer.
+    cdef struct TimeEventRecord_t:
+        uint64_t timer_id;
+        uint64_t ts_event;
+        uint8_t is_expired;
+
+    # TimeEventScheduler is not C FFI safe, so we box and pass it as an opaque
+    # pointer.
+    cdef struct CTimeEventScheduler:
+        TimeEventScheduler_t *_0;
+
+    # TimerWheel is not C FFI safe, so we box and pass it as an opaque pointer.
+    #
+    # All functions other than `timer_wheel_free` may be called concurrently.
+    cdef struct CTimerWheel:
+        TimerWheel_t *_0;
+
     # Creates a logger from a valid Python object pointer and a defined logging level.
     #
+    # If `is_async` is set then lines are passed through a ring buffer to a
+    # background thread for formatting and writing.
+    #
     # # Safety
     # - `trader_id_ptr` must be borrowed from a valid Python UTF-8 `str`.
     # - `machine_id_ptr` must be borrowed from a valid Python UTF-8 `str`.
@@ -41,7 +71,8 @@ cdef extern from "../includes/common.h":
                        PyObject *machine_id_ptr,
                        PyObject *instance_id_ptr,
                        LogLevel level_stdout,
-                       uint8_t is_bypassed);
+                       uint8_t is_bypassed,
+                       uint8_t is_async);
 
     void logger_free(CLogger logger);
 
@@ -67,6 +98,40 @@ cdef extern from "../includes/common.h":
 
     uint8_t logger_is_bypassed(const CLogger *logger);
 
+    uint8_t logger_is_async(const CLogger *logger);
+
+    # Sets the minimum level for logging messages from the given component to stdout.
+    #
+    # # Safety
+    # - `component_ptr` must be borrowed from a valid Python UTF-8 `str`.
+    void logger_set_component_level(CLogger *logger,
+                                    PyObject *component_ptr,
+                                    LogLevel level);
+
+    # Adds a file sink to the logger which writes records at or above the given
+    # level to files in the given directory, rotating by size and/or time.
+    #
+    # Returns 1 if the sink was added, or 0 if the first file could not be opened.
+    #
+    # # Safety
+    # - `directory_ptr` must be borrowed from a valid Python UTF-8 `str`.
+    # - `basename_ptr` must be borrowed from a valid Python UTF-8 `str`.
+    uint8_t logger_add_file_sink(CLogger *logger,
+                                 PyObject *directory_ptr,
+                                 PyObject *basename_ptr,
+                                 LogLevel level,
+                                 LogFileFormat format,
+                                 uint64_t max_size_bytes,
+                                 uint64_t rotation_interval_ns);
+
+    # Return whether a message at the given level from the given component would be logged.
+    #
+    # # Safety
+    # - `component_ptr` must be borrowed from a valid Python UTF-8 `str`.
+    uint8_t logger_is_enabled(const CLogger *logger,
+                              LogLevel level,
+                              PyObject *component_ptr);
+
     # Log a message from valid Python object pointers.
     #
     # # Safety
@@ -78,3 +143,57 @@ cdef extern from "../includes/common.h":
                     LogColor color,
                     PyObject *component_ptr,
                     PyObject *msg_ptr);
+
+    CTimeEventScheduler time_event_scheduler_new(uint64_t initial_ns);
+
+    void time_event_scheduler_free(CTimeEventScheduler scheduler);
+
+    void time_event_scheduler_set_time(CTimeEventScheduler *scheduler, uint64_t to_time_ns);
+
+    uint64_t time_event_scheduler_timer_count(const CTimeEventScheduler *scheduler);
+
+    void time_event_scheduler_add_timer(CTimeEventScheduler *scheduler,
+                                        uint64_t timer_id,
+                                        uint64_t interval_ns,
+                                        uint64_t next_time_ns,
+                                        uint64_t stop_time_ns);
+
+    void time_event_scheduler_cancel_timer(CTimeEventScheduler *scheduler, uint64_t timer_id);
+
+    uint64_t time_event_scheduler_next_time_ns(CTimeEventScheduler *scheduler);
+
+    # Advances the scheduler to the given time, returning the number of events
+    # which can then be read with `time_event_scheduler_events`.
+    uint64_t time_event_scheduler_advance_time(CTimeEventScheduler *scheduler,
+                                               uint64_t to_time_ns);
+
+    # Returns a pointer to the events generated by the last advance.
+    #
+    # The pointer is valid until the scheduler is next mutated.
+    const TimeEventRecord_t *time_event_scheduler_events(const CTimeEventScheduler *scheduler);
+
+    CTimerWheel timer_wheel_new(uint64_t tick_ns, uint64_t num_slots);
+
+    void timer_wheel_free(CTimerWheel wheel);
+
+    uint64_t timer_wheel_timer_count(const CTimerWheel *wheel);
+
+    void timer_wheel_add_timer(const CTimerWheel *wheel,
+                               uint64_t timer_id,
+                               uint64_t interval_ns,
+                               uint64_t next_time_ns,
+                               uint64_t stop_time_ns);
+
+    void timer_wheel_cancel_timer(const CTimerWheel *wheel, uint64_t timer_id);
+
+    void timer_wheel_shutdown(const CTimerWheel *wheel);
+
+    # Blocks until timers are due, writing up to `capacity` events to `buffer`.
+    #
+    # Returns the number of events written, which is zero only on shutdown.
+    #
+    # # Safety
+    # - `buffer` must point to at least `capacity` writable `TimeEventRecord_t`.
+    uint64_t timer_wheel_wait(const CTimerWheel *wheel,
+                              TimeEventRecord_t *buffer,
+                              uint64_t capacity);
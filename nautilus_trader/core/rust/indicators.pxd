@@ -0,0 +1,151 @@
+# Warning, this file is autogenerated by cbindgen. Don't modify this manually. */
+
+from libc.stdint cimport uint8_t, uintptr_t
+
+cdef extern from "../includes/indicators.h":
+
+    # Represents the type of moving average.
+    #
+    # The discriminants match the Python `MovingAverageType` enum.
+    cdef enum MovingAverageType:
+        Simple # = 0,
+        Exponential # = 1,
+        Wilder # = 5,
+
+    cdef struct AverageTrueRange_t:
+        pass
+
+    cdef struct ExponentialMovingAverage_t:
+        pass
+
+    cdef struct SimpleMovingAverage_t:
+        pass
+
+    cdef struct BollingerBands_t:
+        pass
+
+    cdef struct RelativeStrengthIndex_t:
+        pass
+
+    # AverageTrueRange is not C FFI safe, so we box and pass it as an opaque pointer.
+    cdef struct CAverageTrueRange:
+        AverageTrueRange_t *_0;
+
+    # ExponentialMovingAverage is not C FFI safe, so we box and pass it as an
+    # opaque pointer.
+    cdef struct CExponentialMovingAverage:
+        ExponentialMovingAverage_t *_0;
+
+    # SimpleMovingAverage is not C FFI safe, so we box and pass it as an opaque
+    # pointer.
+    cdef struct CSimpleMovingAverage:
+        SimpleMovingAverage_t *_0;
+
+    # BollingerBands is not C FFI safe, so we box and pass it as an opaque pointer.
+    cdef struct CBollingerBands:
+        BollingerBands_t *_0;
+
+    # RelativeStrengthIndex is not C FFI safe, so we box and pass it as an opaque pointer.
+    cdef struct CRelativeStrengthIndex:
+        RelativeStrengthIndex_t *_0;
+
+    CAverageTrueRange atr_new(uintptr_t period,
+                              MovingAverageType ma_type,
+                              uint8_t use_previous,
+                              double value_floor);
+
+    void atr_free(CAverageTrueRange atr);
+
+    double atr_update_raw(CAverageTrueRange *atr, double high, double low, double close);
+
+    # Update the indicator with `len` raw values and return the latest value.
+    #
+    # # Safety
+    # - `high`, `low` and `close` must each point to `len` contiguous values.
+    double atr_update_many(CAverageTrueRange *atr,
+                           const double *high,
+                           const double *low,
+                           const double *close,
+                           uintptr_t len);
+
+    void atr_reset(CAverageTrueRange *atr);
+
+    uint8_t atr_initialized(const CAverageTrueRange *atr);
+
+    CExponentialMovingAverage ema_new(uintptr_t period, double alpha);
+
+    void ema_free(CExponentialMovingAverage ema);
+
+    double ema_update_raw(CExponentialMovingAverage *ema, double value);
+
+    # Update the indicator with `len` raw values and return the latest value.
+    #
+    # # Safety
+    # - `values` must point to `len` contiguous values.
+    double ema_update_many(CExponentialMovingAverage *ema, const double *values, uintptr_t len);
+
+    void ema_reset(CExponentialMovingAverage *ema);
+
+    uintptr_t ema_count(const CExponentialMovingAverage *ema);
+
+    uint8_t ema_initialized(const CExponentialMovingAverage *ema);
+
+    CSimpleMovingAverage sma_new(uintptr_t period);
+
+    void sma_free(CSimpleMovingAverage sma);
+
+    double sma_update_raw(CSimpleMovingAverage *sma, double value);
+
+    # Update the indicator with `len` raw values and return the latest value.
+    #
+    # # Safety
+    # - `values` must point to `len` contiguous values.
+    double sma_update_many(CSimpleMovingAverage *sma, const double *values, uintptr_t len);
+
+    void sma_reset(CSimpleMovingAverage *sma);
+
+    uintptr_t sma_count(const CSimpleMovingAverage *sma);
+
+    uint8_t sma_initialized(const CSimpleMovingAverage *sma);
+
+    CBollingerBands bb_new(uintptr_t period, double k, MovingAverageType ma_type);
+
+    void bb_free(CBollingerBands bb);
+
+    void bb_update_raw(CBollingerBands *bb, double high, double low, double close);
+
+    # Update the indicator with `len` prices.
+    #
+    # # Safety
+    # - `high`, `low` and `close` must each point to `len` contiguous values.
+    void bb_update_many(CBollingerBands *bb,
+                        const double *high,
+                        const double *low,
+                        const double *close,
+                        uintptr_t len);
+
+    void bb_reset(CBollingerBands *bb);
+
+    double bb_upper(const CBollingerBands *bb);
+
+    double bb_middle(const CBollingerBands *bb);
+
+    double bb_lower(const CBollingerBands *bb);
+
+    uint8_t bb_initialized(const CBollingerBands *bb);
+
+    CRelativeStrengthIndex rsi_new(uintptr_t period, MovingAverageType ma_type);
+
+    void rsi_free(CRelativeStrengthIndex rsi);
+
+    double rsi_update_raw(CRelativeStrengthIndex *rsi, double value);
+
+    # Update the indicator with `len` values and return the latest value.
+    #
+    # # Safety
+    # - `values` must point to `len` contiguous values.
+    double rsi_update_many(CRelativeStrengthIndex *rsi, const double *values, uintptr_t len);
+
+    void rsi_reset(CRelativeStrengthIndex *rsi);
+
+    uint8_t rsi_initialized(const CRelativeStrengthIndex *rsi);
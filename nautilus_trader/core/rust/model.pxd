@@ -1,14 +1,39 @@
 # Warning, this file is autogenerated by cbindgen. Don't modify this manually. */
 
 from cpython.object cimport PyObject
-from libc.stdint cimport uint8_t, uint16_t, uint64_t, int64_t
+from libc.stdint cimport uint8_t, uint16_t, uint64_t, int64_t, uintptr_t
 
 cdef extern from "../includes/model.h":
 
+    # The number of bytes which can be held without a heap allocation.
+    const uintptr_t INLINE_CAPACITY # = 36
+
     const uint8_t FIXED_PRECISION # = 9
 
     const double FIXED_SCALAR # = 1000000000.0
 
+    cdef enum AggregationSource:
+        External # = 1,
+        Internal # = 2,
+
+    cdef enum BarAggregation:
+        Tick # = 1,
+        TickImbalance # = 2,
+        TickRuns # = 3,
+        Volume # = 4,
+        VolumeImbalance # = 5,
+        VolumeRuns # = 6,
+        Value # = 7,
+        ValueImbalance # = 8,
+        ValueRuns # = 9,
+        Millisecond # = 10,
+        Second # = 11,
+        Minute # = 12,
+        Hour # = 13,
+        Day # = 14,
+        Week # = 15,
+        Month # = 16,
+
     cdef enum BookLevel:
         L1_TBBO # = 1,
         L2_MBP # = 2,
@@ -22,9 +47,34 @@ cdef extern from "../includes/model.h":
         Buy # = 1,
         Sell # = 2,
 
+    cdef enum PriceType:
+        Bid # = 1,
+        Ask # = 2,
+        Mid # = 3,
+        Last # = 4,
+
     cdef struct BTreeMap_BookPrice__Level:
         pass
 
+    cdef struct BTreeMap_BookPrice__Quantity:
+        pass
+
+    # Provides a means of aggregating raw tick values into bars.
+    #
+    # Tick, volume and value bars are built as the step threshold of the bar
+    # specification is reached. Time bars are only built on request, as the
+    # build is driven by a clock timer external to the aggregator.
+    #
+    # Completed bars are queued until popped by the caller.
+    cdef struct BarAggregator_t:
+        pass
+
+    # Provides a generic bar builder for aggregation.
+    #
+    # All OHLCV arithmetic is performed on the raw fixed-point values.
+    cdef struct BarBuilder_t:
+        pass
+
     cdef struct HashMap_u64__BookPrice:
         pass
 
@@ -41,6 +91,24 @@ cdef extern from "../includes/model.h":
         Symbol_t symbol;
         Venue_t venue;
 
+    # Represents a bar aggregation specification including a step, aggregation
+    # method/rule and price type.
+    cdef struct BarSpecification_t:
+        uint64_t step;
+        BarAggregation aggregation;
+        PriceType price_type;
+
+    # Represents a bar type including the instrument ID, bar specification and
+    # aggregation source.
+    cdef struct BarType_t:
+        InstrumentId_t instrument_id;
+        BarSpecification_t spec;
+        AggregationSource aggregation_source;
+
+    # BarBuilder is not C FFI safe, so we box and pass it as an opaque pointer.
+    cdef struct CBarBuilder:
+        BarBuilder_t *_0;
+
     cdef struct Price_t:
         int64_t raw;
         uint8_t precision;
@@ -49,6 +117,21 @@ cdef extern from "../includes/model.h":
         uint64_t raw;
         uint8_t precision;
 
+    # Represents an aggregated bar.
+    cdef struct Bar_t:
+        BarType_t bar_type;
+        Price_t open;
+        Price_t high;
+        Price_t low;
+        Price_t close;
+        Quantity_t volume;
+        uint64_t ts_event;
+        uint64_t ts_init;
+
+    # BarAggregator is not C FFI safe, so we box and pass it as an opaque pointer.
+    cdef struct CBarAggregator:
+        BarAggregator_t *_0;
+
     # Represents a single quote tick in a financial market.
     cdef struct QuoteTick_t:
         InstrumentId_t instrument_id;
@@ -59,8 +142,18 @@ cdef extern from "../includes/model.h":
         uint64_t ts_event;
         uint64_t ts_init;
 
+    # Represents an immutable string which is stored inline when it fits within
+    # 36 bytes (a hyphenated UUID), otherwise it spills onto the heap.
+    #
+    # Most venue assigned identifiers fit inline, so passing them by value across
+    # the C ABI avoids a heap allocation per identifier.
+    cdef struct InlineString:
+        uint8_t len;
+        uint8_t buf[INLINE_CAPACITY];
+        String *spill;
+
     cdef struct TradeId_t:
-        String *value;
+        InlineString value;
 
     # Represents a single trade tick in a financial market.
     cdef struct TradeTick_t:
@@ -97,7 +190,20 @@ cdef extern from "../includes/model.h":
         String *value;
 
     cdef struct VenueOrderId_t:
-        String *value;
+        InlineString value;
+
+    # Represents the specification of an instrument needed to quantize prices and
+    # sizes, with all values held as raw fixed-point integers.
+    cdef struct InstrumentSpec_t:
+        uint8_t price_precision;
+        uint8_t size_precision;
+        int64_t price_increment;
+        uint64_t size_increment;
+        uint64_t multiplier;
+        uint64_t min_quantity;
+        uint64_t max_quantity;
+        int64_t min_price;
+        int64_t max_price;
 
     cdef struct Ladder:
         OrderSide side;
@@ -112,6 +218,34 @@ cdef extern from "../includes/model.h":
         OrderSide last_side;
         uint64_t ts_last;
 
+    cdef struct Order:
+        Price_t price;
+        Quantity_t size;
+        OrderSide side;
+        uint64_t id;
+
+    # Provides a L1 TBBO (top of book best bid/offer) order book.
+    #
+    # Only the top level of each side is held, inline and without any heap
+    # allocation. A side with a zero size order is empty.
+    cdef struct L1OrderBook:
+        Order bid;
+        Order ask;
+        InstrumentId_t instrument_id;
+        OrderSide last_side;
+        uint64_t ts_last;
+
+    # Provides a L2 MBP (market by price) order book.
+    #
+    # Each price level holds only its aggregated size, so there are no per order
+    # queues or order ID caches to maintain.
+    cdef struct L2OrderBook:
+        BTreeMap_BookPrice__Quantity *bids;
+        BTreeMap_BookPrice__Quantity *asks;
+        InstrumentId_t instrument_id;
+        OrderSide last_side;
+        uint64_t ts_last;
+
     cdef struct Currency_t:
         String *code;
         uint8_t precision;
@@ -123,6 +257,113 @@ cdef extern from "../includes/model.h":
         int64_t raw;
         Currency_t currency;
 
+    CBarBuilder bar_builder_new(BarType_t bar_type,
+                                uint8_t price_precision,
+                                uint8_t size_precision);
+
+    void bar_builder_free(CBarBuilder builder);
+
+    void bar_builder_set_partial(CBarBuilder *builder, const Bar_t *partial_bar);
+
+    void bar_builder_update(CBarBuilder *builder,
+                            Price_t price,
+                            Quantity_t size,
+                            uint64_t ts_event);
+
+    void bar_builder_reset(CBarBuilder *builder);
+
+    Bar_t bar_builder_build(CBarBuilder *builder, uint64_t ts_event);
+
+    uint8_t bar_builder_initialized(const CBarBuilder *builder);
+
+    uint64_t bar_builder_ts_last(const CBarBuilder *builder);
+
+    uint64_t bar_builder_count(const CBarBuilder *builder);
+
+    # Returns a pointer to a valid Python UTF-8 string.
+    #
+    # # Safety
+    # - Assumes that since the data is originating from Rust, the GIL does not need
+    # to be acquired.
+    # - Assumes you are immediately returning this pointer to Python.
+    PyObject *bar_builder_to_pystr(const CBarBuilder *builder);
+
+    CBarAggregator bar_aggregator_new(BarType_t bar_type,
+                                      uint8_t price_precision,
+                                      uint8_t size_precision);
+
+    void bar_aggregator_free(CBarAggregator aggregator);
+
+    # Update the aggregator from the quote tick and return the number of completed
+    # bars pending.
+    uint64_t bar_aggregator_handle_quote_tick(CBarAggregator *aggregator,
+                                              const QuoteTick_t *tick);
+
+    # Update the aggregator from the trade tick and return the number of completed
+    # bars pending.
+    uint64_t bar_aggregator_handle_trade_tick(CBarAggregator *aggregator,
+                                              const TradeTick_t *tick);
+
+    # Update the aggregator from `len` raw tick values and return the number of
+    # completed bars pending.
+    #
+    # # Safety
+    # - `prices`, `sizes` and `ts_events` must each point to `len` contiguous values.
+    uint64_t bar_aggregator_update_batch(CBarAggregator *aggregator,
+                                         const int64_t *prices,
+                                         uint8_t price_prec,
+                                         const uint64_t *sizes,
+                                         uint8_t size_prec,
+                                         const uint64_t *ts_events,
+                                         uintptr_t len);
+
+    void bar_aggregator_set_partial(CBarAggregator *aggregator, const Bar_t *partial_bar);
+
+    # Build a bar with the given closing timestamp and return the number of
+    # completed bars pending.
+    uint64_t bar_aggregator_build(CBarAggregator *aggregator, uint64_t ts_event);
+
+    uint64_t bar_aggregator_pending(const CBarAggregator *aggregator);
+
+    # Pops the oldest completed bar.
+    #
+    # # Panics
+    # - If there are no completed bars pending.
+    Bar_t bar_aggregator_pop(CBarAggregator *aggregator);
+
+    uint8_t bar_aggregator_initialized(const CBarAggregator *aggregator);
+
+    uint64_t bar_aggregator_cum_value(const CBarAggregator *aggregator);
+
+    BarType_t bar_type_new(InstrumentId_t instrument_id,
+                           uint64_t step,
+                           BarAggregation aggregation,
+                           PriceType price_type,
+                           AggregationSource aggregation_source);
+
+    void bar_type_free(BarType_t bar_type);
+
+    void bar_free(Bar_t bar);
+
+    Bar_t bar_from_raw(BarType_t bar_type,
+                       int64_t open,
+                       int64_t high,
+                       int64_t low,
+                       int64_t close,
+                       uint8_t price_prec,
+                       uint64_t volume,
+                       uint8_t size_prec,
+                       uint64_t ts_event,
+                       uint64_t ts_init);
+
+    # Returns a pointer to a valid Python UTF-8 string.
+    #
+    # # Safety
+    # - Assumes that since the data is originating from Rust, the GIL does not need
+    # to be acquired.
+    # - Assumes you are immediately returning this pointer to Python.
+    PyObject *bar_to_pystr(const Bar_t *bar);
+
     void quote_tick_free(QuoteTick_t tick);
 
     QuoteTick_t quote_tick_new(InstrumentId_t instrument_id,
@@ -415,8 +656,56 @@ cdef extern from "../includes/model.h":
 
     uint64_t venue_order_id_hash(const VenueOrderId_t *venue_order_id);
 
+    InstrumentSpec_t instrument_spec_new(uint8_t price_precision,
+                                         uint8_t size_precision,
+                                         int64_t price_increment,
+                                         uint64_t size_increment,
+                                         uint64_t multiplier,
+                                         uint64_t min_quantity,
+                                         uint64_t max_quantity,
+                                         int64_t min_price,
+                                         int64_t max_price);
+
+    int64_t instrument_spec_make_price_raw(const InstrumentSpec_t *spec, double value);
+
+    uint64_t instrument_spec_make_qty_raw(const InstrumentSpec_t *spec, double value);
+
+    int64_t instrument_spec_quantize_price(const InstrumentSpec_t *spec, double value);
+
+    uint64_t instrument_spec_quantize_qty(const InstrumentSpec_t *spec, double value);
+
+    # Quantizes `len` price values into `out`.
+    #
+    # # Safety
+    # - `values` must point to `len` contiguous values.
+    # - `out` must point to `len` contiguous writable values.
+    void instrument_spec_quantize_prices(const InstrumentSpec_t *spec,
+                                         const double *values,
+                                         int64_t *out,
+                                         uintptr_t len);
+
+    # Quantizes `len` quantity values into `out`.
+    #
+    # # Safety
+    # - `values` must point to `len` contiguous values.
+    # - `out` must point to `len` contiguous writable values.
+    void instrument_spec_quantize_qtys(const InstrumentSpec_t *spec,
+                                       const double *values,
+                                       uint64_t *out,
+                                       uintptr_t len);
+
     OrderBook order_book_new(InstrumentId_t instrument_id, BookLevel book_level);
 
+    void order_book_free(OrderBook book);
+
+    L1OrderBook l1_order_book_new(InstrumentId_t instrument_id);
+
+    void l1_order_book_free(L1OrderBook book);
+
+    L2OrderBook l2_order_book_new(InstrumentId_t instrument_id);
+
+    void l2_order_book_free(L2OrderBook book);
+
     # Returns a `Currency` from valid Python object pointers and primitives.
     #
     # # Safety
@@ -20,7 +20,11 @@ cdef class UUID4:
     cdef UUID4_t _mem
 
     cdef UUID4_t _uuid4_from_pystr(self, str value) except *
+    cdef void _ensure_value(self)
     cdef str to_str(self)
 
     @staticmethod
     cdef UUID4 from_raw_c(UUID4_t raw)
+
+    @staticmethod
+    cdef UUID4 deferred_c()
@@ -61,11 +61,18 @@ cdef class UUID4:
     cdef UUID4_t _uuid4_from_pystr(self, str value) except *:
         return uuid4_from_pystr(<PyObject *>value)  # `value` borrowed by Rust, `UUID4_t` owned from Rust
 
+    cdef void _ensure_value(self):
+        if self._mem.value == NULL:
+            # Deferred value is generated on first use
+            self._mem = uuid4_new()  # `UUID4_t` owned from Rust
+
     cdef str to_str(self):
+        self._ensure_value()
         return <str>uuid4_to_pystr(&self._mem)
 
     def __del__(self) -> None:
-        uuid4_free(self._mem)  # `self._uuid4` moved to Rust (then dropped)
+        if self._mem.value != NULL:
+            uuid4_free(self._mem)  # `self._uuid4` moved to Rust (then dropped)
 
     def __getstate__(self):
         return self.to_str()
@@ -74,9 +81,12 @@ cdef class UUID4:
         self._mem = self._uuid4_from_pystr(state)
 
     def __eq__(self, UUID4 other) -> bool:
+        self._ensure_value()
+        other._ensure_value()
         return uuid4_eq(&self._mem, &other._mem)
 
     def __hash__(self) -> int:
+        self._ensure_value()
         return uuid4_hash(&self._mem)
 
     def __str__(self) -> str:
@@ -94,3 +104,9 @@ cdef class UUID4:
         cdef UUID4 uuid4 = UUID4.__new__(UUID4)
         uuid4._mem = raw
         return uuid4
+
+    @staticmethod
+    cdef UUID4 deferred_c():
+        # The value is only generated when the UUID is first compared, hashed
+        # or converted, so IDs which are never read cost no Rust call.
+        return UUID4.__new__(UUID4)  # `_mem.value` is NULL until then
@@ -15,12 +15,17 @@
 
 from cpython.datetime cimport datetime
 from cpython.datetime cimport timedelta
+from libc.stdint cimport int64_t
 from libc.stdint cimport uint8_t
 from libc.stdint cimport uint64_t
 
 from nautilus_trader.common.clock cimport Clock
 from nautilus_trader.common.logging cimport LoggerAdapter
 from nautilus_trader.common.timer cimport TimeEvent
+from nautilus_trader.core.rust.model cimport Bar_t
+from nautilus_trader.core.rust.model cimport BarType_t
+from nautilus_trader.core.rust.model cimport CBarAggregator
+from nautilus_trader.core.rust.model cimport CBarBuilder
 from nautilus_trader.model.data.bar cimport Bar
 from nautilus_trader.model.data.bar cimport BarType
 from nautilus_trader.model.data.tick cimport QuoteTick
@@ -29,27 +34,18 @@ from nautilus_trader.model.objects cimport Price
 from nautilus_trader.model.objects cimport Quantity
 
 
+cdef BarType_t bar_type_to_raw(BarType bar_type) except *
+cdef Bar bar_from_raw_c(BarType bar_type, Bar_t raw)
+
+
 cdef class BarBuilder:
+    cdef CBarBuilder _mem
     cdef BarType _bar_type
 
     cdef readonly uint8_t price_precision
     """The price precision for the builders instrument.\n\n:returns: `uint8`"""
     cdef readonly uint8_t size_precision
     """The size precision for the builders instrument.\n\n:returns: `uint8`"""
-    cdef readonly bint initialized
-    """If the builder is initialized.\n\n:returns: `bool`"""
-    cdef readonly uint64_t ts_last
-    """The UNIX timestamp (nanoseconds) when the builder last updated.\n\n:returns: `uint64_t`"""
-    cdef readonly int count
-    """The builders current update count.\n\n:returns: `int`"""
-
-    cdef bint _partial_set
-    cdef Price _last_close
-    cdef Price _open
-    cdef Price _high
-    cdef Price _low
-    cdef Price _close
-    cdef Quantity volume
 
     cpdef void set_partial(self, Bar partial_bar) except *
     cpdef void update(self, Price price, Quantity size, uint64_t ts_event) except *
@@ -59,8 +55,8 @@ cdef class BarBuilder:
 
 
 cdef class BarAggregator:
+    cdef CBarAggregator _mem
     cdef LoggerAdapter _log
-    cdef BarBuilder _builder
     cdef object _handler
 
     cdef readonly BarType bar_type
@@ -68,8 +64,17 @@ cdef class BarAggregator:
 
     cpdef void handle_quote_tick(self, QuoteTick tick) except *
     cpdef void handle_trade_tick(self, TradeTick tick) except *
-    cdef void _apply_update(self, Price price, Quantity size, uint64_t ts_event) except *
-    cdef void _build_now_and_send(self) except *
+    cpdef void handle_batch(
+        self,
+        int64_t[:] prices,
+        uint8_t price_prec,
+        uint64_t[:] sizes,
+        uint8_t size_prec,
+        uint64_t[:] ts_events,
+    ) except *
+    cdef bint _before_update(self, uint64_t ts_event) except *
+    cdef void _after_update(self, uint64_t ts_event, bint built) except *
+    cdef void _send_pending(self) except *
     cdef void _build_and_send(self, uint64_t ts_event) except *
 
 
@@ -82,8 +87,6 @@ cdef class VolumeBarAggregator(BarAggregator):
 
 
 cdef class ValueBarAggregator(BarAggregator):
-    cdef object _cum_value
-
     cpdef object get_cumulative_value(self)
 
 
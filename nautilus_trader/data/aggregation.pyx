@@ -18,6 +18,9 @@ from typing import Callable
 
 from cpython.datetime cimport datetime
 from cpython.datetime cimport timedelta
+from cpython.object cimport PyObject
+from libc.stdint cimport int64_t
+from libc.stdint cimport uint8_t
 from libc.stdint cimport uint64_t
 
 from nautilus_trader.common.clock cimport Clock
@@ -28,8 +31,40 @@ from nautilus_trader.common.timer cimport TimeEvent
 from nautilus_trader.core.correctness cimport Condition
 from nautilus_trader.core.datetime cimport millis_to_nanos
 from nautilus_trader.core.datetime cimport secs_to_nanos
+from nautilus_trader.core.rust.model cimport AggregationSource as AggregationSource_t
+from nautilus_trader.core.rust.model cimport Bar_t
+from nautilus_trader.core.rust.model cimport BarAggregation as BarAggregation_t
+from nautilus_trader.core.rust.model cimport BarType_t
+from nautilus_trader.core.rust.model cimport PriceType as PriceType_t
+from nautilus_trader.core.rust.model cimport bar_aggregator_build
+from nautilus_trader.core.rust.model cimport bar_aggregator_cum_value
+from nautilus_trader.core.rust.model cimport bar_aggregator_free
+from nautilus_trader.core.rust.model cimport bar_aggregator_handle_quote_tick
+from nautilus_trader.core.rust.model cimport bar_aggregator_handle_trade_tick
+from nautilus_trader.core.rust.model cimport bar_aggregator_initialized
+from nautilus_trader.core.rust.model cimport bar_aggregator_new
+from nautilus_trader.core.rust.model cimport bar_aggregator_pending
+from nautilus_trader.core.rust.model cimport bar_aggregator_pop
+from nautilus_trader.core.rust.model cimport bar_aggregator_set_partial
+from nautilus_trader.core.rust.model cimport bar_aggregator_update_batch
+from nautilus_trader.core.rust.model cimport bar_builder_build
+from nautilus_trader.core.rust.model cimport bar_builder_count
+from nautilus_trader.core.rust.model cimport bar_builder_free
+from nautilus_trader.core.rust.model cimport bar_builder_initialized
+from nautilus_trader.core.rust.model cimport bar_builder_new
+from nautilus_trader.core.rust.model cimport bar_builder_reset
+from nautilus_trader.core.rust.model cimport bar_builder_set_partial
+from nautilus_trader.core.rust.model cimport bar_builder_to_pystr
+from nautilus_trader.core.rust.model cimport bar_builder_ts_last
+from nautilus_trader.core.rust.model cimport bar_builder_update
+from nautilus_trader.core.rust.model cimport bar_free
+from nautilus_trader.core.rust.model cimport bar_from_raw
+from nautilus_trader.core.rust.model cimport bar_type_new
+from nautilus_trader.core.rust.model cimport instrument_id_from_pystrs
 from nautilus_trader.model.c_enums.bar_aggregation cimport BarAggregation
 from nautilus_trader.model.c_enums.bar_aggregation cimport BarAggregationParser
+from nautilus_trader.model.c_enums.price_type cimport PriceType
+from nautilus_trader.model.c_enums.price_type cimport PriceTypeParser
 from nautilus_trader.model.data.bar cimport Bar
 from nautilus_trader.model.data.bar cimport BarType
 from nautilus_trader.model.data.tick cimport QuoteTick
@@ -39,6 +74,50 @@ from nautilus_trader.model.objects cimport Price
 from nautilus_trader.model.objects cimport Quantity
 
 
+cdef BarType_t bar_type_to_raw(BarType bar_type) except *:
+    # Builds an owned Rust bar type, the instrument ID strings are copied
+    return bar_type_new(
+        instrument_id_from_pystrs(
+            <PyObject *>bar_type.instrument_id.symbol.value,
+            <PyObject *>bar_type.instrument_id.venue.value,
+        ),
+        bar_type.spec.step,
+        <BarAggregation_t>bar_type.spec.aggregation,
+        <PriceType_t>bar_type.spec.price_type,
+        <AggregationSource_t>bar_type.aggregation_source,
+    )
+
+
+cdef Bar bar_from_raw_c(BarType bar_type, Bar_t raw):
+    cdef Bar bar = Bar(
+        bar_type=bar_type,
+        open=Price.from_raw_c(raw.open.raw, raw.open.precision),
+        high=Price.from_raw_c(raw.high.raw, raw.high.precision),
+        low=Price.from_raw_c(raw.low.raw, raw.low.precision),
+        close=Price.from_raw_c(raw.close.raw, raw.close.precision),
+        volume=Quantity.from_raw_c(raw.volume.raw, raw.volume.precision),
+        ts_event=raw.ts_event,
+        ts_init=raw.ts_init,
+    )
+    bar_free(raw)  # `raw` moved to Rust (then dropped)
+    return bar
+
+
+cdef Bar_t _bar_to_raw(Bar bar) except *:
+    return bar_from_raw(
+        bar_type_to_raw(bar.type),
+        bar.open._mem.raw,
+        bar.high._mem.raw,
+        bar.low._mem.raw,
+        bar.close._mem.raw,
+        bar.open._mem.precision,
+        bar.volume._mem.raw,
+        bar.volume._mem.precision,
+        bar.ts_event,
+        bar.ts_init,
+    )
+
+
 cdef class BarBuilder:
     """
     Provides a generic bar builder for aggregation.
@@ -67,29 +146,55 @@ cdef class BarBuilder:
 
         self.price_precision = instrument.price_precision
         self.size_precision = instrument.size_precision
-        self.initialized = False
-        self.ts_last = 0
-        self.count = 0
-
-        self._partial_set = False
-        self._last_close = None
-        self._open = None
-        self._high = None
-        self._low = None
-        self._close = None
-        self.volume = Quantity.zero_c(precision=self.size_precision)
 
-    def __repr__(self) -> str:
-        return (
-            f"{type(self).__name__}("
-            f"{self._bar_type},"
-            f"{self._open},"
-            f"{self._high},"
-            f"{self._low},"
-            f"{self._close},"
-            f"{self.volume})"
+        self._mem = bar_builder_new(
+            bar_type_to_raw(bar_type),
+            self.price_precision,
+            self.size_precision,
         )
 
+    def __del__(self) -> None:
+        bar_builder_free(self._mem)  # `self._mem` moved to Rust (then dropped)
+
+    def __repr__(self) -> str:
+        return <str>bar_builder_to_pystr(&self._mem)
+
+    @property
+    def initialized(self):
+        """
+        If the builder is initialized.
+
+        Returns
+        -------
+        bool
+
+        """
+        return <bint>bar_builder_initialized(&self._mem)
+
+    @property
+    def ts_last(self):
+        """
+        The UNIX timestamp (nanoseconds) when the builder last updated.
+
+        Returns
+        -------
+        uint64_t
+
+        """
+        return bar_builder_ts_last(&self._mem)
+
+    @property
+    def count(self):
+        """
+        The builders current update count.
+
+        Returns
+        -------
+        int
+
+        """
+        return bar_builder_count(&self._mem)
+
     cpdef void set_partial(self, Bar partial_bar) except *:
         """
         Set the initial values for a partially completed bar.
@@ -102,27 +207,11 @@ cdef class BarBuilder:
             The partial bar with values to set.
 
         """
-        if self._partial_set:
-            return  # Already updated
+        Condition.not_none(partial_bar, "partial_bar")
 
-        self._open = partial_bar.open
-
-        if self._high is None or partial_bar.high._mem.raw > self._high._mem.raw:
-            self._high = partial_bar.high
-
-        if self._low is None or partial_bar.low._mem.raw < self._low._mem.raw:
-            self._low = partial_bar.low
-
-        if self._close is None:
-            self._close = partial_bar.close
-
-        self.volume._mem.raw += partial_bar.volume._mem.raw
-
-        if self.ts_last == 0:
-            self.ts_last = partial_bar.ts_init
-
-        self._partial_set = True
-        self.initialized = True
+        cdef Bar_t raw = _bar_to_raw(partial_bar)
+        bar_builder_set_partial(&self._mem, &raw)
+        bar_free(raw)  # `raw` moved to Rust (then dropped)
 
     cpdef void update(self, Price price, Quantity size, uint64_t ts_event) except *:
         """
@@ -141,25 +230,7 @@ cdef class BarBuilder:
         Condition.not_none(price, "price")
         Condition.not_none(size, "size")
 
-        # TODO: What happens if the first tick updates before a partial bar is applied?
-        if ts_event < self.ts_last:
-            return  # Not applicable
-
-        if self._open is None:
-            # Initialize builder
-            self._open = price
-            self._high = price
-            self._low = price
-            self.initialized = True
-        elif price._mem.raw > self._high._mem.raw:
-            self._high = price
-        elif price._mem.raw < self._low._mem.raw:
-            self._low = price
-
-        self._close = price
-        self.volume._mem.raw += size._mem.raw
-        self.count += 1
-        self.ts_last = ts_event
+        bar_builder_update(&self._mem, price._mem, size._mem, ts_event)
 
     cpdef void reset(self) except *:
         """
@@ -167,12 +238,7 @@ cdef class BarBuilder:
 
         All stateful fields are reset to their initial value.
         """
-        self._open = self._close
-        self._high = self._close
-        self._low = self._close
-
-        self.volume = Quantity.zero_c(precision=self.size_precision)
-        self.count = 0
+        bar_builder_reset(&self._mem)
 
     cpdef Bar build_now(self):
         """
@@ -198,33 +264,24 @@ cdef class BarBuilder:
         -------
         Bar
 
+        Raises
+        ------
+        ValueError
+            If the builder has not been initialized by an update or partial bar.
+
         """
-        if self._open is None:  # No tick was received
-            self._open = self._last_close
-            self._high = self._last_close
-            self._low = self._last_close
-            self._close = self._last_close
-
-        cdef Bar bar = Bar(
-            bar_type=self._bar_type,
-            open=self._open,
-            high=self._high,
-            low=self._low,
-            close=self._close,
-            volume=Quantity(self.volume, self.size_precision),
-            ts_event=ts_event,  # TODO: Hardcoded identical for now...
-            ts_init=ts_event,
-        )
+        Condition.true(self.initialized, "builder not initialized")
 
-        self._last_close = self._close
-        self.reset()
-        return bar
+        return bar_from_raw_c(self._bar_type, bar_builder_build(&self._mem, ts_event))
 
 
 cdef class BarAggregator:
     """
     Provides a means of aggregating specified bars and sending to a registered handler.
 
+    The aggregation itself is performed by the Rust core, completed bars are
+    then wrapped and sent to the handler in order.
+
     Parameters
     ----------
     instrument : Instrument
@@ -257,11 +314,15 @@ cdef class BarAggregator:
             component_name=type(self).__name__,
             logger=logger,
         )
-        self._builder = BarBuilder(
-            instrument=instrument,
-            bar_type=self.bar_type,
+        self._mem = bar_aggregator_new(
+            bar_type_to_raw(bar_type),
+            instrument.price_precision,
+            instrument.size_precision,
         )
 
+    def __del__(self) -> None:
+        bar_aggregator_free(self._mem)  # `self._mem` moved to Rust (then dropped)
+
     cpdef void handle_quote_tick(self, QuoteTick tick) except *:
         """
         Update the aggregator with the given tick.
@@ -271,14 +332,21 @@ cdef class BarAggregator:
         tick : QuoteTick
             The tick for the update.
 
+        Raises
+        ------
+        ValueError
+            If the bar type price type is ``LAST``.
+
         """
         Condition.not_none(tick, "tick")
+        if self.bar_type.spec.price_type == PriceType.LAST:
+            raise ValueError(
+                f"Cannot extract with PriceType {PriceTypeParser.to_str(PriceType.LAST)}",
+            )
 
-        self._apply_update(
-            price=tick.extract_price(self.bar_type.spec.price_type),
-            size=tick.extract_volume(self.bar_type.spec.price_type),
-            ts_event=tick.ts_event,
-        )
+        cdef bint built = self._before_update(tick.ts_event)
+        bar_aggregator_handle_quote_tick(&self._mem, &tick._mem)
+        self._after_update(tick.ts_event, built)
 
     cpdef void handle_trade_tick(self, TradeTick tick) except *:
         """
@@ -292,22 +360,75 @@ cdef class BarAggregator:
         """
         Condition.not_none(tick, "tick")
 
-        self._apply_update(
-            price=tick.price,
-            size=tick.size,
-            ts_event=tick.ts_event,
+        cdef bint built = self._before_update(tick.ts_event)
+        bar_aggregator_handle_trade_tick(&self._mem, &tick._mem)
+        self._after_update(tick.ts_event, built)
+
+    cpdef void handle_batch(
+        self,
+        int64_t[:] prices,
+        uint8_t price_prec,
+        uint64_t[:] sizes,
+        uint8_t size_prec,
+        uint64_t[:] ts_events,
+    ) except *:
+        """
+        Update the aggregator with the given batch of raw tick values.
+
+        All resulting bars are sent to the handler in order.
+
+        Parameters
+        ----------
+        prices : int64_t[:]
+            The raw (fixed-point) update prices.
+        price_prec : uint8_t
+            The precision of the prices.
+        sizes : uint64_t[:]
+            The raw (fixed-point) update sizes.
+        size_prec : uint8_t
+            The precision of the sizes.
+        ts_events : uint64_t[:]
+            The UNIX timestamps (nanoseconds) of the updates.
+
+        Raises
+        ------
+        ValueError
+            If the bar type is time aggregated.
+        ValueError
+            If the lengths of `prices`, `sizes` and `ts_events` are not equal.
+
+        """
+        Condition.false(self.bar_type.spec.is_time_aggregated(), "bar type was time aggregated")
+        Condition.equal(len(prices), len(sizes), "len(prices)", "len(sizes)")
+        Condition.equal(len(prices), len(ts_events), "len(prices)", "len(ts_events)")
+
+        if prices.shape[0] == 0:
+            return
+
+        bar_aggregator_update_batch(
+            &self._mem,
+            &prices[0],
+            price_prec,
+            &sizes[0],
+            size_prec,
+            &ts_events[0],
+            prices.shape[0],
         )
+        self._send_pending()
+
+    cdef bint _before_update(self, uint64_t ts_event) except *:
+        return False  # No bar built before update
 
-    cdef void _apply_update(self, Price price, Quantity size, uint64_t ts_event) except *:
-        raise NotImplementedError("method must be implemented in the subclass")  # pragma: no cover
+    cdef void _after_update(self, uint64_t ts_event, bint built) except *:
+        self._send_pending()
 
-    cdef void _build_now_and_send(self) except *:
-        cdef Bar bar = self._builder.build_now()
-        self._handler(bar)
+    cdef void _send_pending(self) except *:
+        while bar_aggregator_pending(&self._mem) > 0:
+            self._handler(bar_from_raw_c(self.bar_type, bar_aggregator_pop(&self._mem)))
 
     cdef void _build_and_send(self, uint64_t ts_event) except *:
-        cdef Bar bar = self._builder.build(ts_event)
-        self._handler(bar)
+        bar_aggregator_build(&self._mem, ts_event)
+        self._send_pending()
 
 
 cdef class TickBarAggregator(BarAggregator):
@@ -348,12 +469,6 @@ cdef class TickBarAggregator(BarAggregator):
             logger=logger,
         )
 
-    cdef void _apply_update(self, Price price, Quantity size, uint64_t ts_event) except *:
-        self._builder.update(price, size, ts_event)
-
-        if self._builder.count == self.bar_type.spec.step:
-            self._build_now_and_send()
-
 
 cdef class VolumeBarAggregator(BarAggregator):
     """
@@ -393,36 +508,6 @@ cdef class VolumeBarAggregator(BarAggregator):
             logger=logger,
         )
 
-    cdef void _apply_update(self, Price price, Quantity size, uint64_t ts_event) except *:
-        cdef uint64_t raw_size_update = size._mem.raw
-        cdef uint64_t raw_step = int(self.bar_type.spec.step * 1e9)
-        cdef uint64_t raw_size_diff = 0
-
-        while raw_size_update > 0:  # While there is size to apply
-            if self._builder.volume._mem.raw + raw_size_update < raw_step:
-                # Update and break
-                self._builder.update(
-                    price=price,
-                    size=Quantity.from_raw_c(raw_size_update, precision=size._mem.precision),
-                    ts_event=ts_event,
-                )
-                break
-
-            raw_size_diff = raw_step - self._builder.volume._mem.raw
-            # Update builder to the step threshold
-            self._builder.update(
-                price=price,
-                size=Quantity.from_raw_c(raw_size_diff, precision=size._mem.precision),
-                ts_event=ts_event,
-            )
-
-            # Build a bar and reset builder
-            self._build_now_and_send()
-
-            # Decrement the update size
-            raw_size_update -= raw_size_diff
-            assert raw_size_update >= 0
-
 
 cdef class ValueBarAggregator(BarAggregator):
     """
@@ -462,8 +547,6 @@ cdef class ValueBarAggregator(BarAggregator):
             logger=logger,
         )
 
-        self._cum_value = Decimal(0)  # Cumulative value
-
     cpdef object get_cumulative_value(self):
         """
         Return the current cumulative value of the aggregator.
@@ -473,39 +556,7 @@ cdef class ValueBarAggregator(BarAggregator):
         Decimal
 
         """
-        return self._cum_value
-
-    cdef void _apply_update(self, Price price, Quantity size, uint64_t ts_event) except *:
-        size_update = size
-
-        while size_update > 0:  # While there is value to apply
-            value_update = price * size_update  # Calculated value in quote currency
-            if self._cum_value + value_update < self.bar_type.spec.step:
-                # Update and break
-                self._cum_value = self._cum_value + value_update
-                self._builder.update(
-                    price=price,
-                    size=Quantity(size_update, precision=size._mem.precision),
-                    ts_event=ts_event,
-                )
-                break
-
-            value_diff: Decimal = self.bar_type.spec.step - self._cum_value
-            size_diff: Decimal = size_update * (value_diff / value_update)
-            # Update builder to the step threshold
-            self._builder.update(
-                price=price,
-                size=Quantity(size_diff, precision=size._mem.precision),
-                ts_event=ts_event,
-            )
-
-            # Build a bar and reset builder and cumulative value
-            self._build_now_and_send()
-            self._cum_value = Decimal(0)
-
-            # Decrement the update size
-            size_update -= size_diff
-            assert size_update >= 0
+        return Decimal(bar_aggregator_cum_value(&self._mem)).scaleb(-9)
 
 
 cdef class TimeBarAggregator(BarAggregator):
@@ -620,7 +671,11 @@ cdef class TimeBarAggregator(BarAggregator):
             The partial bar with values to set.
 
         """
-        self._builder.set_partial(partial_bar)
+        Condition.not_none(partial_bar, "partial_bar")
+
+        cdef Bar_t raw = _bar_to_raw(partial_bar)
+        bar_aggregator_set_partial(&self._mem, &raw)
+        bar_free(raw)  # `raw` moved to Rust (then dropped)
 
     cpdef void stop(self) except *:
         """
@@ -679,20 +734,22 @@ cdef class TimeBarAggregator(BarAggregator):
 
         self._log.debug(f"Started timer {timer_name}.")
 
-    cdef void _apply_update(self, Price price, Quantity size, uint64_t ts_event) except *:
-        if self._clock.is_test_clock:
-            if self.next_close_ns < ts_event:
-                # Build bar first, then update
-                self._build_bar(self.next_close_ns)
-                self._builder.update(price, size, ts_event)
-                return
-            elif self.next_close_ns == ts_event:
-                # Update first, then build bar
-                self._builder.update(price, size, ts_event)
-                self._build_bar(self.next_close_ns)
-                return
-
-        self._builder.update(price, size, ts_event)
+    cdef bint _before_update(self, uint64_t ts_event) except *:
+        if self._clock.is_test_clock and self.next_close_ns < ts_event:
+            # Build bar first, then update
+            self._build_bar(self.next_close_ns)
+            return True
+        return False
+
+    cdef void _after_update(self, uint64_t ts_event, bint built) except *:
+        if built:
+            return
+
+        if self._clock.is_test_clock and self.next_close_ns == ts_event:
+            # Updated first, then build bar
+            self._build_bar(self.next_close_ns)
+            return
+
         if self._build_on_next_tick:  # (fast C-level check)
             self._build_and_send(self._stored_close_ns)
             # Reset flag and clear stored close
@@ -706,7 +763,7 @@ cdef class TimeBarAggregator(BarAggregator):
         self.next_close_ns = timer.next_time_ns
 
     cpdef void _build_event(self, TimeEvent event) except *:
-        if not self._builder.initialized:
+        if not bar_aggregator_initialized(&self._mem):
             # Set flag to build on next close with the stored close time
             self._build_on_next_tick = True
             self._stored_close_ns = self.next_close_ns
@@ -93,6 +93,10 @@ cdef class DataEngine(Component):
     cpdef void process(self, Data data) except *
     cpdef void request(self, DataRequest request) except *
     cpdef void response(self, DataResponse response) except *
+    cdef void process_order_book_data_c(self, OrderBookData data) except *
+    cdef void process_quote_tick_c(self, QuoteTick tick) except *
+    cdef void process_trade_tick_c(self, TradeTick tick) except *
+    cdef void process_bar_c(self, Bar bar) except *
 
 # -- COMMAND HANDLERS -----------------------------------------------------------------------------
 
@@ -545,6 +545,23 @@ cdef class DataEngine(Component):
 
         self._handle_response(response)
 
+    # Typed entry points for callers which have already resolved the data type
+    cdef void process_order_book_data_c(self, OrderBookData data) except *:
+        self.data_count += 1
+        self._handle_order_book_data(data)
+
+    cdef void process_quote_tick_c(self, QuoteTick tick) except *:
+        self.data_count += 1
+        self._handle_quote_tick(tick)
+
+    cdef void process_trade_tick_c(self, TradeTick tick) except *:
+        self.data_count += 1
+        self._handle_trade_tick(tick)
+
+    cdef void process_bar_c(self, Bar bar) except *:
+        self.data_count += 1
+        self._handle_bar(bar)
+
 # -- COMMAND HANDLERS -----------------------------------------------------------------------------
 
     cdef void _execute_command(self, DataCommand command) except *:
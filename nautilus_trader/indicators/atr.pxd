@@ -13,11 +13,13 @@
 #  limitations under the License.
 # -------------------------------------------------------------------------------------------------
 
+from nautilus_trader.core.rust.indicators cimport CAverageTrueRange
 from nautilus_trader.indicators.average.moving_average cimport MovingAverage
 from nautilus_trader.indicators.base.indicator cimport Indicator
 
 
 cdef class AverageTrueRange(Indicator):
+    cdef CAverageTrueRange _mem
     cdef MovingAverage _ma
     cdef bint _use_previous
     cdef double _value_floor
@@ -28,6 +30,7 @@ cdef class AverageTrueRange(Indicator):
     cdef readonly double value
     """The current value.\n\n:returns: `double`"""
 
-    cpdef void update_raw(self, double high, double low, double close)
-    cdef void _floor_value(self) except *
+    cpdef void update_raw(self, double high, double low, double close) except *
+    cpdef void update_many(self, double[::1] high, double[::1] low, double[::1] close) except *
+    cdef void _update_ma(self, double high, double low, double close) except *
     cdef void _check_initialized(self) except *
@@ -14,9 +14,17 @@
 # -------------------------------------------------------------------------------------------------
 
 from nautilus_trader.indicators.average.ma_factory import MovingAverageFactory
-from nautilus_trader.indicators.average.ma_factory import MovingAverageType
+from nautilus_trader.indicators.average.moving_average import MovingAverageType
 
 from nautilus_trader.core.correctness cimport Condition
+from nautilus_trader.core.rust.indicators cimport atr_free
+from nautilus_trader.core.rust.indicators cimport atr_initialized
+from nautilus_trader.core.rust.indicators cimport atr_new
+from nautilus_trader.core.rust.indicators cimport atr_reset
+from nautilus_trader.core.rust.indicators cimport atr_update_many
+from nautilus_trader.core.rust.indicators cimport atr_update_raw
+from nautilus_trader.indicators.average.moving_average cimport ma_type_is_native
+from nautilus_trader.indicators.average.moving_average cimport ma_type_to_rust
 from nautilus_trader.indicators.base.indicator cimport Indicator
 from nautilus_trader.model.data.bar cimport Bar
 
@@ -38,6 +46,13 @@ cdef class AverageTrueRange(Indicator):
         use previous price.
     value_floor : double
         The floor (minimum) output value for the indicator (>= 0).
+
+    Raises
+    ------
+    ValueError
+        If `period` is not positive (> 0).
+    ValueError
+        If `value_floor` is negative (< 0).
     """
 
     def __init__(
@@ -58,12 +73,22 @@ cdef class AverageTrueRange(Indicator):
         super().__init__(params=params)
 
         self.period = period
-        self._ma = MovingAverageFactory.create(period, ma_type)
-        self._use_previous = use_previous
-        self._value_floor = value_floor
-        self._previous_close = 0
         self.value = 0
 
+        # SIMPLE, EXPONENTIAL and WILDER run natively, other types fall back
+        # to the Python moving average.
+        if ma_type_is_native(ma_type):
+            self._mem = atr_new(period, ma_type_to_rust(ma_type), use_previous, value_floor)
+        else:
+            self._ma = MovingAverageFactory.create(period, ma_type)
+            self._use_previous = use_previous
+            self._value_floor = value_floor
+            self._previous_close = 0
+
+    def __del__(self) -> None:
+        if self._ma is None:
+            atr_free(self._mem)  # `self._mem` moved to Rust (then dropped)
+
     cpdef void handle_bar(self, Bar bar) except *:
         """
         Update the indicator with the given bar.
@@ -78,12 +103,7 @@ cdef class AverageTrueRange(Indicator):
 
         self.update_raw(bar.high.as_double(), bar.low.as_double(), bar.close.as_double())
 
-    cpdef void update_raw(
-        self,
-        double high,
-        double low,
-        double close,
-    ):
+    cpdef void update_raw(self, double high, double low, double close) except *:
         """
         Update the indicator with the given raw values.
 
@@ -97,6 +117,46 @@ cdef class AverageTrueRange(Indicator):
             The close price.
 
         """
+        if self._ma is not None:
+            self._update_ma(high, low, close)
+        else:
+            self.value = atr_update_raw(&self._mem, high, low, close)
+        self._check_initialized()
+
+    cpdef void update_many(self, double[::1] high, double[::1] low, double[::1] close) except *:
+        """
+        Update the indicator with each of the given raw values in order.
+
+        Parameters
+        ----------
+        high : double[::1]
+            The high prices.
+        low : double[::1]
+            The low prices.
+        close : double[::1]
+            The close prices.
+
+        Raises
+        ------
+        ValueError
+            If the lengths of `high`, `low` and `close` are not equal.
+
+        """
+        Condition.equal(len(high), len(low), "len(high)", "len(low)")
+        Condition.equal(len(high), len(close), "len(high)", "len(close)")
+
+        if high.shape[0] == 0:
+            return
+
+        cdef Py_ssize_t i
+        if self._ma is not None:
+            for i in range(high.shape[0]):
+                self._update_ma(high[i], low[i], close[i])
+        else:
+            self.value = atr_update_many(&self._mem, &high[0], &low[0], &close[0], high.shape[0])
+        self._check_initialized()
+
+    cdef void _update_ma(self, double high, double low, double close) except *:
         # Calculate average
         if self._use_previous:
             if not self.has_inputs:
@@ -106,25 +166,25 @@ cdef class AverageTrueRange(Indicator):
         else:
             self._ma.update_raw(high - low)
 
-        self._floor_value()
-        self._check_initialized()
-
-    cdef void _floor_value(self) except *:
-        if self._value_floor == 0:
-            self.value = self._ma.value
-        elif self._value_floor < self._ma.value:
+        # Floor the value
+        if self._value_floor == 0 or self._value_floor < self._ma.value:
             self.value = self._ma.value
         else:
-            # Floor the value
             self.value = self._value_floor
 
     cdef void _check_initialized(self) except *:
         if not self.initialized:
             self._set_has_inputs(True)
-            if self._ma.initialized:
+            if self._ma is not None:
+                if self._ma.initialized:
+                    self._set_initialized(True)
+            elif atr_initialized(&self._mem):
                 self._set_initialized(True)
 
     cpdef void _reset(self) except *:
-        self._ma.reset()
-        self._previous_close = 0
+        if self._ma is not None:
+            self._ma.reset()
+            self._previous_close = 0
+        else:
+            atr_reset(&self._mem)
         self.value = 0
@@ -13,9 +13,12 @@
 #  limitations under the License.
 # -------------------------------------------------------------------------------------------------
 
+from nautilus_trader.core.rust.indicators cimport CExponentialMovingAverage
 from nautilus_trader.indicators.average.moving_average cimport MovingAverage
 
 
 cdef class ExponentialMovingAverage(MovingAverage):
+    cdef CExponentialMovingAverage _mem
+
     cdef readonly double alpha
     """The moving average alpha value.\n\n:returns: `double`"""
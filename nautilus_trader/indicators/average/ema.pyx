@@ -14,6 +14,13 @@
 # -------------------------------------------------------------------------------------------------
 
 from nautilus_trader.core.correctness cimport Condition
+from nautilus_trader.core.rust.indicators cimport ema_count
+from nautilus_trader.core.rust.indicators cimport ema_free
+from nautilus_trader.core.rust.indicators cimport ema_initialized
+from nautilus_trader.core.rust.indicators cimport ema_new
+from nautilus_trader.core.rust.indicators cimport ema_reset
+from nautilus_trader.core.rust.indicators cimport ema_update_many
+from nautilus_trader.core.rust.indicators cimport ema_update_raw
 from nautilus_trader.indicators.average.moving_average cimport MovingAverage
 from nautilus_trader.model.c_enums.price_type cimport PriceType
 from nautilus_trader.model.data.bar cimport Bar
@@ -46,6 +53,10 @@ cdef class ExponentialMovingAverage(MovingAverage):
 
         self.alpha = 2.0 / (period + 1.0)
         self.value = 0
+        self._mem = ema_new(period, self.alpha)
+
+    def __del__(self) -> None:
+        ema_free(self._mem)  # `self._mem` moved to Rust (then dropped)
 
     cpdef void handle_quote_tick(self, QuoteTick tick) except *:
         """
@@ -100,9 +111,30 @@ cdef class ExponentialMovingAverage(MovingAverage):
             The update value.
 
         """
-        # Check if this is the initial input
-        if not self.has_inputs:
-            self.value = value
-
-        self.value = self.alpha * value + ((1.0 - self.alpha) * self.value)
+        self.value = ema_update_raw(&self._mem, value)
         self._increment_count()
+
+    cpdef void update_many(self, double[::1] values) except *:
+        """
+        Update the indicator with each of the given raw values in order.
+
+        Parameters
+        ----------
+        values : double[::1]
+            The update values.
+
+        """
+        if values.shape[0] == 0:
+            return
+
+        self.value = ema_update_many(&self._mem, &values[0], values.shape[0])
+        self.count = ema_count(&self._mem)
+
+        # Initialization logic
+        if not self.initialized:
+            self._set_has_inputs(True)
+            if ema_initialized(&self._mem):
+                self._set_initialized(True)
+
+    cpdef void _reset_ma(self) except *:
+        ema_reset(&self._mem)
@@ -13,10 +13,15 @@
 #  limitations under the License.
 # -------------------------------------------------------------------------------------------------
 
+from nautilus_trader.core.rust.indicators cimport MovingAverageType as MovingAverageType_t
 from nautilus_trader.indicators.base.indicator cimport Indicator
 from nautilus_trader.model.c_enums.price_type cimport PriceType
 
 
+cdef bint ma_type_is_native(ma_type) except *
+cdef MovingAverageType_t ma_type_to_rust(ma_type) except *
+
+
 cdef class MovingAverage(Indicator):
     cdef readonly int period
     """The moving average period.\n\n:returns: `PriceType`"""
@@ -28,5 +33,6 @@ cdef class MovingAverage(Indicator):
     """The current output value.\n\n:returns: `double`"""
 
     cpdef void update_raw(self, double value) except *
+    cpdef void update_many(self, double[::1] values) except *
     cpdef void _increment_count(self) except *
     cpdef void _reset_ma(self) except *
@@ -35,6 +35,23 @@ class MovingAverageType(Enum):
     DOUBLEEXPONENTIAL = 6
 
 
+cdef bint ma_type_is_native(ma_type) except *:
+    # Only these types have a native implementation for inner calculations
+    return ma_type in (
+        MovingAverageType.SIMPLE,
+        MovingAverageType.EXPONENTIAL,
+        MovingAverageType.WILDER,
+    )
+
+
+cdef MovingAverageType_t ma_type_to_rust(ma_type) except *:
+    Condition.true(
+        ma_type_is_native(ma_type),
+        f"`ma_type` {ma_type.name} not supported for native indicators",
+    )
+    return <MovingAverageType_t>ma_type.value
+
+
 cdef class MovingAverage(Indicator):
     """
     The abstract base class for all moving average type indicators.
@@ -79,6 +96,20 @@ cdef class MovingAverage(Indicator):
         """
         raise NotImplementedError("method must be implemented in the subclass")  # pragma: no cover
 
+    cpdef void update_many(self, double[::1] values) except *:
+        """
+        Update the indicator with each of the given raw values in order.
+
+        Parameters
+        ----------
+        values : double[::1]
+            The update values.
+
+        """
+        cdef Py_ssize_t i
+        for i in range(values.shape[0]):
+            self.update_raw(values[i])
+
     cpdef void _increment_count(self) except *:
         self.count += 1
 
@@ -13,8 +13,9 @@
 #  limitations under the License.
 # -------------------------------------------------------------------------------------------------
 
+from nautilus_trader.core.rust.indicators cimport CSimpleMovingAverage
 from nautilus_trader.indicators.average.moving_average cimport MovingAverage
 
 
 cdef class SimpleMovingAverage(MovingAverage):
-    cdef object _inputs
+    cdef CSimpleMovingAverage _mem
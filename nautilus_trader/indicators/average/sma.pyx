@@ -13,12 +13,14 @@
 #  limitations under the License.
 # -------------------------------------------------------------------------------------------------
 
-from collections import deque
-
-import numpy as np
-
 from nautilus_trader.core.correctness cimport Condition
-from nautilus_trader.core.stats cimport fast_mean
+from nautilus_trader.core.rust.indicators cimport sma_count
+from nautilus_trader.core.rust.indicators cimport sma_free
+from nautilus_trader.core.rust.indicators cimport sma_initialized
+from nautilus_trader.core.rust.indicators cimport sma_new
+from nautilus_trader.core.rust.indicators cimport sma_reset
+from nautilus_trader.core.rust.indicators cimport sma_update_many
+from nautilus_trader.core.rust.indicators cimport sma_update_raw
 from nautilus_trader.indicators.average.moving_average cimport MovingAverage
 from nautilus_trader.model.c_enums.price_type cimport PriceType
 from nautilus_trader.model.data.bar cimport Bar
@@ -48,8 +50,11 @@ cdef class SimpleMovingAverage(MovingAverage):
         Condition.positive_int(period, "period")
         super().__init__(period, params=[period], price_type=price_type)
 
-        self._inputs = deque(maxlen=period)
         self.value = 0
+        self._mem = sma_new(period)
+
+    def __del__(self) -> None:
+        sma_free(self._mem)  # `self._mem` moved to Rust (then dropped)
 
     cpdef void handle_quote_tick(self, QuoteTick tick) except *:
         """
@@ -104,10 +109,33 @@ cdef class SimpleMovingAverage(MovingAverage):
             The update value.
 
         """
-        self._inputs.append(value)
-
-        self.value = fast_mean(np.asarray(self._inputs, dtype=np.float64))
+        self.value = sma_update_raw(&self._mem, value)
         self._increment_count()
 
+    cpdef void update_many(self, double[::1] values) except *:
+        """
+        Update the indicator with each of the given raw values in order.
+
+        Only the final window is averaged, so large batches are cheaper than
+        the equivalent sequence of `update_raw` calls.
+
+        Parameters
+        ----------
+        values : double[::1]
+            The update values.
+
+        """
+        if values.shape[0] == 0:
+            return
+
+        self.value = sma_update_many(&self._mem, &values[0], values.shape[0])
+        self.count = sma_count(&self._mem)
+
+        # Initialization logic
+        if not self.initialized:
+            self._set_has_inputs(True)
+            if sma_initialized(&self._mem):
+                self._set_initialized(True)
+
     cpdef void _reset_ma(self) except *:
-        self._inputs.clear()
+        sma_reset(&self._mem)
@@ -13,11 +13,14 @@
 #  limitations under the License.
 # -------------------------------------------------------------------------------------------------
 
+from nautilus_trader.core.rust.indicators cimport CBollingerBands
+from nautilus_trader.indicators.average.moving_average cimport MovingAverage
 from nautilus_trader.indicators.base.indicator cimport Indicator
 
 
 cdef class BollingerBands(Indicator):
-    cdef object _ma
+    cdef CBollingerBands _mem
+    cdef MovingAverage _ma
     cdef object _prices
 
     cdef readonly int period
@@ -32,3 +35,6 @@ cdef class BollingerBands(Indicator):
     """The current value of the lower band.\n\n:returns: `double`"""
 
     cpdef void update_raw(self, double high, double low, double close) except *
+    cpdef void update_many(self, double[::1] high, double[::1] low, double[::1] close) except *
+    cdef void _update_ma(self, double high, double low, double close) except *
+    cdef void _update_values(self) except *
@@ -18,10 +18,21 @@ from collections import deque
 import numpy as np
 
 from nautilus_trader.indicators.average.ma_factory import MovingAverageFactory
-from nautilus_trader.indicators.average.ma_factory import MovingAverageType
+from nautilus_trader.indicators.average.moving_average import MovingAverageType
 
 from nautilus_trader.core.correctness cimport Condition
+from nautilus_trader.core.rust.indicators cimport bb_free
+from nautilus_trader.core.rust.indicators cimport bb_initialized
+from nautilus_trader.core.rust.indicators cimport bb_lower
+from nautilus_trader.core.rust.indicators cimport bb_middle
+from nautilus_trader.core.rust.indicators cimport bb_new
+from nautilus_trader.core.rust.indicators cimport bb_reset
+from nautilus_trader.core.rust.indicators cimport bb_update_many
+from nautilus_trader.core.rust.indicators cimport bb_update_raw
+from nautilus_trader.core.rust.indicators cimport bb_upper
 from nautilus_trader.core.stats cimport fast_std_with_mean
+from nautilus_trader.indicators.average.moving_average cimport ma_type_is_native
+from nautilus_trader.indicators.average.moving_average cimport ma_type_to_rust
 from nautilus_trader.indicators.base.indicator cimport Indicator
 from nautilus_trader.model.data.bar cimport Bar
 from nautilus_trader.model.data.tick cimport QuoteTick
@@ -65,13 +76,23 @@ cdef class BollingerBands(Indicator):
 
         self.period = period
         self.k = k
-        self._ma = MovingAverageFactory.create(period, ma_type)
-        self._prices = deque(maxlen=period)
+
+        # SIMPLE, EXPONENTIAL and WILDER run natively, other types fall back
+        # to the Python moving average.
+        if ma_type_is_native(ma_type):
+            self._mem = bb_new(period, k, ma_type_to_rust(ma_type))
+        else:
+            self._ma = MovingAverageFactory.create(period, ma_type)
+            self._prices = deque(maxlen=period)
 
         self.upper = 0
         self.middle = 0
         self.lower = 0
 
+    def __del__(self) -> None:
+        if self._ma is None:
+            bb_free(self._mem)  # `self._mem` moved to Rust (then dropped)
+
     cpdef void handle_quote_tick(self, QuoteTick tick) except *:
         """
         Update the indicator with the given tick.
@@ -136,6 +157,50 @@ cdef class BollingerBands(Indicator):
             The closing price for calculations
 
         """
+        if self._ma is not None:
+            self._update_ma(high, low, close)
+            return
+
+        bb_update_raw(&self._mem, high, low, close)
+        self._update_values()
+
+    cpdef void update_many(self, double[::1] high, double[::1] low, double[::1] close) except *:
+        """
+        Update the indicator with each of the given prices in order.
+
+        The standard deviation is only calculated for the final window.
+
+        Parameters
+        ----------
+        high : double[::1]
+            The high prices.
+        low : double[::1]
+            The low prices.
+        close : double[::1]
+            The closing prices.
+
+        Raises
+        ------
+        ValueError
+            If the lengths of `high`, `low` and `close` are not equal.
+
+        """
+        Condition.equal(len(high), len(low), "len(high)", "len(low)")
+        Condition.equal(len(high), len(close), "len(high)", "len(close)")
+
+        if high.shape[0] == 0:
+            return
+
+        cdef Py_ssize_t i
+        if self._ma is not None:
+            for i in range(high.shape[0]):
+                self._update_ma(high[i], low[i], close[i])
+            return
+
+        bb_update_many(&self._mem, &high[0], &low[0], &close[0], high.shape[0])
+        self._update_values()
+
+    cdef void _update_ma(self, double high, double low, double close) except *:
         # Add data to queues
         cdef double typical = (high + low + close) / 3
 
@@ -159,9 +224,24 @@ cdef class BollingerBands(Indicator):
         self.middle = self._ma.value
         self.lower = self._ma.value - (self.k * std)
 
+    cdef void _update_values(self) except *:
+        # Initialization logic
+        if not self.initialized:
+            self._set_has_inputs(True)
+            if bb_initialized(&self._mem):
+                self._set_initialized(True)
+
+        # Set values
+        self.upper = bb_upper(&self._mem)
+        self.middle = bb_middle(&self._mem)
+        self.lower = bb_lower(&self._mem)
+
     cpdef void _reset(self) except *:
-        self._ma.reset()
-        self._prices.clear()
+        if self._ma is not None:
+            self._ma.reset()
+            self._prices.clear()
+        else:
+            bb_reset(&self._mem)
 
         self.upper = 0
         self.middle = 0
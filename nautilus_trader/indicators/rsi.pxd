@@ -13,11 +13,13 @@
 #  limitations under the License.
 # -------------------------------------------------------------------------------------------------
 
+from nautilus_trader.core.rust.indicators cimport CRelativeStrengthIndex
 from nautilus_trader.indicators.average.moving_average cimport MovingAverage
 from nautilus_trader.indicators.base.indicator cimport Indicator
 
 
 cdef class RelativeStrengthIndex(Indicator):
+    cdef CRelativeStrengthIndex _mem
     cdef double _rsi_max
     cdef MovingAverage _average_gain
     cdef MovingAverage _average_loss
@@ -29,3 +31,6 @@ cdef class RelativeStrengthIndex(Indicator):
     """The current value.\n\n:returns: `double`"""
 
     cpdef void update_raw(self, double value) except *
+    cpdef void update_many(self, double[::1] values) except *
+    cdef void _update_ma(self, double value) except *
+    cdef void _check_initialized(self) except *
@@ -17,6 +17,14 @@ from nautilus_trader.indicators.average.ma_factory import MovingAverageFactory
 from nautilus_trader.indicators.average.moving_average import MovingAverageType
 
 from nautilus_trader.core.correctness cimport Condition
+from nautilus_trader.core.rust.indicators cimport rsi_free
+from nautilus_trader.core.rust.indicators cimport rsi_initialized
+from nautilus_trader.core.rust.indicators cimport rsi_new
+from nautilus_trader.core.rust.indicators cimport rsi_reset
+from nautilus_trader.core.rust.indicators cimport rsi_update_many
+from nautilus_trader.core.rust.indicators cimport rsi_update_raw
+from nautilus_trader.indicators.average.moving_average cimport ma_type_is_native
+from nautilus_trader.indicators.average.moving_average cimport ma_type_to_rust
 from nautilus_trader.indicators.base.indicator cimport Indicator
 from nautilus_trader.model.data.bar cimport Bar
 
@@ -51,12 +59,22 @@ cdef class RelativeStrengthIndex(Indicator):
         super().__init__(params=[period, ma_type.name])
 
         self.period = period
-        self._rsi_max = 1
-        self._average_gain = MovingAverageFactory.create(period, ma_type)
-        self._average_loss = MovingAverageFactory.create(period, ma_type)
-        self._last_value = 0
         self.value = 0
 
+        # SIMPLE, EXPONENTIAL and WILDER run natively, other types fall back
+        # to the Python moving average.
+        if ma_type_is_native(ma_type):
+            self._mem = rsi_new(period, ma_type_to_rust(ma_type))
+        else:
+            self._rsi_max = 1
+            self._average_gain = MovingAverageFactory.create(period, ma_type)
+            self._average_loss = MovingAverageFactory.create(period, ma_type)
+            self._last_value = 0
+
+    def __del__(self) -> None:
+        if self._average_gain is None:
+            rsi_free(self._mem)  # `self._mem` moved to Rust (then dropped)
+
     cpdef void handle_bar(self, Bar bar) except *:
         """
         Update the indicator with the given bar.
@@ -81,6 +99,36 @@ cdef class RelativeStrengthIndex(Indicator):
             The update value.
 
         """
+        if self._average_gain is not None:
+            self._update_ma(value)
+            return
+
+        self.value = rsi_update_raw(&self._mem, value)
+        self._check_initialized()
+
+    cpdef void update_many(self, double[::1] values) except *:
+        """
+        Update the indicator with each of the given values in order.
+
+        Parameters
+        ----------
+        values : double[::1]
+            The update values.
+
+        """
+        if values.shape[0] == 0:
+            return
+
+        cdef Py_ssize_t i
+        if self._average_gain is not None:
+            for i in range(values.shape[0]):
+                self._update_ma(values[i])
+            return
+
+        self.value = rsi_update_many(&self._mem, &values[0], values.shape[0])
+        self._check_initialized()
+
+    cdef void _update_ma(self, double value) except *:
         # Check if first input
         if not self.has_inputs:
             self._last_value = value
@@ -112,8 +160,17 @@ cdef class RelativeStrengthIndex(Indicator):
         self.value = self._rsi_max - (self._rsi_max / (1 + rs))
         self._last_value = value
 
+    cdef void _check_initialized(self) except *:
+        if not self.initialized:
+            self._set_has_inputs(True)
+            if rsi_initialized(&self._mem):
+                self._set_initialized(True)
+
     cpdef void _reset(self) except *:
-        self._average_gain.reset()
-        self._average_loss.reset()
-        self._last_value = 0
+        if self._average_gain is not None:
+            self._average_gain.reset()
+            self._average_loss.reset()
+            self._last_value = 0
+        else:
+            rsi_reset(&self._mem)
         self.value = 0
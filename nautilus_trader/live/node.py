@@ -83,6 +83,7 @@ class TradingNode:
             loop_debug=config.loop_debug,
             loop_sig_callback=self._loop_sig_handler,
             log_level=LogLevelParser.from_str_py(config.log_level.upper()),
+            logging_config=config.logging,
         )
 
         self._builder = TradingNodeBuilder(
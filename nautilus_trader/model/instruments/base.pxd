@@ -13,7 +13,11 @@
 #  limitations under the License.
 # -------------------------------------------------------------------------------------------------
 
+from libc.stdint cimport int64_t
+from libc.stdint cimport uint64_t
+
 from nautilus_trader.core.data cimport Data
+from nautilus_trader.core.rust.model cimport InstrumentSpec_t
 from nautilus_trader.model.c_enums.asset_class cimport AssetClass
 from nautilus_trader.model.c_enums.asset_type cimport AssetType
 from nautilus_trader.model.currency cimport Currency
@@ -27,6 +31,7 @@ from nautilus_trader.model.tick_scheme.base cimport TickScheme
 
 cdef class Instrument(Data):
     cdef TickScheme _tick_scheme
+    cdef InstrumentSpec_t _spec
 
     cdef readonly InstrumentId id
     """The instrument ID.\n\n:returns: `InstrumentId`"""
@@ -89,4 +94,9 @@ cdef class Instrument(Data):
     cpdef Price next_bid_price(self, double value, int num_ticks=*)
     cpdef Price next_ask_price(self, double value, int num_ticks=*)
     cpdef Quantity make_qty(self, value)
+    cpdef Price quantize_price(self, double value)
+    cpdef Quantity quantize_qty(self, double value)
+    cpdef void quantize_prices_raw(self, double[::1] values, int64_t[::1] out) except *
+    cdef Price _quantize_price_to_tick_scheme(self, double value)
+    cpdef void quantize_qtys_raw(self, double[::1] values, uint64_t[::1] out) except *
     cpdef Money notional_value(self, Quantity quantity, Price price, bint inverse_as_quote=*)
@@ -15,11 +15,23 @@
 
 import orjson
 
+from libc.stdint cimport INT64_MAX
+from libc.stdint cimport INT64_MIN
+from libc.stdint cimport UINT64_MAX
+from libc.stdint cimport int64_t
 from libc.stdint cimport uint64_t
 
 from decimal import Decimal
 
 from nautilus_trader.core.correctness cimport Condition
+from nautilus_trader.core.rust.model cimport FIXED_PRECISION
+from nautilus_trader.core.rust.model cimport instrument_spec_make_price_raw
+from nautilus_trader.core.rust.model cimport instrument_spec_make_qty_raw
+from nautilus_trader.core.rust.model cimport instrument_spec_new
+from nautilus_trader.core.rust.model cimport instrument_spec_quantize_price
+from nautilus_trader.core.rust.model cimport instrument_spec_quantize_prices
+from nautilus_trader.core.rust.model cimport instrument_spec_quantize_qty
+from nautilus_trader.core.rust.model cimport instrument_spec_quantize_qtys
 from nautilus_trader.model.c_enums.asset_class cimport AssetClass
 from nautilus_trader.model.c_enums.asset_class cimport AssetClassParser
 from nautilus_trader.model.c_enums.asset_type cimport AssetType
@@ -221,6 +233,26 @@ cdef class Instrument(Data):
         if self.tick_scheme_name is not None:
             self._tick_scheme = get_tick_scheme(self.tick_scheme_name)
 
+        # Cache the raw specification for quantization. Without a price
+        # increment (using a tick scheme) the spec rounds to the price precision.
+        cdef int64_t price_increment_raw
+        if price_increment is not None:
+            price_increment_raw = price_increment._mem.raw
+        else:
+            price_increment_raw = 10 ** (FIXED_PRECISION - price_precision)
+
+        self._spec = instrument_spec_new(
+            price_precision,
+            size_precision,
+            price_increment_raw,
+            size_increment._mem.raw,
+            multiplier._mem.raw,
+            min_quantity._mem.raw if min_quantity is not None else 0,
+            max_quantity._mem.raw if max_quantity is not None else UINT64_MAX,
+            min_price._mem.raw if min_price is not None else INT64_MIN,
+            max_price._mem.raw if max_price is not None else INT64_MAX,
+        )
+
     def __eq__(self, Instrument other) -> bool:
         return self.id == other.id
 
@@ -415,7 +447,10 @@ cdef class Instrument(Data):
         Price
 
         """
-        return Price(float(value), precision=self.price_precision)
+        return Price.from_raw_c(
+            instrument_spec_make_price_raw(&self._spec, float(value)),
+            self.price_precision,
+        )
 
     cpdef Price next_bid_price(self, double value, int num_ticks=0):
         """
@@ -486,7 +521,127 @@ cdef class Instrument(Data):
         Quantity
 
         """
-        return Quantity(float(value), precision=self.size_precision)
+        cdef double value_f64 = float(value)
+        Condition.not_negative(value_f64, "value")
+
+        return Quantity.from_raw_c(
+            instrument_spec_make_qty_raw(&self._spec, value_f64),
+            self.size_precision,
+        )
+
+    cpdef Price quantize_price(self, double value):
+        """
+        Return a new price from the given value rounded to the nearest valid
+        price increment (ties round up), and clamped to any min/max price.
+
+        If the instrument has no price increment and a tick scheme is assigned,
+        then the value is rounded to the nearest tick of the scheme.
+
+        Parameters
+        ----------
+        value : double
+            The value of the price.
+
+        Returns
+        -------
+        Price
+
+        """
+        if self.price_increment is None and self._tick_scheme is not None:
+            return self._quantize_price_to_tick_scheme(value)
+
+        return Price.from_raw_c(
+            instrument_spec_quantize_price(&self._spec, value),
+            self.price_precision,
+        )
+
+    cpdef Quantity quantize_qty(self, double value):
+        """
+        Return a new quantity from the given value rounded down to a valid size
+        increment, and clamped to any min/max quantity.
+
+        Parameters
+        ----------
+        value : double
+            The value of the quantity.
+
+        Returns
+        -------
+        Quantity
+
+        """
+        return Quantity.from_raw_c(
+            instrument_spec_quantize_qty(&self._spec, value),
+            self.size_precision,
+        )
+
+    cpdef void quantize_prices_raw(self, double[::1] values, int64_t[::1] out) except *:
+        """
+        Quantize the given price values as per `quantize_price`, writing the
+        raw (fixed-point) results into `out`.
+
+        Parameters
+        ----------
+        values : double[::1]
+            The price values to quantize.
+        out : int64_t[::1]
+            The output array for the raw prices.
+
+        Raises
+        ------
+        ValueError
+            If the lengths of `values` and `out` are not equal.
+
+        """
+        Condition.equal(len(values), len(out), "len(values)", "len(out)")
+
+        if values.shape[0] == 0:
+            return
+
+        cdef Py_ssize_t i
+        if self.price_increment is None and self._tick_scheme is not None:
+            for i in range(values.shape[0]):
+                out[i] = self._quantize_price_to_tick_scheme(values[i])._mem.raw
+            return
+
+        instrument_spec_quantize_prices(&self._spec, &values[0], &out[0], values.shape[0])
+
+    cdef Price _quantize_price_to_tick_scheme(self, double value):
+        if value <= self._tick_scheme.min_price.as_f64_c():
+            return self._tick_scheme.min_price
+        if value >= self._tick_scheme.max_price.as_f64_c():
+            return self._tick_scheme.max_price
+
+        cdef Price bid = self._tick_scheme.next_bid_price(value)
+        cdef Price ask = self._tick_scheme.next_ask_price(value)
+        if ask.as_f64_c() - value <= value - bid.as_f64_c():
+            return ask
+        return bid
+
+    cpdef void quantize_qtys_raw(self, double[::1] values, uint64_t[::1] out) except *:
+        """
+        Quantize the given quantity values as per `quantize_qty`, writing the
+        raw (fixed-point) results into `out`.
+
+        Parameters
+        ----------
+        values : double[::1]
+            The quantity values to quantize.
+        out : uint64_t[::1]
+            The output array for the raw quantities.
+
+        Raises
+        ------
+        ValueError
+            If the lengths of `values` and `out` are not equal.
+
+        """
+        Condition.equal(len(values), len(out), "len(values)", "len(out)")
+
+        if values.shape[0] == 0:
+            return
+
+        instrument_spec_quantize_qtys(&self._spec, &values[0], &out[0], values.shape[0])
 
     cpdef Money notional_value(
         self,
@@ -23,6 +23,7 @@ import pandas as pd
 import pyarrow as pa
 import pyarrow.dataset as ds
 import pyarrow.parquet as pq
+from fsspec.implementations.local import LocalFileSystem
 from fsspec.utils import infer_storage_options
 from pyarrow import ArrowInvalid
 
@@ -43,7 +44,8 @@ class ParquetDataCatalog(BaseDataCatalog):
     Parameters
     ----------
     path : str
-        The root path for this data catalog. Must exist and must be an absolute path.
+        The root path for this data catalog. Must exist. A relative path on the
+        local filesystem is resolved against the current working directory.
     fs_protocol : str, default 'file'
         The fsspec filesystem protocol to use.
     fs_storage_options : Dict, optional
@@ -62,6 +64,8 @@ class ParquetDataCatalog(BaseDataCatalog):
             self.fs_protocol, **self.fs_storage_options
         )
         self.path: pathlib.Path = pathlib.Path(path)
+        if isinstance(self.fs, LocalFileSystem):
+            self.path = self.path.absolute()  # Independent of later working directory changes
 
     @classmethod
     def from_env(cls):
@@ -96,6 +100,44 @@ class ParquetDataCatalog(BaseDataCatalog):
         projections: Optional[Dict] = None,
         **kwargs,
     ):
+        table = self._load_table(
+            cls=cls,
+            filter_expr=filter_expr,
+            instrument_ids=instrument_ids,
+            start=start,
+            end=end,
+            ts_column=ts_column,
+            raise_on_empty=raise_on_empty,
+            instrument_id_column=instrument_id_column,
+            table_kwargs=table_kwargs,
+            clean_instrument_keys=clean_instrument_keys,
+            projections=projections,
+        )
+        if table is None:
+            return pd.DataFrame() if as_dataframe else None
+
+        mappings = self.load_inverse_mappings(path=self._make_path(cls=cls))
+        if as_dataframe:
+            return self._handle_table_dataframe(
+                table=table, mappings=mappings, raise_on_empty=raise_on_empty, **kwargs
+            )
+        else:
+            return self._handle_table_nautilus(table=table, cls=cls, mappings=mappings)
+
+    def _load_table(
+        self,
+        cls: type,
+        filter_expr: Optional[Callable] = None,
+        instrument_ids=None,
+        start=None,
+        end=None,
+        ts_column="ts_init",
+        raise_on_empty: bool = True,
+        instrument_id_column="instrument_id",
+        table_kwargs: Optional[Dict] = None,
+        clean_instrument_keys: bool = True,
+        projections: Optional[Dict] = None,
+    ) -> Optional[pa.Table]:
         filters = [filter_expr] if filter_expr is not None else []
         if instrument_ids is not None:
             if not isinstance(instrument_ids, list):
@@ -113,21 +155,14 @@ class ParquetDataCatalog(BaseDataCatalog):
             if raise_on_empty:
                 raise FileNotFoundError(f"protocol={self.fs.protocol}, path={full_path}")
             else:
-                return pd.DataFrame() if as_dataframe else None
+                return None
 
         dataset = ds.dataset(full_path, partitioning="hive", filesystem=self.fs)
         table_kwargs = table_kwargs or {}
         if projections:
             projected = {**{c: ds.field(c) for c in dataset.schema.names}, **projections}
             table_kwargs.update(columns=projected)
-        table = dataset.to_table(filter=combine_filters(*filters), **(table_kwargs or {}))
-        mappings = self.load_inverse_mappings(path=full_path)
-        if as_dataframe:
-            return self._handle_table_dataframe(
-                table=table, mappings=mappings, raise_on_empty=raise_on_empty, **kwargs
-            )
-        else:
-            return self._handle_table_nautilus(table=table, cls=cls, mappings=mappings)
+        return dataset.to_table(filter=combine_filters(*filters), **(table_kwargs or {}))
 
     def load_inverse_mappings(self, path):
         mappings = load_mappings(fs=self.fs, path=path)
@@ -304,8 +339,6 @@ def _should_use_windows_paths(fs: fsspec.filesystem) -> bool:
     fsspec.filesystem that is local.
 
     """
-    from fsspec.implementations.local import LocalFileSystem
-
     try:
         from fsspec.implementations.smb import SMBFileSystem
     except ImportError:
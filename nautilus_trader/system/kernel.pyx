@@ -34,6 +34,7 @@ from nautilus_trader.config import ImportableStrategyConfig
 from nautilus_trader.config import LiveDataEngineConfig
 from nautilus_trader.config import LiveExecEngineConfig
 from nautilus_trader.config import LiveRiskEngineConfig
+from nautilus_trader.config import LoggingConfig
 from nautilus_trader.config import RiskEngineConfig
 from nautilus_trader.config import StrategyFactory
 from nautilus_trader.config import StreamingConfig
@@ -45,9 +46,11 @@ from nautilus_trader.common.actor cimport Actor
 from nautilus_trader.common.clock cimport LiveClock
 from nautilus_trader.common.clock cimport TestClock
 from nautilus_trader.common.logging cimport LiveLogger
+from nautilus_trader.common.logging cimport LogFileFormat
 from nautilus_trader.common.logging cimport Logger
 from nautilus_trader.common.logging cimport LoggerAdapter
 from nautilus_trader.common.logging cimport LogLevel
+from nautilus_trader.common.logging cimport LogLevelParser
 from nautilus_trader.common.logging cimport nautilus_header
 from nautilus_trader.core.correctness cimport Condition
 from nautilus_trader.core.datetime cimport nanos_to_millis
@@ -117,6 +120,8 @@ cdef class NautilusKernel:
         The log level for the kernels logger.
     bypass_logging : bool, default False
         If logging to stdout should be bypassed.
+    logging_config : LoggingConfig, optional
+        The configuration for the kernels logger.
 
     Raises
     ------
@@ -149,6 +154,7 @@ cdef class NautilusKernel:
         save_state: bool = False,
         LogLevel log_level = LogLevel.INFO,
         bypass_logging: bool = False,
+        logging_config: Optional[LoggingConfig] = None,
     ):
         if uvloop is None:
             warnings.warn("uvloop is not available.")
@@ -156,6 +162,8 @@ cdef class NautilusKernel:
             actor_configs = []
         if strategy_configs is None:
             strategy_configs = []
+        if logging_config is None:
+            logging_config = LoggingConfig()
         Condition.type(environment, Environment, "environment")
         Condition.valid_string(name, "name")
         Condition.type(cache_config, CacheConfig, "cache_config")
@@ -164,6 +172,7 @@ cdef class NautilusKernel:
         Condition.true(isinstance(risk_config, (RiskEngineConfig, LiveRiskEngineConfig)), "risk_config was unrecognized type", ex_type=TypeError)
         Condition.true(isinstance(exec_config, (ExecEngineConfig, LiveExecEngineConfig)), "exec_config was unrecognized type", ex_type=TypeError)
         Condition.type_or_none(streaming_config, StreamingConfig, "streaming_config")
+        Condition.type(logging_config, LoggingConfig, "logging_config")
 
         self.environment = environment
 
@@ -184,6 +193,7 @@ cdef class NautilusKernel:
                 instance_id=self.instance_id,
                 level_stdout=log_level,
                 bypass=bypass_logging,
+                is_async=logging_config.is_async,
             )
         elif self.environment in (Environment.SANDBOX, Environment.LIVE):
             self.clock = LiveClock(loop=loop)
@@ -194,10 +204,26 @@ cdef class NautilusKernel:
                 machine_id=self.machine_id,
                 instance_id=self.instance_id,
                 level_stdout=log_level,
+                is_async=logging_config.is_async,
             )
         else:  # pragma: no cover (design-time error)
             raise NotImplementedError(f"environment {environment} not recognized")
 
+        if logging_config.component_levels:
+            for component, level in logging_config.component_levels.items():
+                self.logger.set_component_level(component, LogLevelParser.from_str(level.upper()))
+        if logging_config.file_directory is not None:
+            file_format = logging_config.file_format.upper()
+            Condition.true(file_format in ("BINARY", "JSON"), "file_format was unrecognized")
+            self.logger.add_file_sink(
+                directory=logging_config.file_directory,
+                basename=logging_config.file_basename,
+                level=LogLevelParser.from_str(logging_config.file_level.upper()),
+                fmt=LogFileFormat.JSON if file_format == "JSON" else LogFileFormat.BINARY,
+                max_size_bytes=logging_config.file_max_size_bytes,
+                rotation_interval_ns=logging_config.file_rotation_interval_ns,
+            )
+
         # Setup logging
         self.log = LoggerAdapter(
             component_name=name,
@@ -0,0 +1,265 @@
+# -------------------------------------------------------------------------------------------------
+#  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+#  https://nautechsystems.io
+#
+#  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+#  You may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+# -------------------------------------------------------------------------------------------------
+
+import numpy as np
+import pyarrow as pa
+
+from nautilus_trader.backtest.data.providers import TestInstrumentProvider
+from nautilus_trader.backtest.data.store import ListDataStream
+from nautilus_trader.backtest.data.store import QuoteTickColumns
+from nautilus_trader.backtest.data.store import TradeTickColumns
+from nautilus_trader.backtest.engine import BacktestEngine
+from nautilus_trader.model.data.tick import QuoteTick
+from nautilus_trader.model.data.tick import TradeTick
+from nautilus_trader.model.enums import AggressorSide
+from nautilus_trader.model.identifiers import TradeId
+from nautilus_trader.model.objects import Price
+from nautilus_trader.model.objects import Quantity
+
+
+USDJPY_SIM = TestInstrumentProvider.default_fx_ccy("USD/JPY")
+
+
+def quote_tick(ts_init: int) -> QuoteTick:
+    return QuoteTick(
+        instrument_id=USDJPY_SIM.id,
+        bid=Price.from_str("90.002"),
+        ask=Price.from_str("90.005"),
+        bid_size=Quantity.from_int(1_000_000),
+        ask_size=Quantity.from_int(1_000_000),
+        ts_event=ts_init,
+        ts_init=ts_init,
+    )
+
+
+class TestListDataStream:
+    def test_unsorted_list_is_sorted_by_ts_init(self):
+        # Arrange
+        tick1 = quote_tick(1)
+        tick2 = quote_tick(2)
+
+        # Act
+        stream = ListDataStream([tick2, tick1])
+
+        # Assert
+        assert len(stream) == 2
+        assert stream.to_list() == [tick1, tick2]
+
+    def test_data_type_when_all_same_type(self):
+        # Arrange, Act
+        stream = ListDataStream([quote_tick(1), quote_tick(2)])
+
+        # Assert
+        assert stream.data_type is QuoteTick
+        assert stream.venue is None
+
+    def test_data_type_when_mixed_types_is_none(self):
+        # Arrange
+        trade = TradeTick(
+            instrument_id=USDJPY_SIM.id,
+            price=Price.from_str("90.003"),
+            size=Quantity.from_int(1_000),
+            aggressor_side=AggressorSide.BUY,
+            trade_id=TradeId("1"),
+            ts_event=2,
+            ts_init=2,
+        )
+
+        # Act
+        stream = ListDataStream([quote_tick(1), trade])
+
+        # Assert
+        assert stream.data_type is None
+
+
+class TestQuoteTickColumns:
+    def test_ticks_are_materialized_on_access(self):
+        # Arrange
+        columns = QuoteTickColumns(
+            instrument=USDJPY_SIM,
+            bid=np.array([86_655_000_000, 86_656_000_000]),
+            ask=np.array([86_728_000_000, 86_729_000_000]),
+            bid_size=np.array([1_000_000_000_000_000, 2_000_000_000_000_000]),
+            ask_size=np.array([1_000_000_000_000_000, 2_000_000_000_000_000]),
+            ts_event=np.array([1_000, 2_000]),
+            ts_init=np.array([1_000, 2_000]),
+        )
+
+        # Act
+        tick = columns[1]
+
+        # Assert
+        assert len(columns) == 2
+        assert columns.data_type is QuoteTick
+        assert columns.venue == USDJPY_SIM.id.venue
+        assert isinstance(tick, QuoteTick)
+        assert tick.instrument_id == USDJPY_SIM.id
+        assert tick.bid == Price.from_str("86.656")
+        assert tick.ask == Price.from_str("86.729")
+        assert tick.bid_size == Quantity.from_int(2_000_000)
+        assert tick.ts_event == 2_000
+        assert tick.ts_init == 2_000
+
+    def test_unsorted_columns_are_sorted_by_ts_init(self):
+        # Arrange, Act
+        columns = QuoteTickColumns(
+            instrument=USDJPY_SIM,
+            bid=np.array([2, 1]) * 1_000_000_000,
+            ask=np.array([2, 1]) * 1_000_000_000,
+            bid_size=np.array([1, 1]) * 1_000_000_000,
+            ask_size=np.array([1, 1]) * 1_000_000_000,
+            ts_event=np.array([2_000, 1_000]),
+            ts_init=np.array([2_000, 1_000]),
+        )
+
+        # Assert
+        assert [t.ts_init for t in columns.to_list()] == [1_000, 2_000]
+        assert [t.bid for t in columns.to_list()] == [Price.from_str("1.000"), Price.from_str("2.000")]
+
+    def test_from_arrow_with_catalog_schema(self):
+        # Arrange
+        table = pa.table(
+            {
+                "bid": ["86.655", "86.656"],
+                "bid_size": ["1000000", "2000000"],
+                "ask": ["86.728", "86.729"],
+                "ask_size": ["1000000", "2000000"],
+                "ts_event": pa.array([1_000, 2_000], pa.uint64()),
+                "ts_init": pa.array([1_000, 2_000], pa.uint64()),
+            },
+        )
+
+        # Act
+        columns = QuoteTickColumns.from_arrow(USDJPY_SIM, table.to_batches()[0])
+
+        # Assert
+        assert len(columns) == 2
+        assert columns[0].bid == Price.from_str("86.655")
+        assert columns[-1].ask == Price.from_str("86.729")
+        assert columns[-1].ask_size == Quantity.from_int(2_000_000)
+
+    def test_to_arrow_round_trips_raw_columns(self):
+        # Arrange
+        table = pa.table(
+            {
+                "bid": ["86.655", "86.656"],
+                "bid_size": ["1000000", "2000000"],
+                "ask": ["86.728", "86.729"],
+                "ask_size": ["1000000", "2000000"],
+                "ts_event": pa.array([1_000, 2_000], pa.uint64()),
+                "ts_init": pa.array([1_000, 2_000], pa.uint64()),
+            },
+        )
+        columns = QuoteTickColumns.from_arrow(USDJPY_SIM, table)
+
+        # Act
+        raw = columns.to_arrow()
+        result = QuoteTickColumns.from_arrow(USDJPY_SIM, raw)
+
+        # Assert
+        assert raw.schema.field("bid").type == pa.int64()
+        assert result.to_list() == columns.to_list()
+
+
+class TestTradeTickColumns:
+    def test_from_arrow_with_catalog_schema(self):
+        # Arrange
+        table = pa.table(
+            {
+                "price": ["86.655", "86.656"],
+                "size": ["1000", "2000"],
+                "aggressor_side": pa.array(["BUY", "SELL"]).dictionary_encode(),
+                "trade_id": ["1", "2"],
+                "ts_event": pa.array([1_000, 2_000], pa.uint64()),
+                "ts_init": pa.array([1_000, 2_000], pa.uint64()),
+            },
+        )
+
+        # Act
+        columns = TradeTickColumns.from_arrow(USDJPY_SIM, table)
+        tick = columns[1]
+
+        # Assert
+        assert isinstance(tick, TradeTick)
+        assert tick.price == Price.from_str("86.656")
+        assert tick.size == Quantity.from_int(2_000)
+        assert tick.aggressor_side == AggressorSide.SELL
+        assert tick.trade_id == TradeId("2")
+        assert tick.ts_init == 2_000
+
+    def test_to_arrow_round_trips_raw_columns(self):
+        # Arrange
+        table = pa.table(
+            {
+                "price": ["86.655", "86.656"],
+                "size": ["1000", "2000"],
+                "aggressor_side": pa.array(["BUY", "SELL"]).dictionary_encode(),
+                "trade_id": ["1", "2"],
+                "ts_event": pa.array([1_000, 2_000], pa.uint64()),
+                "ts_init": pa.array([1_000, 2_000], pa.uint64()),
+            },
+        )
+        columns = TradeTickColumns.from_arrow(USDJPY_SIM, table)
+
+        # Act
+        result = TradeTickColumns.from_arrow(USDJPY_SIM, columns.to_arrow())
+
+        # Assert
+        assert result.to_list() == columns.to_list()
+
+
+    def test_from_arrow_parses_decimal_strings_exactly(self):
+        # Arrange
+        instrument = TestInstrumentProvider.btcusdt_binance()  # Size precision 6
+        table = pa.table(
+            {
+                "price": ["10000.00"],
+                "size": ["9007199254.740993"],  # Beyond 2^53 at size precision
+                "aggressor_side": pa.array(["BUY"]).dictionary_encode(),
+                "trade_id": ["1"],
+                "ts_event": pa.array([1_000], pa.uint64()),
+                "ts_init": pa.array([1_000], pa.uint64()),
+            },
+        )
+
+        # Act
+        columns = TradeTickColumns.from_arrow(instrument, table)
+
+        # Assert
+        assert columns[0].size == Quantity.from_str("9007199254.740993")
+
+class TestBacktestEngineWithColumns:
+    def test_add_quote_tick_columns_merges_with_list_data(self):
+        # Arrange
+        engine = BacktestEngine()
+        engine.add_instrument(USDJPY_SIM)
+
+        tick = quote_tick(1_500)
+        columns = QuoteTickColumns(
+            instrument=USDJPY_SIM,
+            bid=np.array([86_655_000_000, 86_656_000_000]),
+            ask=np.array([86_728_000_000, 86_729_000_000]),
+            bid_size=np.array([1_000_000_000_000_000, 1_000_000_000_000_000]),
+            ask_size=np.array([1_000_000_000_000_000, 1_000_000_000_000_000]),
+            ts_event=np.array([1_000, 2_000]),
+            ts_init=np.array([1_000, 2_000]),
+        )
+
+        # Act
+        engine.add_data(columns)
+        engine.add_data([tick])
+
+        # Assert
+        assert [d.ts_init for d in engine.data] == [1_000, 1_500, 2_000]
@@ -13,10 +13,12 @@
 #  limitations under the License.
 # -------------------------------------------------------------------------------------------------
 
+import pickle
 import tempfile
 from decimal import Decimal
 
 import pandas as pd
+import pytest
 
 from nautilus_trader.backtest.data.providers import TestDataProvider
 from nautilus_trader.backtest.data.providers import TestInstrumentProvider
@@ -26,6 +28,8 @@ from nautilus_trader.backtest.data.wranglers import TradeTickDataWrangler
 from nautilus_trader.backtest.engine import BacktestEngine
 from nautilus_trader.backtest.engine import BacktestEngineConfig
 from nautilus_trader.backtest.models import FillModel
+from nautilus_trader.common.logging import LogLevel
+from nautilus_trader.config import LoggingConfig
 from nautilus_trader.examples.strategies.ema_cross import EMACross
 from nautilus_trader.examples.strategies.ema_cross import EMACrossConfig
 from nautilus_trader.model.currencies import USD
@@ -107,6 +111,47 @@ class TestBacktestEngine:
         assert engine.backtest_end is None
         assert engine.iteration == 0
 
+    def test_logging_config_is_passed_to_kernel_logger(self):
+        # Arrange
+        config = BacktestEngineConfig(logging=LoggingConfig(is_async=True))
+
+        # Act
+        engine = BacktestEngine(config=config)
+
+        # Assert
+        assert engine.kernel.logger.is_async
+        engine.dispose()
+
+    def test_logging_config_component_levels_are_set_on_kernel_logger(self):
+        # Arrange
+        config = BacktestEngineConfig(
+            log_level="INFO",
+            logging=LoggingConfig(component_levels={"DataEngine": "DEBUG"}),
+        )
+
+        # Act
+        engine = BacktestEngine(config=config)
+
+        # Assert
+        assert engine.kernel.logger.is_enabled(LogLevel.DEBUG, "DataEngine")
+        assert not engine.kernel.logger.is_enabled(LogLevel.DEBUG, "RiskEngine")
+        engine.dispose()
+
+    def test_logging_config_file_directory_adds_file_sink(self, tmp_path):
+        # Arrange
+        config = BacktestEngineConfig(
+            log_level="ERROR",
+            logging=LoggingConfig(file_directory=str(tmp_path), file_format="JSON"),
+        )
+
+        # Act
+        engine = BacktestEngine(config=config)
+        engine.kernel.logger.flush()
+
+        # Assert
+        assert (tmp_path / "nautilus_0000.jsonl").read_text()
+        engine.dispose()
+
     def test_reset_engine(self):
         # Arrange
         self.engine.run()
@@ -210,6 +255,36 @@ class TestBacktestEngineData:
         # Assert
         assert len(engine.data) == 5
 
+    def test_add_data_merges_batches_in_ts_init_order(self, capsys):
+        # Arrange
+        engine = BacktestEngine()
+
+        data_type = DataType(MyData, metadata={"news_wire": "hacks"})
+
+        generic_data1 = [
+            GenericData(data_type, MyData("AAPL hacked", 1000, 1000)),
+            GenericData(data_type, MyData("AMZN hacked", 2000, 2000)),
+            GenericData(data_type, MyData("NFLX hacked", 3000, 3000)),
+        ]
+
+        generic_data2 = [
+            GenericData(data_type, MyData("MSFT hacked", 2500, 2500)),
+            GenericData(data_type, MyData("FB hacked", 2000, 2000)),  # <-- unsorted
+        ]
+
+        # Act
+        engine.add_data(generic_data1, ClientId("NEWS_CLIENT"))
+        engine.add_data(generic_data2, ClientId("NEWS_CLIENT"))
+
+        # Assert
+        assert [d.data.value for d in engine.data] == [
+            "AAPL hacked",
+            "AMZN hacked",
+            "FB hacked",  # <-- ties resolve to the earlier added batch
+            "MSFT hacked",
+            "NFLX hacked",
+        ]
+
     def test_add_instrument_adds_to_engine(self, capsys):
         # Arrange
         engine = BacktestEngine()
@@ -448,12 +523,16 @@ class TestBacktestEngineData:
 class TestBacktestWithAddedBars:
     def setup(self):
         # Fixture Setup
+        self.venue = Venue("SIM")
+        self.engine = self.create_engine()
+
+    def create_engine(self, profile=False):
         config = BacktestEngineConfig(
             bypass_logging=False,
             run_analysis=False,
+            profile=profile,
         )
-        self.engine = BacktestEngine(config=config)
-        self.venue = Venue("SIM")
+        engine = BacktestEngine(config=config)
 
         # Setup data
         bid_bar_type = BarType(
@@ -483,11 +562,11 @@ class TestBacktestWithAddedBars:
         ask_bars = ask_wrangler.process(provider.read_csv_bars("fxcm-gbpusd-m1-ask-2012.csv"))
 
         # Add data
-        self.engine.add_instrument(GBPUSD_SIM)
-        self.engine.add_data(bid_bars)
-        self.engine.add_data(ask_bars)
+        engine.add_instrument(GBPUSD_SIM)
+        engine.add_data(bid_bars)
+        engine.add_data(ask_bars)
 
-        self.engine.add_venue(
+        engine.add_venue(
             venue=self.venue,
             oms_type=OMSType.HEDGING,
             account_type=AccountType.MARGIN,
@@ -495,6 +574,8 @@ class TestBacktestWithAddedBars:
             starting_balances=[Money(1_000_000, USD)],
         )
 
+        return engine
+
     def teardown(self):
         self.engine.dispose()
 
@@ -525,6 +606,98 @@ class TestBacktestWithAddedBars:
             1001736.78, USD
         )
 
+    def test_get_result_when_not_profiled_has_no_profile(self):
+        # Arrange
+        self.engine.run()
+
+        # Act
+        result = self.engine.get_result()
+
+        # Assert
+        assert result.profile is None
+
+    def test_run_with_profile_returns_stage_breakdown(self):
+        # Arrange
+        self.engine.dispose()
+        self.engine = self.create_engine(profile=True)
+
+        bar_type = BarType(
+            instrument_id=GBPUSD_SIM.id,
+            bar_spec=TestDataStubs.bar_spec_1min_bid(),
+            aggregation_source=AggregationSource.EXTERNAL,  # <-- important
+        )
+        config = EMACrossConfig(
+            instrument_id=str(GBPUSD_SIM.id),
+            bar_type=str(bar_type),
+            trade_size=Decimal(100_000),
+            fast_ema=10,
+            slow_ema=20,
+        )
+        strategy = EMACross(config=config)
+        self.engine.add_strategy(strategy)
+
+        # Act
+        self.engine.run()
+        result = self.engine.get_result()
+
+        # Assert
+        assert result.profile["run"]["iterations"] == 60234
+        assert result.profile["run"]["events"] == self.engine.kernel.exec_engine.event_count
+        assert result.profile["advance_time"]["calls"] == 60234
+        assert result.profile["data_engine"]["calls"] == 60234
+        assert result.profile["exchange.SIM.data"]["calls"] == 60234
+        assert result.profile[f"strategy.{strategy.id}.on_bar"]["calls"] == 30117
+        assert result.profile["risk_engine"]["calls"] > 0
+        assert result.profile["exec_engine"]["calls"] > 0
+        assert self.engine.portfolio.account(self.venue).balance_total(USD) == Money(
+            1001736.78, USD
+        )
+
+    def test_run_with_profile_wraps_strategies_added_between_runs(self):
+        # Arrange
+        self.engine.dispose()
+        self.engine = self.create_engine(profile=True)
+
+        bar_type = BarType(
+            instrument_id=GBPUSD_SIM.id,
+            bar_spec=TestDataStubs.bar_spec_1min_bid(),
+            aggregation_source=AggregationSource.EXTERNAL,  # <-- important
+        )
+        strategy1 = EMACross(
+            config=EMACrossConfig(
+                instrument_id=str(GBPUSD_SIM.id),
+                bar_type=str(bar_type),
+                trade_size=Decimal(100_000),
+                order_id_tag="001",
+            ),
+        )
+        strategy2 = EMACross(
+            config=EMACrossConfig(
+                instrument_id=str(GBPUSD_SIM.id),
+                bar_type=str(bar_type),
+                trade_size=Decimal(100_000),
+                order_id_tag="002",
+            ),
+        )
+        on_event = strategy1.on_event
+        strategy1.on_event = on_event  # Instance handler to be restored on reset
+        self.engine.add_strategy(strategy1)
+        self.engine.run()
+
+        # Act
+        self.engine.add_strategy(strategy2)
+        self.engine.run()
+        result = self.engine.get_result()
+        self.engine.reset()
+
+        # Assert
+        assert result.profile[f"strategy.{strategy1.id}.on_bar"]["calls"] > 0
+        assert result.profile[f"strategy.{strategy2.id}.on_bar"]["calls"] > 0
+        assert strategy1.__dict__["on_event"] is on_event
+        assert "on_bar" not in strategy1.__dict__
+        assert "on_bar" not in strategy2.__dict__
+        assert "on_event" not in strategy2.__dict__
+
     def test_dump_pickled_data(self):
         # Arrange, # Act, # Assert
         assert len(self.engine.dump_pickled_data()) == 7229570
@@ -558,3 +731,73 @@ class TestBacktestWithAddedBars:
         assert self.engine.portfolio.account(self.venue).balance_total(USD) == Money(
             1001736.78, USD
         )
+
+    def test_load_pickled_empty_data_then_run_raises_value_error(self):
+        # Arrange
+        self.engine.load_pickled_data(pickle.dumps([]))
+
+        # Act, Assert
+        assert self.engine.data == []
+        with pytest.raises(ValueError):
+            self.engine.run()
+
+    def test_checkpoint_when_not_running_raises_runtime_error(self, tmp_path):
+        # Arrange, Act, Assert
+        with pytest.raises(RuntimeError):
+            self.engine.checkpoint(str(tmp_path / "checkpoint.bin"))
+
+    def test_restore_from_checkpoint_continues_run(self, tmp_path):
+        # Arrange
+        bar_type = BarType(
+            instrument_id=GBPUSD_SIM.id,
+            bar_spec=TestDataStubs.bar_spec_1min_bid(),
+            aggregation_source=AggregationSource.EXTERNAL,  # <-- important
+        )
+        config = EMACrossConfig(
+            instrument_id=str(GBPUSD_SIM.id),
+            bar_type=str(bar_type),
+            trade_size=Decimal(100_000),
+            fast_ema=10,
+            slow_ema=20,
+        )
+        self.engine.add_strategy(EMACross(config=config))
+        self.engine.run_streaming(end=pd.Timestamp("2012-02-15", tz="UTC"))
+
+        path = str(tmp_path / "checkpoint.bin")
+        self.engine.checkpoint(path)
+
+        restored = self.create_engine()
+        restored.add_strategy(EMACross(config=config))
+
+        # Act
+        restored.restore(path)
+
+        # Assert
+        assert restored.run_id == self.engine.run_id
+        assert restored.iteration == self.engine.iteration
+        assert restored.cache.orders_total_count() == self.engine.cache.orders_total_count()
+        assert restored.cache.positions_total_count() == self.engine.cache.positions_total_count()
+        account = self.engine.portfolio.account(self.venue)
+        assert restored.portfolio.account(self.venue).balance_total(USD) == account.balance_total(USD)
+
+        restored.run_streaming()
+        restored.end_streaming()
+
+        uninterrupted = self.create_engine()
+        uninterrupted.add_strategy(EMACross(config=config))
+        uninterrupted.run()
+
+        def fills(engine):
+            return [
+                (o.client_order_id, o.trade_ids, o.avg_px, o.filled_qty)
+                for o in sorted(engine.cache.orders(), key=lambda o: o.client_order_id.value)
+            ]
+
+        assert restored.iteration == uninterrupted.iteration
+        assert restored.cache.orders_total_count() == uninterrupted.cache.orders_total_count()
+        assert restored.portfolio.account(self.venue).balance_total(
+            USD
+        ) == uninterrupted.portfolio.account(self.venue).balance_total(USD)
+        assert fills(restored) == fills(uninterrupted)
+        restored.dispose()
+        uninterrupted.dispose()
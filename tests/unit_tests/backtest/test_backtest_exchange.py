@@ -34,6 +34,8 @@ from nautilus_trader.execution.messages import ModifyOrder
 from nautilus_trader.model.currencies import BTC
 from nautilus_trader.model.currencies import JPY
 from nautilus_trader.model.currencies import USD
+from nautilus_trader.model.data.bar import Bar
+from nautilus_trader.model.data.bar import BarType
 from nautilus_trader.model.data.tick import QuoteTick
 from nautilus_trader.model.enums import AccountType
 from nautilus_trader.model.enums import AggressorSide
@@ -49,6 +51,7 @@ from nautilus_trader.model.events.order import OrderRejected
 from nautilus_trader.model.identifiers import ClientOrderId
 from nautilus_trader.model.identifiers import PositionId
 from nautilus_trader.model.identifiers import StrategyId
+from nautilus_trader.model.identifiers import TradeId
 from nautilus_trader.model.identifiers import Venue
 from nautilus_trader.model.identifiers import VenueOrderId
 from nautilus_trader.model.objects import Money
@@ -201,6 +204,111 @@ class TestSimulatedExchange:
         assert self.exchange.best_bid_price(USDJPY_SIM.id) == Price.from_str("1.001")
         assert self.exchange.best_ask_price(USDJPY_SIM.id) == Price.from_str("1.001")
 
+    def test_process_bid_and_ask_bars_updates_market(self):
+        # Arrange
+        bid_bar = TestDataStubs.bar_3decimal()
+        ask_bar = Bar(
+            bar_type=TestDataStubs.bartype_usdjpy_1min_ask(),
+            open=Price.from_str("90.005"),
+            high=Price.from_str("90.007"),
+            low=Price.from_str("90.004"),
+            close=Price.from_str("90.006"),
+            volume=Quantity.from_int(1_000_000),
+            ts_event=0,
+            ts_init=0,
+        )
+
+        # Act
+        self.exchange.process_bar(bid_bar)
+        self.exchange.process_bar(ask_bar)
+
+        # Assert
+        assert self.exchange.best_bid_price(USDJPY_SIM.id) == Price.from_str("90.003")
+        assert self.exchange.best_ask_price(USDJPY_SIM.id) == Price.from_str("90.006")
+
+    def test_process_trade_bar_fills_resting_order_at_bar_low(self):
+        # Arrange
+        bar = Bar(
+            bar_type=BarType(USDJPY_SIM.id, TestDataStubs.bar_spec_1min_last()),
+            open=Price.from_str("90.002"),
+            high=Price.from_str("90.004"),
+            low=Price.from_str("89.990"),
+            close=Price.from_str("90.003"),
+            volume=Quantity.from_int(1_000_000),
+            ts_event=0,
+            ts_init=0,
+        )
+        self.exchange.process_bar(bar)
+
+        order = self.strategy.order_factory.limit(
+            USDJPY_SIM.id,
+            OrderSide.BUY,
+            Quantity.from_int(100000),
+            Price.from_str("89.995"),
+        )
+        self.strategy.submit_order(order)
+        self.exchange.process(0)
+
+        # Act
+        self.exchange.process_bar(bar)
+
+        # Assert
+        assert order.status == OrderStatus.FILLED
+        assert order.avg_px == 89.995
+        assert self.exchange.best_bid_price(USDJPY_SIM.id) == Price.from_str("90.003")
+        assert self.exchange.best_ask_price(USDJPY_SIM.id) == Price.from_str("90.003")
+
+    def test_trade_ids_count_one_open_trade_per_bar(self):
+        # Arrange
+        bar_type = BarType(USDJPY_SIM.id, TestDataStubs.bar_spec_1min_last())
+        bar1 = Bar(
+            bar_type=bar_type,
+            open=Price.from_str("90.002"),
+            high=Price.from_str("90.004"),
+            low=Price.from_str("89.990"),
+            close=Price.from_str("90.003"),
+            volume=Quantity.from_int(1_000_000),
+            ts_event=0,
+            ts_init=0,
+        )
+        bar2 = Bar(
+            bar_type=bar_type,
+            open=Price.from_str("90.003"),  # Same as last close (open trade skipped)
+            high=Price.from_str("90.005"),
+            low=Price.from_str("90.001"),
+            close=Price.from_str("90.002"),
+            volume=Quantity.from_int(1_000_000),
+            ts_event=0,
+            ts_init=0,
+        )
+        bar3 = Bar(
+            bar_type=bar_type,
+            open=Price.from_str("90.002"),  # Same as last close (open trade skipped)
+            high=Price.from_str("90.004"),
+            low=Price.from_str("90.001"),
+            close=Price.from_str("90.003"),
+            volume=Quantity.from_int(1_000_000),
+            ts_event=0,
+            ts_init=0,
+        )
+        self.exchange.process_bar(bar1)
+        self.exchange.process_bar(bar2)
+        self.exchange.process_bar(bar3)
+
+        order = self.strategy.order_factory.market(
+            USDJPY_SIM.id,
+            OrderSide.BUY,
+            Quantity.from_int(100000),
+        )
+
+        # Act
+        self.strategy.submit_order(order)
+        self.exchange.process(0)
+
+        # Assert: four trade IDs counted per bar, then the fill
+        assert order.status == OrderStatus.FILLED
+        assert order.last_trade_id == TradeId("SIM-13")
+
     def test_get_open_orders_when_no_orders_returns_empty_dict(self):
         # Arrange, Act
         orders = self.exchange.get_open_orders()
@@ -1913,6 +2021,39 @@ class TestSimulatedExchange:
         assert entry.status == OrderStatus.ACCEPTED
         assert entry.quantity == 100000
 
+    def test_latency_model_processes_commands_in_arrival_order(self):
+        # Arrange
+        class SlowFirstLatencyModel(LatencyModel):
+            def latency_nanos(self, command):
+                # First order is delayed behind the second
+                return secs_to_nanos(2) if command.order.price == 100 else secs_to_nanos(1)
+
+        self.exchange.set_latency_model(SlowFirstLatencyModel())
+        order1 = self.strategy.order_factory.limit(
+            instrument_id=USDJPY_SIM.id,
+            order_side=OrderSide.BUY,
+            price=Price.from_int(100),
+            quantity=Quantity.from_int(200000),
+        )
+        order2 = self.strategy.order_factory.limit(
+            instrument_id=USDJPY_SIM.id,
+            order_side=OrderSide.BUY,
+            price=Price.from_int(99),
+            quantity=Quantity.from_int(200000),
+        )
+
+        # Act
+        self.strategy.submit_order(order1)
+        self.strategy.submit_order(order2)
+        self.exchange.process(secs_to_nanos(1))
+
+        # Assert
+        assert order1.status == OrderStatus.SUBMITTED
+        assert order2.status == OrderStatus.ACCEPTED
+
+        self.exchange.process(secs_to_nanos(2))
+        assert order1.status == OrderStatus.ACCEPTED
+
 
 XBTUSD_BITMEX = TestInstrumentProvider.xbtusd_bitmex()
 
@@ -0,0 +1,293 @@
+# -------------------------------------------------------------------------------------------------
+#  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+#  https://nautechsystems.io
+#
+#  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+#  You may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+# -------------------------------------------------------------------------------------------------
+
+from datetime import timedelta
+
+from nautilus_trader.backtest.data.providers import TestInstrumentProvider
+from nautilus_trader.backtest.matching_core import OrderMatchingCore
+from nautilus_trader.common.clock import TestClock
+from nautilus_trader.common.factories import OrderFactory
+from nautilus_trader.core.uuid import UUID4
+from nautilus_trader.model.enums import OrderSide
+from nautilus_trader.model.enums import TimeInForce
+from nautilus_trader.model.events.order import OrderUpdated
+from nautilus_trader.model.identifiers import VenueOrderId
+from nautilus_trader.model.objects import Price
+from nautilus_trader.model.objects import Quantity
+from tests.test_kit.stubs import UNIX_EPOCH
+from tests.test_kit.stubs.events import TestEventStubs
+from tests.test_kit.stubs.identifiers import TestIdStubs
+
+
+AUDUSD_SIM = TestInstrumentProvider.default_fx_ccy("AUD/USD")
+
+
+class TestOrderMatchingCore:
+    def setup(self):
+        # Fixture Setup
+        self.order_factory = OrderFactory(
+            trader_id=TestIdStubs.trader_id(),
+            strategy_id=TestIdStubs.strategy_id(),
+            clock=TestClock(),
+        )
+
+        self.core = OrderMatchingCore(AUDUSD_SIM.id)
+
+    def limit(self, side: OrderSide, price: str, **kwargs):
+        return self.order_factory.limit(
+            AUDUSD_SIM.id,
+            side,
+            Quantity.from_int(100000),
+            Price.from_str(price),
+            **kwargs,
+        )
+
+    def stop(self, side: OrderSide, trigger_price: str):
+        return self.order_factory.stop_market(
+            AUDUSD_SIM.id,
+            side,
+            Quantity.from_int(100000),
+            Price.from_str(trigger_price),
+        )
+
+    def modify(self, order, price: str):
+        order.apply(TestEventStubs.order_submitted(order))
+        order.apply(TestEventStubs.order_accepted(order))
+        order.apply(TestEventStubs.order_pending_update(order))
+        order.apply(
+            OrderUpdated(
+                order.trader_id,
+                order.strategy_id,
+                order.account_id,
+                order.instrument_id,
+                order.client_order_id,
+                VenueOrderId("1"),
+                order.quantity,
+                Price.from_str(price),
+                None,
+                UUID4(),
+                0,
+                0,
+            ),
+        )
+
+    def test_instantiate(self):
+        # Arrange, Act, Assert
+        assert self.core.instrument_id == AUDUSD_SIM.id
+        assert self.core.is_empty()
+        assert self.core.orders_bid() == []
+        assert self.core.orders_ask() == []
+        assert repr(self.core) == "OrderMatchingCore(AUD/USD.SIM, orders=0)"
+
+    def test_orders_returned_in_price_then_time_priority(self):
+        # Arrange
+        bid1 = self.limit(OrderSide.BUY, "0.90000")
+        bid2 = self.limit(OrderSide.BUY, "0.90010")
+        bid3 = self.limit(OrderSide.BUY, "0.90000")
+        ask1 = self.limit(OrderSide.SELL, "0.90030")
+        ask2 = self.limit(OrderSide.SELL, "0.90020")
+        stop = self.stop(OrderSide.SELL, "0.90025")
+
+        # Act
+        for order in (bid1, bid2, bid3, ask1, ask2, stop):
+            self.core.add_order(order)
+
+        # Assert
+        assert not self.core.is_empty()
+        assert self.core.orders_bid() == [bid2, bid1, bid3]
+        assert self.core.orders_ask() == [ask2, stop, ask1]
+
+    def test_delete_order_removes_order(self):
+        # Arrange
+        bid1 = self.limit(OrderSide.BUY, "0.90000")
+        bid2 = self.limit(OrderSide.BUY, "0.90000")
+        self.core.add_order(bid1)
+        self.core.add_order(bid2)
+
+        # Act
+        self.core.delete_order(bid1)
+        self.core.delete_order(bid1)  # Not resting (does nothing)
+
+        # Assert
+        assert self.core.orders_bid() == [bid2]
+
+    def test_update_order_keeps_time_priority(self):
+        # Arrange
+        bid1 = self.limit(OrderSide.BUY, "0.90000")
+        bid2 = self.limit(OrderSide.BUY, "0.90010")
+        bid3 = self.limit(OrderSide.BUY, "0.90000")
+        for order in (bid1, bid2, bid3):
+            self.core.add_order(order)
+        self.modify(bid2, "0.90000")
+
+        # Act
+        self.core.update_order(bid2)
+
+        # Assert
+        assert self.core.orders_bid() == [bid1, bid2, bid3]
+
+    def test_update_order_when_not_resting_does_nothing(self):
+        # Arrange
+        bid = self.limit(OrderSide.BUY, "0.90000")
+
+        # Act
+        self.core.update_order(bid)
+
+        # Assert
+        assert self.core.is_empty()
+
+    def test_iterate_returns_only_matchable_and_triggerable_orders(self):
+        # Arrange
+        bid_matched = self.limit(OrderSide.BUY, "0.90020")
+        bid_at_market = self.limit(OrderSide.BUY, "0.90010")
+        bid_resting = self.limit(OrderSide.BUY, "0.90000")
+        buy_stop_triggered = self.stop(OrderSide.BUY, "0.90005")
+        buy_stop_resting = self.stop(OrderSide.BUY, "0.90050")
+        ask_resting = self.limit(OrderSide.SELL, "0.90030")
+        sell_stop_triggered = self.stop(OrderSide.SELL, "0.90010")
+        sell_stop_resting = self.stop(OrderSide.SELL, "0.89000")
+
+        for order in (
+            bid_matched,
+            bid_at_market,
+            bid_resting,
+            buy_stop_triggered,
+            buy_stop_resting,
+            ask_resting,
+            sell_stop_triggered,
+            sell_stop_resting,
+        ):
+            self.core.add_order(order)
+
+        # Act
+        result = self.core.iterate(Price.from_str("0.90005"), Price.from_str("0.90010"), 0)
+
+        # Assert
+        assert result == [bid_matched, bid_at_market, buy_stop_triggered, sell_stop_triggered]
+
+    def test_iterate_with_no_market_returns_no_orders(self):
+        # Arrange
+        self.core.add_order(self.limit(OrderSide.BUY, "0.90020"))
+        self.core.add_order(self.limit(OrderSide.SELL, "0.90000"))
+
+        # Act
+        result = self.core.iterate(None, None, 0)
+
+        # Assert
+        assert result == []
+
+    def test_iterate_includes_expired_orders_in_priority_order(self):
+        # Arrange
+        expire_time = UNIX_EPOCH + timedelta(minutes=1)
+        bid1 = self.limit(OrderSide.BUY, "0.90000")
+        bid2 = self.limit(
+            OrderSide.BUY,
+            "0.89000",
+            time_in_force=TimeInForce.GTD,
+            expire_time=expire_time,
+        )
+        bid3 = self.limit(OrderSide.BUY, "0.90020")
+        self.core.add_order(bid1)
+        self.core.add_order(bid2)
+        self.core.add_order(bid3)
+
+        # Act
+        result1 = self.core.iterate(Price.from_str("0.90005"), Price.from_str("0.90010"), 0)
+        result2 = self.core.iterate(
+            Price.from_str("0.90005"),
+            Price.from_str("0.90010"),
+            int(expire_time.timestamp() * 1e9),
+        )
+
+        # Assert
+        assert result1 == [bid3]
+        assert result2 == [bid3, bid2]
+
+    def test_iterate_does_not_return_expired_order_after_delete(self):
+        # Arrange
+        expire_time = UNIX_EPOCH + timedelta(minutes=1)
+        order = self.limit(
+            OrderSide.BUY,
+            "0.89000",
+            time_in_force=TimeInForce.GTD,
+            expire_time=expire_time,
+        )
+        self.core.add_order(order)
+        self.core.delete_order(order)
+
+        # Act
+        result = self.core.iterate(
+            Price.from_str("0.90005"),
+            Price.from_str("0.90010"),
+            int(expire_time.timestamp() * 1e9),
+        )
+
+        # Assert
+        assert result == []
+        assert self.core.is_empty()
+
+    def test_iterate_returns_expired_order_after_update(self):
+        # Arrange
+        expire_time = UNIX_EPOCH + timedelta(minutes=1)
+        order = self.limit(
+            OrderSide.BUY,
+            "0.89000",
+            time_in_force=TimeInForce.GTD,
+            expire_time=expire_time,
+        )
+        self.core.add_order(order)
+        self.modify(order, "0.89010")
+        self.core.update_order(order)
+
+        # Act
+        result = self.core.iterate(
+            Price.from_str("0.90005"),
+            Price.from_str("0.90010"),
+            int(expire_time.timestamp() * 1e9),
+        )
+
+        # Assert
+        assert result == [order]
+
+    def test_delete_far_future_expiring_orders_then_iterate_expires_remaining_order(self):
+        # Arrange
+        near_time = UNIX_EPOCH + timedelta(minutes=1)
+        near = self.limit(
+            OrderSide.BUY,
+            "0.89000",
+            time_in_force=TimeInForce.GTD,
+            expire_time=near_time,
+        )
+        self.core.add_order(near)
+        for i in range(100):
+            far = self.limit(
+                OrderSide.BUY,
+                "0.89000",
+                time_in_force=TimeInForce.GTD,
+                expire_time=UNIX_EPOCH + timedelta(days=1, minutes=i),
+            )
+            self.core.add_order(far)
+            self.core.delete_order(far)  # Compacts the expiry heap once stale entries dominate
+
+        # Act
+        result = self.core.iterate(
+            Price.from_str("0.90005"),
+            Price.from_str("0.90010"),
+            int((UNIX_EPOCH + timedelta(days=2)).timestamp() * 1e9),
+        )
+
+        # Assert
+        assert result == [near]
+        assert self.core.orders_bid() == [near]
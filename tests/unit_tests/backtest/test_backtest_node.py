@@ -16,6 +16,8 @@
 import json
 from decimal import Decimal
 
+import pyarrow as pa
+
 from nautilus_trader.backtest.engine import BacktestEngineConfig
 from nautilus_trader.backtest.node import BacktestNode
 from nautilus_trader.config import BacktestDataConfig
@@ -24,6 +26,7 @@ from nautilus_trader.config import BacktestVenueConfig
 from nautilus_trader.config import ImportableStrategyConfig
 from nautilus_trader.model.data.tick import QuoteTick
 from nautilus_trader.persistence.funcs import parse_bytes
+from nautilus_trader.persistence.funcs import tokenize
 from tests.test_kit.mocks.data import aud_usd_data_loader
 from tests.test_kit.mocks.data import data_catalog_setup
 
@@ -84,6 +87,44 @@ class TestBacktestNode:
         # Assert
         assert len(results) == 1
 
+    def test_run_with_workers(self, tmp_path, monkeypatch):
+        # Arrange
+        monkeypatch.setenv("NAUTILUS_PATH", str(tmp_path))
+        (tmp_path / "catalog" / "data").mkdir(parents=True)
+        aud_usd_data_loader()  # Spawned workers cannot read the in-memory catalog
+        data_config = self.data_config.replace(
+            catalog_path=str(tmp_path / "catalog"),
+            catalog_fs_protocol="file",
+        )
+        configs = [self.backtest_configs[0].replace(data=[data_config])] * 2
+        node = BacktestNode(configs=configs)
+        expected = BacktestNode(configs=configs[:1]).run()[0]
+
+        # Act
+        results = node.run(workers=2)
+
+        # Assert
+        assert len(results) == 2
+        assert [r.run_config_id for r in results] == [c.id for c in configs]
+        assert results[0].total_orders == expected.total_orders
+        assert results[1].total_orders == expected.total_orders
+        assert node.get_engines() == []
+
+    def test_write_shared_tables_decodes_each_dataset_once(self, tmp_path):
+        # Arrange
+        node = BacktestNode(configs=self.backtest_configs * 2)
+
+        # Act
+        shared_tables = node._write_shared_tables(str(tmp_path))
+
+        # Assert
+        assert list(shared_tables) == [tokenize(self.data_config)]
+        with pa.memory_map(shared_tables[tokenize(self.data_config)]) as source:
+            table = pa.ipc.open_file(source).read_all()
+        assert table.num_rows > 0
+        assert table.schema.field("bid").type == pa.int64()
+        assert table.schema.field("ts_init").type == pa.uint64()
+
     def test_backtest_run_streaming_sync(self):
         # Arrange
         config = BacktestRunConfig(
@@ -0,0 +1,112 @@
+# -------------------------------------------------------------------------------------------------
+#  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+#  https://nautechsystems.io
+#
+#  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+#  You may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+# -------------------------------------------------------------------------------------------------
+
+import pytest
+
+from nautilus_trader.backtest.profiler import BacktestProfiler
+
+
+class TestBacktestProfiler:
+    def setup(self):
+        # Fixture Setup
+        self.profiler = BacktestProfiler()
+
+    def test_instantiate(self):
+        # Arrange, Act, Assert
+        assert self.profiler.wall_ns == 0
+        assert self.profiler.cpu_ns == 0
+        assert self.profiler.breakdown() == {
+            "other": {"wall_secs": 0.0, "cpu_secs": 0.0, "wall_pct": 0.0, "calls": 0},
+        }
+
+    def test_exit_with_no_stage_raises_index_error(self):
+        # Arrange, Act, Assert
+        with pytest.raises(IndexError):
+            self.profiler.exit()
+
+    def test_nested_stages_are_accounted_separately(self):
+        # Arrange
+        self.profiler.start()
+
+        # Act
+        self.profiler.enter("outer")
+        self.profiler.enter("inner")
+        self.profiler.exit()
+        self.profiler.enter("inner")
+        self.profiler.exit()
+        self.profiler.exit()
+        self.profiler.stop()
+
+        breakdown = self.profiler.breakdown()
+
+        # Assert
+        assert self.profiler.wall_ns > 0
+        assert list(breakdown.keys())[-1] == "other"
+        assert breakdown["outer"]["calls"] == 1
+        assert breakdown["inner"]["calls"] == 2
+        assert breakdown["outer"]["wall_secs"] >= 0.0
+        assert breakdown["inner"]["wall_secs"] >= 0.0
+        assert (
+            breakdown["outer"]["wall_secs"]
+            + breakdown["inner"]["wall_secs"]
+            + breakdown["other"]["wall_secs"]
+        ) == pytest.approx(self.profiler.wall_ns / 1e9)
+
+    def test_wrap_handler_profiles_calls(self):
+        # Arrange
+        received = []
+        handler = self.profiler.wrap("handler", received.append)
+
+        # Act
+        self.profiler.start()
+        handler("msg1")
+        handler("msg2")
+        self.profiler.stop()
+
+        # Assert
+        assert handler.handler == received.append
+        assert received == ["msg1", "msg2"]
+        assert self.profiler.breakdown()["handler"]["calls"] == 2
+
+    def test_wrap_handler_when_handler_raises_exits_stage(self):
+        # Arrange
+        def raise_error(msg):
+            raise RuntimeError(msg)
+
+        handler = self.profiler.wrap("handler", raise_error)
+
+        # Act
+        with pytest.raises(RuntimeError):
+            handler("msg")
+
+        # Assert
+        assert self.profiler.breakdown()["handler"]["calls"] == 1
+        with pytest.raises(IndexError):
+            self.profiler.exit()  # No stage left open
+
+    def test_reset(self):
+        # Arrange
+        self.profiler.start()
+        self.profiler.enter("stage")
+        self.profiler.exit()
+        self.profiler.stop()
+
+        # Act
+        self.profiler.reset()
+
+        # Assert
+        assert self.profiler.wall_ns == 0
+        assert self.profiler.cpu_ns == 0
+        assert list(self.profiler.breakdown().keys()) == ["other"]
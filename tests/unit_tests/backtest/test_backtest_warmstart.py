@@ -0,0 +1,152 @@
+# -------------------------------------------------------------------------------------------------
+#  Copyright (C) 2015-2022 Nautech Systems Pty Ltd. All rights reserved.
+#  https://nautechsystems.io
+#
+#  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+#  You may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+# -------------------------------------------------------------------------------------------------
+
+import os
+from decimal import Decimal
+
+import pytest
+
+from nautilus_trader.backtest.engine import BacktestEngineConfig
+from nautilus_trader.backtest.warmstart import WarmStartBacktest
+from nautilus_trader.config import BacktestDataConfig
+from nautilus_trader.config import BacktestRunConfig
+from nautilus_trader.config import BacktestVenueConfig
+from nautilus_trader.config import ImportableStrategyConfig
+from nautilus_trader.config import StrategyFactory
+from nautilus_trader.model.data.tick import QuoteTick
+from nautilus_trader.persistence.funcs import parse_bytes
+from tests.test_kit.mocks.data import aud_usd_data_loader
+from tests.test_kit.mocks.data import data_catalog_setup
+
+
+class TestWarmStartBacktest:
+    def setup(self):
+        self.catalog = data_catalog_setup()
+        self.venue_config = BacktestVenueConfig(
+            name="SIM",
+            oms_type="HEDGING",
+            account_type="MARGIN",
+            base_currency="USD",
+            starting_balances=["1000000 USD"],
+        )
+        self.data_config = BacktestDataConfig(
+            catalog_path="/.nautilus/catalog",
+            catalog_fs_protocol="memory",
+            data_cls=QuoteTick,
+            instrument_id="AUD/USD.SIM",
+            start_time=1580398089820000000,
+            end_time=1580504394501000000,
+        )
+        self.strategy_config = ImportableStrategyConfig(
+            strategy_path="nautilus_trader.examples.strategies.ema_cross:EMACross",
+            config_path="nautilus_trader.examples.strategies.ema_cross:EMACrossConfig",
+            config=dict(
+                instrument_id="AUD/USD.SIM",
+                bar_type="AUD/USD.SIM-100-TICK-MID-INTERNAL",
+                fast_ema_period=10,
+                slow_ema_period=20,
+                trade_size=Decimal(1_000_000),
+                order_id_tag="001",
+            ),
+        )
+        aud_usd_data_loader()  # Load sample data
+
+    def test_run_trials_from_unstarted_engine(self):
+        # Arrange
+        config = BacktestRunConfig(
+            engine=BacktestEngineConfig(),
+            venues=[self.venue_config],
+            data=[self.data_config],
+        )
+        warm = WarmStartBacktest(config=config)
+
+        def add_strategy(engine):
+            engine.add_strategy(StrategyFactory.create(self.strategy_config))
+
+        # Act
+        result1 = warm.run_trial(add_strategy)
+        result2 = warm.run_trial(add_strategy)
+
+        # Assert
+        assert result1.iterations > 0
+        assert result1.iterations == result2.iterations
+        assert result1.total_orders == result2.total_orders
+        assert warm.engine.iteration == 0  # <-- Parent engine was not run
+        assert warm.engine.trader.strategy_states() == {}
+
+    def test_run_trial_from_warm_start_time(self):
+        # Arrange
+        config = BacktestRunConfig(
+            engine=BacktestEngineConfig(strategies=[self.strategy_config]),
+            venues=[self.venue_config],
+            data=[self.data_config],
+        )
+        warm = WarmStartBacktest(config=config, warmup_end=1580450000000000000)
+        warmup_iterations = warm.engine.iteration
+
+        # Act
+        result = warm.run_trial()
+
+        # Assert
+        assert warmup_iterations > 0
+        assert result.iterations > warmup_iterations
+        assert warm.engine.iteration == warmup_iterations
+
+    def test_trial_exception_raises_runtime_error(self):
+        # Arrange
+        config = BacktestRunConfig(
+            engine=BacktestEngineConfig(),
+            venues=[self.venue_config],
+            data=[self.data_config],
+        )
+        warm = WarmStartBacktest(config=config)
+
+        def fail(engine):
+            raise ValueError("bad trial")
+
+        # Act, Assert
+        with pytest.raises(RuntimeError):
+            warm.run_trial(fail)
+
+    def test_trial_interrupt_raises_runtime_error_in_parent(self):
+        # Arrange
+        config = BacktestRunConfig(
+            engine=BacktestEngineConfig(),
+            venues=[self.venue_config],
+            data=[self.data_config],
+        )
+        warm = WarmStartBacktest(config=config)
+        pid = os.getpid()
+
+        def interrupt(engine):
+            raise KeyboardInterrupt()
+
+        # Act, Assert
+        with pytest.raises(RuntimeError):
+            warm.run_trial(interrupt)
+        assert os.getpid() == pid  # Child exited rather than unwinding into this test
+
+    def test_streaming_config_raises_value_error(self):
+        # Arrange
+        config = BacktestRunConfig(
+            engine=BacktestEngineConfig(),
+            venues=[self.venue_config],
+            data=[self.data_config],
+            batch_size_bytes=parse_bytes("10kib"),
+        )
+
+        # Act, Assert
+        with pytest.raises(ValueError):
+            WarmStartBacktest(config=config)
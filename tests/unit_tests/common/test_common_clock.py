@@ -14,17 +14,21 @@
 # -------------------------------------------------------------------------------------------------
 
 import asyncio
+import threading
 import time
 from datetime import datetime
 from datetime import timedelta
 
+import pandas as pd
 import pytest
 import pytz
 
 from nautilus_trader.common.clock import LiveClock
 from nautilus_trader.common.clock import TestClock
+from nautilus_trader.common.clock import TimeEventScheduler
 from nautilus_trader.common.timer import TimeEvent
 from nautilus_trader.common.timer import TimeEventHandler
+from nautilus_trader.common.timer import TimerWheel
 from nautilus_trader.core.datetime import millis_to_nanos
 from tests.test_kit.stubs import UNIX_EPOCH
 
@@ -562,6 +566,218 @@ class TestTestClock:
         assert clock.timer("TEST_TIMER2").name == "TEST_TIMER2"
         assert clock.timer_count == 2
 
+    def test_advance_time_with_many_timers_returns_events_in_order(self):
+        # Arrange
+        clock = TestClock()
+        handler = []
+        for i in range(1, 11):
+            clock.set_timer_ns(
+                name=f"TIMER-{i}",
+                interval_ns=i,
+                start_time_ns=0,
+                stop_time_ns=1_000,
+                callback=handler.append,
+            )
+        clock.cancel_timer("TIMER-1")
+
+        # Act
+        event_handlers = clock.advance_time(20)
+
+        # Assert
+        timestamps = [e.event.ts_event for e in event_handlers]
+        assert timestamps == sorted(timestamps)
+        assert len(event_handlers) == sum(20 // i for i in range(2, 11))
+        assert all(e.event.name != "TIMER-1" for e in event_handlers)
+        # Ties are in timer insertion order
+        assert [e.event.name for e in event_handlers if e.event.ts_event == 6] == [
+            "TIMER-2",
+            "TIMER-3",
+            "TIMER-6",
+        ]
+        assert clock.next_event_time_ns == 21
+        assert clock.timer_count == 9
+
+    def test_cancel_far_future_timers_then_advance_fires_remaining_timer(self):
+        # Arrange
+        clock = TestClock()
+        handler = []
+        clock.set_time_alert_ns("NEAR", 10, handler.append)
+        for i in range(100):
+            clock.set_time_alert_ns(f"FAR-{i}", 1_000_000 + i, handler.append)
+            clock.cancel_timer(f"FAR-{i}")
+
+        # Act
+        event_handlers = clock.advance_time(2_000_000)
+
+        # Assert
+        assert [e.event.name for e in event_handlers] == ["NEAR"]
+        assert clock.timer_count == 0
+        assert clock.next_event_time_ns == 0
+
+
+class TestTimeEventScheduler:
+    def test_register_clock_reads_time_from_scheduler(self):
+        # Arrange
+        scheduler = TimeEventScheduler()
+        clock = TestClock()
+
+        # Act
+        scheduler.register_clock(clock)
+        scheduler.set_time(1_000)
+
+        # Assert
+        assert scheduler.time_ns == 1_000
+        assert clock.timestamp_ns() == 1_000
+        assert clock.utc_now() == pd.Timestamp(1_000, tz="UTC")
+
+    def test_register_clock_with_existing_timers_schedules_timers(self):
+        # Arrange
+        scheduler = TimeEventScheduler()
+        clock = TestClock()
+        handler = []
+        clock.set_time_alert_ns("ALERT", 100, callback=handler.append)
+
+        # Act
+        scheduler.register_clock(clock)
+        scheduler.register_clock(clock)  # Idempotent
+        event_handlers = scheduler.advance_time(200)
+
+        # Assert
+        assert [e.event.name for e in event_handlers] == ["ALERT"]
+        assert clock.timer_count == 0
+        assert clock.next_event_time_ns == 0
+        assert clock.timestamp_ns() == 200
+
+    def test_register_clock_with_another_scheduler_raises_value_error(self):
+        # Arrange
+        clock = TestClock()
+        TimeEventScheduler().register_clock(clock)
+
+        # Act, Assert
+        with pytest.raises(ValueError):
+            TimeEventScheduler().register_clock(clock)
+
+    def test_advance_time_given_time_in_past_raises_value_error(self):
+        # Arrange
+        scheduler = TimeEventScheduler(initial_ns=100)
+
+        # Act, Assert
+        with pytest.raises(ValueError):
+            scheduler.advance_time(99)
+
+    def test_advance_time_returns_events_across_clocks_in_order(self):
+        # Arrange
+        scheduler = TimeEventScheduler()
+        clock1 = TestClock()
+        clock2 = TestClock()
+        scheduler.register_clock(clock1)
+        scheduler.register_clock(clock2)
+        handler1 = []
+        handler2 = []
+        clock1.set_timer_ns("TIMER", 20, 0, 1_000, callback=handler1.append)
+        clock2.set_timer_ns("TIMER", 30, 0, 60, callback=handler2.append)
+        clock1.set_time_alert_ns("ALERT", 50, callback=handler1.append)
+
+        # Act
+        event_handlers = scheduler.advance_time(100)
+        for event_handler in event_handlers:
+            event_handler.handle()
+
+        # Assert
+        assert [(e.event.name, e.event.ts_event) for e in event_handlers] == [
+            ("TIMER", 20),
+            ("TIMER", 30),
+            ("TIMER", 40),
+            ("ALERT", 50),
+            ("TIMER", 60),
+            ("TIMER", 60),
+            ("TIMER", 80),
+            ("TIMER", 100),
+        ]
+        assert len(handler1) == 6
+        assert len(handler2) == 2
+        assert clock1.timer_names() == ["TIMER"]
+        assert clock1.next_event_time_ns == 120
+        assert clock2.timer_count == 0
+        assert clock2.next_event_time_ns == 0
+
+    def test_advance_time_returns_coalesced_events_in_order_timers_were_set(self):
+        # Arrange
+        scheduler = TimeEventScheduler()
+        clock1 = TestClock()
+        clock2 = TestClock()
+        scheduler.register_clock(clock1)
+        scheduler.register_clock(clock2)
+        handler = []
+        clock2.set_timer_ns("TIMER-1", 10, 0, 30, callback=handler.append)
+        clock1.set_timer_ns("TIMER-2", 10, 0, 30, callback=handler.append)
+        clock2.set_timer_ns("TIMER-3", 10, 0, 30, callback=handler.append)
+
+        # Act
+        event_handlers = scheduler.advance_time(30)
+
+        # Assert
+        assert [e.event.name for e in event_handlers] == [
+            "TIMER-1",
+            "TIMER-2",
+            "TIMER-3",
+        ] * 3
+
+    def test_advance_time_with_identical_timers_fans_out_to_all_clocks(self):
+        # Arrange
+        scheduler = TimeEventScheduler()
+        clocks = [TestClock() for _ in range(40)]
+        handler = []
+        for clock in clocks:
+            scheduler.register_clock(clock)
+            clock.set_timer_ns("HEARTBEAT", 60, 0, 1_000, callback=handler.append)
+
+        # Act
+        event_handlers = scheduler.advance_time(120)
+        for event_handler in event_handlers:
+            event_handler.handle()
+
+        # Assert
+        assert [e.ts_event for e in event_handlers] == [60] * 40 + [120] * 40
+        assert len(handler) == 80
+        assert all(clock.next_event_time_ns == 180 for clock in clocks)
+
+    def test_advance_time_with_no_timer_due_returns_empty_list(self):
+        # Arrange
+        scheduler = TimeEventScheduler()
+        clock = TestClock()
+        scheduler.register_clock(clock)
+        clock.set_timer_ns("TIMER", 100, 0, 1_000, callback=[].append)
+
+        # Act
+        event_handlers = clock.advance_time(99)
+
+        # Assert
+        assert event_handlers == []
+        assert scheduler.time_ns == 99
+        assert clock.next_event_time_ns == 100
+
+    def test_cancel_and_replace_timer_on_registered_clock(self):
+        # Arrange
+        scheduler = TimeEventScheduler()
+        clock = TestClock()
+        scheduler.register_clock(clock)
+        handler = []
+        clock.set_timer_ns("TIMER1", 10, 0, 1_000, callback=handler.append)
+        clock.set_timer_ns("TIMER2", 10, 0, 1_000, callback=handler.append)
+        clock.cancel_timer("TIMER1")
+        clock.set_timer_ns("TIMER2", 15, 0, 1_000, callback=handler.append)
+
+        # Act
+        event_handlers = scheduler.advance_time(30)
+
+        # Assert
+        assert [(e.event.name, e.event.ts_event) for e in event_handlers] == [
+            ("TIMER2", 15),
+            ("TIMER2", 30),
+        ]
+        assert clock.next_event_time_ns == 45
+
 
 class TestLiveClockWithThreadTimer:
     def setup(self):
@@ -850,6 +1066,94 @@ class TestLiveClockWithThreadTimer:
         assert len(self.handler) >= 8
 
 
+class TestLiveClockWithTimerWheel:
+    def setup(self):
+        # Fixture Setup
+        self.wheel = TimerWheel()
+        self.handler = []
+        self.clock = LiveClock(wheel=self.wheel)
+        self.clock.register_default_handler(self.handler.append)
+
+    def teardown(self):
+        self.clock.cancel_timers()
+        self.wheel.shutdown()
+
+    def test_many_time_alerts_fire_from_single_thread(self):
+        # Arrange
+        alert_time = self.clock.utc_now() + timedelta(milliseconds=100)
+        thread_count = threading.active_count()
+
+        # Act
+        for i in range(500):
+            self.clock.set_time_alert(f"TEST_ALERT{i}", alert_time)
+        threads_while_pending = threading.active_count()
+        time.sleep(0.5)
+
+        # Assert
+        assert threads_while_pending == thread_count
+        assert len(self.handler) == 500
+        assert all(isinstance(event, TimeEvent) for event in self.handler)
+        assert self.clock.timer_names() == []
+        assert self.wheel.timer_count == 0
+
+    def test_cancel_timer_removes_timer_from_wheel(self):
+        # Arrange
+        self.clock.set_timer(
+            name="TEST_TIMER",
+            interval=timedelta(milliseconds=100),
+            start_time=None,
+            stop_time=None,
+        )
+
+        # Act
+        self.clock.cancel_timer("TEST_TIMER")
+        time.sleep(0.3)
+
+        # Assert
+        assert self.handler == []
+        assert self.wheel.timer_count == 0
+
+    def test_repeating_timer_fires_on_interval(self):
+        # Arrange
+        self.clock.set_timer(
+            name="TEST_TIMER",
+            interval=timedelta(milliseconds=50),
+            start_time=None,
+            stop_time=None,
+        )
+
+        # Act
+        time.sleep(0.5)
+        self.clock.cancel_timer("TEST_TIMER")
+
+        # Assert
+        assert len(self.handler) >= 5
+        timestamps = [event.ts_event for event in self.handler]
+        assert timestamps == sorted(timestamps)
+        assert all(b - a == 50_000_000 for a, b in zip(timestamps, timestamps[1:]))
+
+    @pytest.mark.asyncio
+    async def test_time_alerts_post_to_event_loop(self):
+        # Arrange
+        loop = asyncio.get_event_loop()
+        clock = LiveClock(loop=loop, wheel=self.wheel)
+        handler = []
+        alert_time = clock.utc_now() + timedelta(milliseconds=100)
+
+        # Act
+        for i in range(10):
+            clock.set_time_alert(
+                f"TEST_ALERT{i}",
+                alert_time,
+                callback=lambda e: handler.append(threading.current_thread()),
+            )
+        await asyncio.sleep(0.5)
+
+        # Assert
+        assert handler == [threading.current_thread()] * 10
+        assert clock.timer_names() == []
+
+
 class TestLiveClockWithLoopTimer:
     def setup(self):
         # Fixture Setup
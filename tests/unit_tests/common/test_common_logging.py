@@ -14,6 +14,7 @@
 # -------------------------------------------------------------------------------------------------
 
 import asyncio
+import json
 import socket
 
 import pytest
@@ -22,6 +23,7 @@ from nautilus_trader.common.clock import LiveClock
 from nautilus_trader.common.clock import TestClock
 from nautilus_trader.common.logging import LiveLogger
 from nautilus_trader.common.logging import LogColor
+from nautilus_trader.common.logging import LogFileFormat
 from nautilus_trader.common.logging import Logger
 from nautilus_trader.common.logging import LoggerAdapter
 from nautilus_trader.common.logging import LogLevel
@@ -171,6 +173,64 @@ class TestLoggerTests:
         # Assert
         assert True  # No exceptions raised
 
+    def test_log_messages_with_async_logger_then_flush(self):
+        # Arrange
+        logger = Logger(clock=TestClock(), level_stdout=LogLevel.INFO, is_async=True)
+        logger_adapter = LoggerAdapter(component_name="TEST_LOGGER", logger=logger)
+
+        # Act
+        logger_adapter.info("This is a log message.")
+        logger_adapter.error("This is an error message.")
+        logger.flush()
+
+        # Assert
+        assert logger.is_async
+
+    def test_is_enabled_with_component_level_overrides(self):
+        # Arrange
+        logger = Logger(clock=TestClock(), level_stdout=LogLevel.INFO)
+        logger.set_component_level("DATA_ENGINE", LogLevel.DEBUG)
+        logger.set_component_level("RISK_ENGINE", LogLevel.WARNING)
+        adapter1 = LoggerAdapter(component_name="DATA_ENGINE", logger=logger)
+        adapter2 = LoggerAdapter(component_name="RISK_ENGINE", logger=logger)
+        adapter3 = LoggerAdapter(component_name="EXEC_ENGINE", logger=logger)
+
+        # Act, Assert
+        assert adapter1.is_enabled(LogLevel.DEBUG)
+        assert not adapter2.is_enabled(LogLevel.INFO)
+        assert adapter2.is_enabled(LogLevel.ERROR)
+        assert not adapter3.is_enabled(LogLevel.DEBUG)
+        assert adapter3.is_enabled(LogLevel.INFO)
+
+    def test_is_enabled_when_bypassed_returns_false(self):
+        # Arrange
+        logger = Logger(clock=TestClock(), bypass=True)
+        logger_adapter = LoggerAdapter(component_name="TEST_LOGGER", logger=logger)
+
+        # Act, Assert
+        assert not logger_adapter.is_enabled(LogLevel.ERROR)
+
+    def test_add_file_sink_writes_records_below_stdout_level(self, tmp_path):
+        # Arrange
+        logger = Logger(clock=TestClock(), level_stdout=LogLevel.ERROR)
+        logger.add_file_sink(str(tmp_path), fmt=LogFileFormat.JSON)
+        logger_adapter = LoggerAdapter(component_name="TEST_LOGGER", logger=logger)
+
+        # Act
+        logger_adapter.debug("This is a log message.")
+        logger.flush()
+
+        # Assert
+        lines = (tmp_path / "nautilus_0000.jsonl").read_text().splitlines()
+        assert [json.loads(line) for line in lines] == [
+            {
+                "ts": 0,
+                "level": "DBG",
+                "component": "TEST_LOGGER",
+                "msg": "This is a log message.",
+            },
+        ]
+
     def test_register_sink_sends_records_to_sink(self):
         # Arrange
         sink = []
@@ -13,7 +13,7 @@
 #  limitations under the License.
 # -------------------------------------------------------------------------------------------------
 
-
+from nautilus_trader.common.clock import TestClock
 from nautilus_trader.common.timer import TimeEvent
 from nautilus_trader.common.timer import TimeEventHandler
 from nautilus_trader.common.timer import Timer
@@ -93,6 +93,56 @@ class TestTimeEventHandler:
         # Assert
         assert result == [event1, event2, event3]
 
+    def test_handler_from_clock_creates_event_on_access(self):
+        # Arrange
+        receiver = []
+        clock = TestClock()
+        clock.set_time_alert_ns("ALERT", 1_000, callback=receiver.append)
+        handler = clock.advance_time(2_000)[0]
+
+        # Act
+        event = handler.event
+
+        # Assert
+        assert handler.ts_event == 1_000
+        assert handler.event is event
+        assert event.name == "ALERT"
+        assert event.ts_event == 1_000
+        assert event.ts_init == 1_000
+        assert isinstance(event.id, UUID4)
+        assert event.id == event.id  # ID is stable once created
+
+    def test_event_id_from_clock_is_generated_once_when_read(self):
+        # Arrange
+        receiver = []
+        clock = TestClock()
+        clock.set_time_alert_ns("ALERT1", 1_000, callback=receiver.append)
+        clock.set_time_alert_ns("ALERT2", 1_000, callback=receiver.append)
+        handler1, handler2 = clock.advance_time(2_000)
+
+        # Act
+        value = handler1.event.id.value
+
+        # Assert
+        assert handler1.event.id.value == value
+        assert UUID4(value) == handler1.event.id
+        assert hash(handler1.event.id) == hash(UUID4(value))
+        assert handler2.event.id != handler1.event.id
+
+    def test_handle_passes_event_to_handler(self):
+        # Arrange
+        receiver = []
+        clock = TestClock()
+        clock.set_time_alert_ns("ALERT", 1_000, callback=receiver.append)
+        handler = clock.advance_time(2_000)[0]
+
+        # Act
+        handler.handle()
+
+        # Assert
+        assert receiver == [handler.event]
+        assert receiver[0].id == handler.event.id
+
 
 class TestTimer:
     def test_equality(self):
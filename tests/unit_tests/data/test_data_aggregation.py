@@ -15,6 +15,7 @@
 
 from decimal import Decimal
 
+import numpy as np
 import pandas as pd
 import pytest
 
@@ -485,6 +486,50 @@ class TestTickBarAggregator:
         assert last_bar.close == Price.from_str("425.15")
         assert last_bar.volume == Quantity.from_int(3142)
 
+    def test_handle_batch_results_in_same_bars_as_single_ticks(self):
+        # Arrange
+        bar_store_single = ObjectStorer()
+        bar_store_batch = ObjectStorer()
+        instrument = ETHUSDT_BITMEX
+        bar_spec = BarSpecification(1000, BarAggregation.TICK, PriceType.LAST)
+        bar_type = BarType(instrument.id, bar_spec)
+        aggregator_single = TickBarAggregator(
+            instrument,
+            bar_type,
+            bar_store_single.store,
+            Logger(TestClock()),
+        )
+        aggregator_batch = TickBarAggregator(
+            instrument,
+            bar_type,
+            bar_store_batch.store,
+            Logger(TestClock()),
+        )
+
+        wrangler = TradeTickDataWrangler(instrument=ETHUSDT_BITMEX)
+        provider = TestDataProvider()
+        ticks = wrangler.process(provider.read_csv_ticks("binance-ethusdt-trades.csv")[:10000])
+
+        prices = np.asarray([int(t.price * 10**9) for t in ticks], dtype=np.int64)
+        sizes = np.asarray([int(t.size * 10**9) for t in ticks], dtype=np.uint64)
+        ts_events = np.asarray([t.ts_event for t in ticks], dtype=np.uint64)
+
+        # Act
+        for tick in ticks:
+            aggregator_single.handle_trade_tick(tick)
+
+        aggregator_batch.handle_batch(
+            prices,
+            instrument.price_precision,
+            sizes,
+            instrument.size_precision,
+            ts_events,
+        )
+
+        # Assert
+        assert len(bar_store_batch.get_store()) == 10
+        assert bar_store_batch.get_store() == bar_store_single.get_store()
+
 
 class TestVolumeBarAggregator:
     def test_handle_quote_tick_when_volume_below_threshold_updates(self):
@@ -19,6 +19,8 @@ import pytest
 
 from nautilus_trader.backtest.data.providers import TestInstrumentProvider
 from nautilus_trader.indicators.atr import AverageTrueRange
+from nautilus_trader.indicators.average.hma import HullMovingAverage
+from nautilus_trader.indicators.average.moving_average import MovingAverageType
 from tests.test_kit.stubs.data import TestDataStubs
 
 
@@ -39,6 +41,21 @@ class TestAverageTrueRange:
         assert str(self.atr) == "AverageTrueRange(10, SIMPLE, True, 0.0)"
         assert repr(self.atr) == "AverageTrueRange(10, SIMPLE, True, 0.0)"
 
+    def test_hull_ma_type_falls_back_to_python_moving_average(self):
+        # Arrange
+        atr = AverageTrueRange(10, MovingAverageType.HULL, use_previous=False)
+        hma = HullMovingAverage(10)
+
+        # Act
+        for i in range(20):
+            high = 1.00010 + i * 0.00001
+            atr.update_raw(high, 1.00000, 1.00005)
+            hma.update_raw(high - 1.00000)
+
+        # Assert
+        assert atr.initialized is True
+        assert atr.value == hma.value
+
     def test_period(self):
         # Arrange, Act, Assert
         assert self.atr.period == 10
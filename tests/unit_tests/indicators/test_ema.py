@@ -15,6 +15,8 @@
 
 from decimal import Decimal
 
+import numpy as np
+
 from nautilus_trader.backtest.data.providers import TestInstrumentProvider
 from nautilus_trader.indicators.average.ema import ExponentialMovingAverage
 from nautilus_trader.model.enums import PriceType
@@ -125,6 +127,22 @@ class TestExponentialMovingAverage:
         # Act, Assert
         assert self.ema.value == 1.5123966942148757
 
+    def test_update_many_results_in_same_value_as_update_raw(self):
+        # Arrange
+        values = np.linspace(1.0, 2.0, 25)
+        ema = ExponentialMovingAverage(10)
+
+        # Act
+        for value in values:
+            ema.update_raw(value)
+        self.ema.update_many(values[:12])
+        self.ema.update_many(values[12:])
+
+        # Assert
+        assert self.ema.initialized
+        assert self.ema.count == 25
+        assert self.ema.value == ema.value
+
     def test_reset_successfully_returns_indicator_to_fresh_state(self):
         # Arrange
         for _i in range(1000):
@@ -13,6 +13,8 @@
 #  limitations under the License.
 # -------------------------------------------------------------------------------------------------
 
+import numpy as np
+
 from nautilus_trader.backtest.data.providers import TestInstrumentProvider
 from nautilus_trader.indicators.rsi import RelativeStrengthIndex
 from tests.test_kit.stubs.data import TestDataStubs
@@ -125,6 +127,14 @@ class TestRelativeStrengthIndex:
         # Act, Assert
         assert self.rsi.value == 0.7615344667662725
 
+    def test_update_many_returns_expected_value(self):
+        # Arrange, Act
+        self.rsi.update_many(np.array([3.0, 2.0, 5.0, 6.0, 7.0, 6.0, 6.0, 7.0]))
+
+        # Assert
+        assert self.rsi.has_inputs
+        assert self.rsi.value == 0.7615344667662725
+
     def test_reset_successfully_returns_indicator_to_fresh_state(self):
         # Arrange
         self.rsi.update_raw(1.00020)
@@ -13,6 +13,8 @@
 #  limitations under the License.
 # -------------------------------------------------------------------------------------------------
 
+import numpy as np
+
 from nautilus_trader.backtest.data.providers import TestInstrumentProvider
 from nautilus_trader.indicators.average.sma import SimpleMovingAverage
 from nautilus_trader.model.enums import PriceType
@@ -160,6 +162,22 @@ class TestSimpleMovingAverage:
         assert sma_for_ticks.has_inputs
         assert sma_for_ticks.value == 1.00001
 
+    def test_update_many_results_in_same_value_as_update_raw(self):
+        # Arrange
+        values = np.linspace(1.0, 2.0, 25)
+        sma = SimpleMovingAverage(10)
+
+        # Act
+        for value in values:
+            sma.update_raw(value)
+        self.sma.update_many(values[:12])
+        self.sma.update_many(values[12:])
+
+        # Assert
+        assert self.sma.initialized
+        assert self.sma.count == 25
+        assert self.sma.value == sma.value
+
     def test_reset_successfully_returns_indicator_to_fresh_state(self):
         # Arrange
         for _i in range(1000):
@@ -15,6 +15,7 @@
 
 from decimal import Decimal
 
+import numpy as np
 import pytest
 
 from nautilus_trader.backtest.data.providers import TestDataProvider
@@ -294,6 +295,73 @@ class TestInstrument:
         # Assert
         assert str(qty) == expected_str
 
+    @pytest.mark.parametrize(
+        "value, expected_str",
+        [
+            [1.234564, "1.23456"],
+            [1.234565, "1.23457"],
+            [1.2345649, "1.23456"],
+            [0.0, "0.00000"],
+        ],
+    )
+    def test_quantize_price_rounds_to_nearest_increment(self, value, expected_str):
+        # Arrange, Act
+        price = AUDUSD_SIM.quantize_price(value)
+
+        # Assert
+        assert str(price) == expected_str
+
+    @pytest.mark.parametrize(
+        "value, expected_str",
+        [
+            [0.0000019, "0.000001"],
+            [1.2345679, "1.234567"],
+            [0.0, "0.000001"],  # Clamped to min quantity
+            [10000.0, "9000.000000"],  # Clamped to max quantity
+        ],
+    )
+    def test_quantize_qty_rounds_down_and_clamps_to_limits(self, value, expected_str):
+        # Arrange, Act
+        qty = BTCUSDT_BINANCE.quantize_qty(value)
+
+        # Assert
+        assert str(qty) == expected_str
+
+    def test_quantize_batch_matches_single_values(self):
+        # Arrange
+        values = np.array([0.001, 1.005, 19_999.994, 2_000_000.0], dtype=np.float64)
+        prices = np.empty(len(values), dtype=np.int64)
+        qtys = np.empty(len(values), dtype=np.uint64)
+
+        # Act
+        BTCUSDT_BINANCE.quantize_prices_raw(values, prices)
+        BTCUSDT_BINANCE.quantize_qtys_raw(values, qtys)
+
+        # Assert
+        assert [Price.from_raw(raw, 2) for raw in prices] == [
+            BTCUSDT_BINANCE.quantize_price(v) for v in values
+        ]
+        assert [Quantity.from_raw(raw, 6) for raw in qtys] == [
+            BTCUSDT_BINANCE.quantize_qty(v) for v in values
+        ]
+
+    def test_betting_instrument_without_price_increment_uses_tick_scheme(self):
+        # Arrange
+        instrument = BetfairTestStubs.betting_instrument()
+        value = 0.3333
+
+        # Act
+        price = instrument.make_price(value)
+        quantized = instrument.quantize_price(value)
+
+        # Assert
+        assert instrument.price_increment is None
+        assert price == Price.from_str("0.3333000")
+        assert quantized in (
+            instrument.next_bid_price(value),
+            instrument.next_ask_price(value),
+        )
+
     @pytest.mark.parametrize(
         "instrument, expected",
         [
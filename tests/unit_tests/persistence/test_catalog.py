@@ -156,6 +156,30 @@ class TestPersistenceCatalog:
         assert instrument.id.value == "AUD/USD.SIM"
         assert trade_tick.instrument_id.value == "AUD/USD.SIM"
 
+    def test_data_catalog_with_relative_local_path(self, tmp_path, monkeypatch):
+        # Arrange
+        monkeypatch.chdir(tmp_path)
+        (tmp_path / "catalog").mkdir()
+        catalog = ParquetDataCatalog(path="catalog", fs_protocol="file")
+        instrument = TestInstrumentProvider.default_fx_ccy("AUD/USD", venue=Venue("SIM"))
+        trade_tick = TradeTick(
+            instrument_id=instrument.id,
+            price=Price.from_str("2.0"),
+            size=Quantity.from_int(10),
+            aggressor_side=AggressorSide.UNKNOWN,
+            trade_id=TradeId("1"),
+            ts_event=0,
+            ts_init=0,
+        )
+        write_objects(catalog=catalog, chunk=[instrument, trade_tick])
+
+        # Act
+        trade_ticks = catalog.trade_ticks(instrument_ids=["AUD/USD.SIM"], as_nautilus=True)
+
+        # Assert
+        assert catalog.path == pathlib.Path.cwd() / "catalog"
+        assert trade_ticks == [trade_tick]
+
     def test_data_catalog_trade_ticks_as_nautilus(self):
         trade_ticks = self.catalog.trade_ticks(as_nautilus=True)
         assert all(isinstance(tick, TradeTick) for tick in trade_ticks)